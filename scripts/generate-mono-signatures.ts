@@ -19,6 +19,11 @@
  *   • struct/enum keywords
  *   • Array parameters (converted to pointers)
  *   • Variadic functions (...)
+ * - Optionally emits arity-specific binding stubs (src/runtime/native-stubs.ts):
+ *   arguments are normalized per declared native type and calls run through
+ *   monomorphic closures instead of MonoApi's generic rest-argument wrapper.
+ *   Stubs are grouped by availability: exports shared by legacy mono and
+ *   MonoBleedingEdge (data/common_exports.txt) vs. flavor-specific ones.
  *
  * Manual signatures and aliases are defined in data/include/mono-manual.h
  *
@@ -28,12 +33,13 @@
  *   npm run generate:signatures -- --root C:\path\to\mono
  *   npm run generate:signatures -- --include "mono-*.h" --exclude "test/**"
  *   npm run generate:signatures -- --filter-exported data/custom.dll.ExportFunctions.txt
+ *   npm run generate:signatures -- --stubs-only     # Rebuild stubs from the existing signatures.ts
  */
 
 import * as fs from "fs";
 import { minimatch } from "minimatch";
 import * as path from "path";
-import { fileURLToPath } from "url";
+import { fileURLToPath, pathToFileURL } from "url";
 
 const __filename = fileURLToPath(import.meta.url);
 const __dirname = path.dirname(__filename);
@@ -44,6 +50,9 @@ interface ConfigFile {
   root?: string;
   outputFile?: string;
   commonExportsFile?: string;
+  sharedExportsFile?: string;
+  stubsFile?: string;
+  stubsScope?: StubScope;
   apiPrefixes?: string[];
   include?: string[];
   exclude?: string[];
@@ -63,6 +72,9 @@ function loadConfigFile(): ConfigFile {
   return {};
 }
 
+/** Which exports get binding stubs: those the bridge calls through `native.*`, or all of them. */
+type StubScope = "used" | "all";
+
 const userConfig = loadConfigFile();
 
 // Configuration from config file only (paths relative to project root)
@@ -74,6 +86,9 @@ const CONFIG = {
   DEFAULT_COMMON_EXPORTS: userConfig.commonExportsFile
     ? path.join(ROOT, userConfig.commonExportsFile)
     : path.join(ROOT, "data", "common_exports.txt"),
+  DEFAULT_SHARED_EXPORTS: path.join(ROOT, userConfig.sharedExportsFile ?? "data/common_exports.txt"),
+  DEFAULT_STUBS_FILE: userConfig.stubsFile ? path.join(ROOT, userConfig.stubsFile) : undefined,
+  SOURCE_DIR: path.join(ROOT, "src"),
   API_PREFIXES: userConfig.apiPrefixes || ["mono", "unity_mono", "monoeg"],
   FUNCTION_PATTERN: /MONO_API\s+([\s\S]*?);/g,
   ENUM_PATTERN: /typedef\s+enum\b[^{}]*{[\s\S]*?}\s*(\w+)\s*;/g,
@@ -86,6 +101,10 @@ interface CLIOptions {
   include: string[];
   exclude: string[];
   commonExports?: string;
+  stubs?: string;
+  stubsScope: StubScope;
+  stubsOnly: boolean;
+  sharedExports: string;
   verbose?: boolean;
   help?: boolean;
 }
@@ -100,6 +119,10 @@ Options:
   --include <pattern>      Include pattern (file path or glob, can be used multiple times)
   --exclude <pattern>      Exclude glob pattern (can be used multiple times)
   --common-exports <path>  Filter by common exports file
+  --stubs <path>           Also emit binding stubs to <path>
+  --no-stubs               Do not emit binding stubs
+  --stubs-scope <scope>    "used" (exports called via native.* in src/, default) or "all"
+  --stubs-only             Only rebuild stubs from the existing signatures file (no headers needed)
   --verbose, -v            Enable verbose logging
   --help, -h               Show this help message
 
@@ -126,6 +149,10 @@ function parseArgs(): CLIOptions {
     include: includeFromConfig,
     exclude: userConfig.exclude || [],
     commonExports: CONFIG.DEFAULT_COMMON_EXPORTS,
+    stubs: CONFIG.DEFAULT_STUBS_FILE,
+    stubsScope: userConfig.stubsScope ?? "used",
+    stubsOnly: false,
+    sharedExports: CONFIG.DEFAULT_SHARED_EXPORTS,
     verbose: userConfig.verbose || false,
     help: false,
   };
@@ -152,6 +179,24 @@ function parseArgs(): CLIOptions {
         }
         options.commonExports = args[++i];
         break;
+      case "--stubs":
+        options.stubs = args[++i];
+        break;
+      case "--no-stubs":
+        options.stubs = undefined;
+        break;
+      case "--stubs-scope": {
+        const scope = args[++i];
+        if (scope !== "used" && scope !== "all") {
+          console.error(`Error: --stubs-scope must be "used" or "all", got ${scope}`);
+          process.exit(1);
+        }
+        options.stubsScope = scope;
+        break;
+      }
+      case "--stubs-only":
+        options.stubsOnly = true;
+        break;
       case "--verbose":
       case "-v":
         options.verbose = true;
@@ -542,7 +587,7 @@ function parseCommonExports(
   }
 
   try {
-    const content = fs.readFileSync(filePath, "utf-8");
+    const content = fs.readFileSync(filePath, "utf-8").replace(/^\uFEFF/, "");
     const lines = content.split("\n");
     let lineCount = 0;
 
@@ -685,9 +730,170 @@ function formatSignatureEntry(name: string, signature: MonoExportSignature, inde
   );
 }
 
+// ============================================================================
+// Binding stubs
+// ============================================================================
+
+/** Normalizer per declared argument type; anything not a pointer is an integer of some width. */
+function stubNormalizer(argType: string): "p" | "n" {
+  return argType === "pointer" ? "p" : "n";
+}
+
+/**
+ * Collect exports the bridge calls as `native.<name>` in its sources.
+ * @param exclude - Absolute paths of generated files to skip
+ */
+function collectUsedExports(dir: string, exclude: Set<string>): Set<string> {
+  const used = new Set<string>();
+  const pattern = /\bnative\.([A-Za-z_][A-Za-z0-9_]*)/g;
+  const visit = (current: string): void => {
+    for (const entry of fs.readdirSync(current, { withFileTypes: true })) {
+      const fullPath = path.join(current, entry.name);
+      if (entry.isDirectory()) {
+        visit(fullPath);
+      } else if (entry.isFile() && entry.name.endsWith(".ts") && !exclude.has(fullPath)) {
+        const source = fs.readFileSync(fullPath, "utf-8");
+        let match: RegExpExecArray | null;
+        while ((match = pattern.exec(source)) !== null) {
+          used.add(match[1]);
+        }
+      }
+    }
+  };
+  visit(dir);
+  return used;
+}
+
+function formatStubEntry(name: string, signature: MonoExportSignature, indent: string = "  "): string {
+  const argTypes = signature.argTypes.filter(arg => arg !== "void");
+  const params = argTypes.map((_, index) => `a${index}`);
+  const head = params.length === 1 ? params[0] : `(${params.join(", ")})`;
+  const call = `f(${argTypes.map((arg, index) => `${stubNormalizer(arg)}(a${index})`).join(", ")})`;
+  const body =
+    signature.retType === "void"
+      ? [`if (c.direct()) {`, `  ${call};`, `} else {`, `  c.run(() => ${call});`, `}`]
+      : [`if (c.direct()) {`, `  return ${call};`, `}`, `return c.run(() => ${call});`];
+  const lines = [`${name}: (f, c) => ${head} => {`, ...body.map(line => `  ${line}`), `},`];
+  return lines.map(line => `${indent}${line}`).join("\n");
+}
+
+function formatStubGroup(
+  title: string,
+  constName: string,
+  names: string[],
+  functions: Record<string, MonoExportSignature>,
+): string {
+  const entries = names.map(name => formatStubEntry(name, functions[name])).join("\n");
+  return `/** ${title} */
+export const ${constName}: Readonly<Record<string, NativeStubFactory>> = {
+${entries}
+};
+`;
+}
+
+/**
+ * Emit arity-specific binding stubs for `functions`.
+ */
+function writeStubs(functions: Record<string, MonoExportSignature>, options: CLIOptions): void {
+  const out = options.stubs!;
+  let names = Object.keys(functions).sort();
+  if (options.stubsScope === "used") {
+    const used = collectUsedExports(CONFIG.SOURCE_DIR, new Set([path.resolve(out), path.resolve(options.out)]));
+    names = names.filter(name => used.has(name));
+  }
+
+  const shared = parseCommonExports(options.sharedExports, CONFIG.API_PREFIXES, options.verbose);
+  const sharedNames = names.filter(name => shared.has(name));
+  const flavorNames = names.filter(name => !shared.has(name));
+  const sharedGroup = formatStubGroup(
+    "Exports shared by legacy mono and MonoBleedingEdge builds.",
+    "SHARED_NATIVE_STUBS",
+    sharedNames,
+    functions,
+  );
+  const flavorGroup = formatStubGroup(
+    "Exports only some runtime flavors provide.",
+    "FLAVOR_NATIVE_STUBS",
+    flavorNames,
+    functions,
+  );
+
+  const content = `// Auto-generated by scripts/generate-mono-signatures.ts; do not edit by hand.
+// Run: npm run generate:signatures -- --stubs-only
+//
+// Arity-specific binding stubs for hot exports of signatures.ts. Each stub
+// normalizes its arguments according to the declared native types and calls
+// the NativeFunction directly, so MonoApi.native call sites stay monomorphic
+// instead of going through a generic rest-argument wrapper.
+
+import type { MonoArg, MonoNativeFunction } from "./api";
+
+// ============================================================================
+// Type Definitions
+// ============================================================================
+
+/** How a stub reaches the runtime thread. */
+export interface NativeStubContext {
+  /** Whether the call can be made on the current thread as is */
+  direct(): boolean;
+  /** Run \`fn\` attached to the runtime */
+  run<T>(fn: () => T): T;
+}
+
+export type NativeStubFactory = (
+  f: NativeFunction<NativeFunctionReturnValue, NativeFunctionArgumentValue[]>,
+  c: NativeStubContext,
+) => MonoNativeFunction;
+
+// ============================================================================
+// Argument Normalizers
+// ============================================================================
+
+/** Pointer argument: null and undefined become NULL. */
+function p(arg: MonoArg): NativeFunctionArgumentValue {
+  return arg === null || arg === undefined ? NULL : (arg as NativeFunctionArgumentValue);
+}
+
+/** Integer argument: booleans become 0/1, null and undefined become 0. */
+function n(arg: MonoArg): NativeFunctionArgumentValue {
+  if (typeof arg === "boolean") {
+    return arg ? 1 : 0;
+  }
+  return arg === null || arg === undefined ? 0 : (arg as NativeFunctionArgumentValue);
+}
+
+// ============================================================================
+// Stubs
+// ============================================================================
+
+${sharedGroup}
+${flavorGroup}`;
+
+  fs.writeFileSync(out, content, "utf-8");
+  const counts = `${sharedNames.length} shared, ${flavorNames.length} flavor-specific`;
+  console.log(`Generated ${names.length} binding stubs (${counts}) -> ${path.relative(ROOT, out)}`);
+}
+
+/**
+ * Rebuild stubs from an existing signatures file without scanning headers.
+ */
+async function generateStubsOnly(options: CLIOptions): Promise<void> {
+  if (!options.stubs) {
+    console.error("Error: --stubs-only needs a stubs file (--stubs <path> or stubsFile in the config)");
+    process.exit(1);
+  }
+  const module = await import(pathToFileURL(path.resolve(options.out)).href);
+  writeStubs(module.ALL_SIGNATURES as Record<string, MonoExportSignature>, options);
+}
+
 function generate(): void {
   const options = parseArgs();
 
+  if (options.stubsOnly) {
+    void generateStubsOnly(options);
+    return;
+  }
+
   if (!options.root && options.include.length === 0) {
     console.error("Error: Either --root or --include must be specified");
     console.error("Use --help for usage information");
@@ -923,6 +1129,10 @@ ${signatureEntries}
   fs.writeFileSync(options.out, content, "utf-8");
   const relativePath = path.relative(ROOT, options.out);
   console.log(`Generated ${Object.keys(functions).length} signatures -> ${relativePath}`);
+
+  if (options.stubs) {
+    writeStubs(functions, options);
+  }
 }
 
 // Run the generator
@@ -78,6 +78,7 @@ export {
   ValidationBuilder,
   withErrorHandling,
 } from "./utils/errors";
+export type { ManagedExceptionInfo, ManagedExceptionResolver } from "./utils/errors";
 
 // ============================================================================
 // POWER-USER EXPORTS (runtime/model/utils)
@@ -85,7 +86,24 @@ export {
 
 // Runtime layer (low-level API + module/thread helpers)
 export { createMonoApi, MonoApi } from "./runtime/api";
-export { tryWaitForMonoModule, waitForMonoModule } from "./runtime/module";
+export { CacheScopeRegistry } from "./runtime/cache-scope";
+export type { CacheScopeEvent, CacheScopeKind, CacheScopeReason, CacheScopeStats } from "./runtime/cache-scope";
+export { findAllMonoModules, tryWaitForMonoModule, waitForMonoModule } from "./runtime/module";
+export { SafepointBatcher } from "./runtime/safepoint";
+export type { SafepointConfig, SafepointMode, SafepointScope, SafepointStats } from "./runtime/safepoint";
+export { loadSessionSnapshot, saveSessionSnapshot, SessionState } from "./runtime/session-state";
+export type { SessionRestoreResult, SessionSnapshot, SessionStorage } from "./runtime/session-state";
+export { RuntimeStrategies } from "./runtime/strategies";
+export type {
+  ClassStrategy,
+  GenericStrategy,
+  RuntimeStrategySummary,
+  RuntimeTier,
+  StringReadKind,
+  ThreadAttachStrategy,
+} from "./runtime/strategies";
+export { ManagedStringCache } from "./runtime/string-cache";
+export type { ManagedStringCacheConfig, ManagedStringCacheStats } from "./runtime/string-cache";
 export { ThreadManager } from "./runtime/thread";
 export { MonoRuntimeVersion } from "./runtime/version";
 
@@ -96,14 +114,24 @@ export { MonoClass } from "./model/class";
 export { MonoDelegate } from "./model/delegate";
 export { MonoDomain } from "./model/domain";
 export { MonoField } from "./model/field";
+export { FieldWatchManager } from "./model/field-watch";
 export { GarbageCollector } from "./model/gc";
 export { MonoImage } from "./model/image";
+export { ImageTypeTable } from "./model/image-table";
+export type { ImageTypeTableStats } from "./model/image-table";
+export { JitRangeIndex } from "./model/jit-ranges";
 export { MonoMethod } from "./model/method";
 export { MonoObject } from "./model/object";
+export { ObjectWatch } from "./model/object-watch";
 export { MonoProperty } from "./model/property";
+export { SourceLocationResolver } from "./model/source-location";
+export { StackWalker } from "./model/stack";
 export { MonoString } from "./model/string";
 export { Tracer } from "./model/trace";
 export { MonoType } from "./model/type";
+export { TypeKeyedMap } from "./model/type-map";
+export { TypeNameResolver, parseTypeName } from "./model/type-name";
+export type { ParsedTypeName, TypeNameModifier, TypeNameResolverStats } from "./model/type-name";
 
 // Utils (logging + caching are commonly used standalone)
 export { lazy, LruCache, memoize } from "./utils/cache";
@@ -114,12 +142,13 @@ export {
   allocPrimitiveValue,
   convertJsToMono,
   convertMonoToJs,
+  getTypeConversionInfo,
   resolveInstance,
   resolveUnderlyingPrimitive,
   unboxValue,
   validateNumericValue,
 } from "./runtime/value-conversion";
-export type { ConversionOptions, MonoValueWrappers } from "./runtime/value-conversion";
+export type { ConversionOptions, MonoValueWrappers, TypeConversionInfo } from "./runtime/value-conversion";
 
 // ============================================================================
 // TRACE TYPES (for method hooking callbacks)
@@ -138,3 +167,4 @@ export type * from "./types";
 
 // Allow creating additional namespaces (advanced use-cases / multi-runtime workflows)
 export { MonoNamespace } from "./mono";
+export type { MonoTeardownStats } from "./mono";
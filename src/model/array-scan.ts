@@ -0,0 +1,779 @@
+/**
+ * Native scans over primitive arrays.
+ *
+ * Predicate searches ("indices where value > threshold"), counts and
+ * min/max/sum run in a CModule over the array's element storage, so a scan
+ * over millions of elements costs one native call per output chunk instead of
+ * one JS callback and memory read per element. Platforms without a CModule
+ * backend copy the range once and scan the typed-array copy in JavaScript.
+ *
+ * Byte-pattern search uses `Memory.scanSync`, which accepts wildcards.
+ *
+ * @module model/array-scan
+ */
+
+import { MonoErrorCodes, raise } from "../utils/errors";
+import { Logger } from "../utils/log";
+import type { MonoArray } from "./array";
+import { MonoTypeKind } from "./type";
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+/** Comparison against one operand. */
+export type ArrayScanComparison = "eq" | "ne" | "lt" | "le" | "gt" | "ge";
+
+/**
+ * Element predicate evaluated natively:
+ * - `{ op: "gt", value: 100 }`: comparison
+ * - `{ op: "between", min: 0, max: 9 }`: inclusive range
+ * - `{ op: "in", values: [1, 2, 3] }`: equality set
+ *
+ * Operands keep their exact value: integer element scans clamp and round them
+ * to an equivalent in-range predicate (e.g. `lt 2.5` on Int32 matches 2), and
+ * predicates no element can satisfy (or every element satisfies) skip the
+ * scan. 64-bit elements accept bigint.
+ */
+export type ArrayScanPredicate =
+  | { op: ArrayScanComparison; value: number | bigint }
+  | { op: "between"; min: number | bigint; max: number | bigint }
+  | { op: "in"; values: ReadonlyArray<number | bigint> };
+
+/** Element range and result limit for a scan. */
+export interface ArrayScanOptions {
+  /** First flat index to scan (default 0) */
+  start?: number;
+  /** Flat index after the last one to scan (default: array length) */
+  end?: number;
+  /** Stop after this many matches */
+  limit?: number;
+}
+
+/** Aggregates over a range; NaN elements are skipped. */
+export interface ArrayScanSummary {
+  /** Elements that contributed (excludes NaN) */
+  count: number;
+  /** Sum; bigint for 64-bit integer elements (wraps on overflow) */
+  sum: number | bigint;
+  min: number | bigint | null;
+  max: number | bigint | null;
+  /** Flat index of the first minimum, or -1 when empty */
+  minIndex: number;
+  /** Flat index of the first maximum, or -1 when empty */
+  maxIndex: number;
+}
+
+type ScanElement = "i8" | "u8" | "i16" | "u16" | "i32" | "u32" | "i64" | "u64" | "f32" | "f64";
+
+type ScanArgs = [NativePointer, number, number, number, NativePointer, number, NativePointer, number, NativePointer];
+
+interface ScanKernel {
+  scan: NativeFunction<number, ScanArgs>;
+  stats: NativeFunction<void, [NativePointer, number, NativePointer]>;
+}
+
+const scanLogger = Logger.withTag("ArrayScan");
+
+// =============================================================================
+// SCANS
+// =============================================================================
+
+/**
+ * Indices of elements matching `predicate`, in ascending order.
+ * @throws {MonoError} TYPE_MISMATCH for non-primitive element types
+ */
+export function findArrayIndices(
+  array: MonoArray,
+  predicate: ArrayScanPredicate,
+  options: ArrayScanOptions = {},
+): Uint32Array {
+  const element = scanElementOf(array);
+  const [start, end] = resolveRange(array, options);
+  const limit = options.limit ?? Infinity;
+  if (start === end || limit <= 0) {
+    return new Uint32Array(0);
+  }
+
+  const normalized = normalizePredicate(element, predicate);
+  if (typeof normalized === "boolean") {
+    return normalized ? rangeIndices(start, Math.min(end, start + limit)) : new Uint32Array(0);
+  }
+
+  const kernel = getKernel(element);
+  if (!kernel) {
+    return findIndicesFallback(readRange(array, element, start, end), start, normalized, limit, element);
+  }
+
+  const { op, operands, count } = encodeOperands(element, normalized);
+  const capacity = Math.min(limit, end - start, OUTPUT_CHUNK);
+  const out = Memory.alloc(capacity * 4);
+  const next = Memory.alloc(4);
+  const base = array.getElementAddress(0);
+
+  const chunks: Uint32Array[] = [];
+  let found = 0;
+  let cursor = start;
+  while (cursor < end && found < limit) {
+    const room = Math.min(capacity, limit - found);
+    const written = kernel.scan(base, cursor, end, op, operands, count, out, room, next);
+    if (written > 0) {
+      chunks.push(new Uint32Array(out.readByteArray(written * 4)!));
+      found += written;
+    }
+    cursor = next.readU32();
+    if (written < room) {
+      break;
+    }
+  }
+  return concatIndices(chunks, found);
+}
+
+/**
+ * Number of elements matching `predicate`. `options.limit` is ignored.
+ */
+export function countArrayMatches(
+  array: MonoArray,
+  predicate: ArrayScanPredicate,
+  options: ArrayScanOptions = {},
+): number {
+  const element = scanElementOf(array);
+  const [start, end] = resolveRange(array, options);
+  if (start === end) {
+    return 0;
+  }
+
+  const normalized = normalizePredicate(element, predicate);
+  if (typeof normalized === "boolean") {
+    return normalized ? end - start : 0;
+  }
+
+  const kernel = getKernel(element);
+  if (!kernel) {
+    return findIndicesFallback(readRange(array, element, start, end), start, normalized, Infinity, element).length;
+  }
+  const { op, operands, count } = encodeOperands(element, normalized);
+  return kernel.scan(array.getElementAddress(0), start, end, op, operands, count, NULL, 0, Memory.alloc(4));
+}
+
+/**
+ * Count, sum, minimum and maximum over a range.
+ */
+export function summarizeArray(array: MonoArray, options: ArrayScanOptions = {}): ArrayScanSummary {
+  const element = scanElementOf(array);
+  const [start, end] = resolveRange(array, options);
+  const kernel = getKernel(element);
+  if (!kernel || start === end) {
+    return summarizeFallback(start === end ? [] : readRange(array, element, start, end), start, element);
+  }
+
+  const result = Memory.alloc(STATS_RESULT_SIZE);
+  kernel.stats(array.getElementAddress(start), end - start, result);
+  const count = result.add(32).readU32();
+  const wide = element === "i64" || element === "u64";
+  const float = element === "f32" || element === "f64";
+  return {
+    count,
+    sum: float ? result.readDouble() : wide ? readWide(result, element as "i64" | "u64") : result.readS64().toNumber(),
+    min: count > 0 ? readElement(result.add(8), element) : null,
+    max: count > 0 ? readElement(result.add(16), element) : null,
+    minIndex: count > 0 ? start + result.add(24).readU32() : -1,
+    maxIndex: count > 0 ? start + result.add(28).readU32() : -1,
+  };
+}
+
+/**
+ * Byte offsets (from the first element) where `pattern` occurs.
+ *
+ * @param pattern Frida pattern string ("12 34 ?? 56") or raw bytes
+ */
+export function findArrayPattern(
+  array: MonoArray,
+  pattern: string | ArrayLike<number>,
+  options: ArrayScanOptions = {},
+): number[] {
+  if (!array.elementClass.isValueType) {
+    raise(MonoErrorCodes.TYPE_MISMATCH, `Cannot scan bytes of reference-type array ${array.toString()}`);
+  }
+  const [start, end] = resolveRange(array, options);
+  if (start === end) {
+    return [];
+  }
+  const elementSize = array.elementSize;
+  const data = array.getElementAddress(0);
+  const text = typeof pattern === "string" ? pattern : toPatternString(pattern);
+  const limit = options.limit ?? Infinity;
+
+  const offsets: number[] = [];
+  for (const match of Memory.scanSync(data.add(start * elementSize), (end - start) * elementSize, text)) {
+    if (offsets.length >= limit) {
+      break;
+    }
+    offsets.push(match.address.sub(data).toInt32());
+  }
+  return offsets;
+}
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+function scanElementOf(array: MonoArray): ScanElement {
+  const type = array.elementClass.type;
+  const kind = type.kind === MonoTypeKind.Enum ? (type.underlyingType?.kind ?? type.kind) : type.kind;
+  switch (kind) {
+    case MonoTypeKind.I1:
+      return "i8";
+    case MonoTypeKind.U1:
+    case MonoTypeKind.Boolean:
+      return "u8";
+    case MonoTypeKind.I2:
+      return "i16";
+    case MonoTypeKind.U2:
+    case MonoTypeKind.Char:
+      return "u16";
+    case MonoTypeKind.I4:
+      return "i32";
+    case MonoTypeKind.U4:
+      return "u32";
+    case MonoTypeKind.I8:
+      return "i64";
+    case MonoTypeKind.U8:
+      return "u64";
+    case MonoTypeKind.R4:
+      return "f32";
+    case MonoTypeKind.R8:
+      return "f64";
+    case MonoTypeKind.Int:
+      return Process.pointerSize === 8 ? "i64" : "i32";
+    case MonoTypeKind.UInt:
+      return Process.pointerSize === 8 ? "u64" : "u32";
+  }
+  raise(
+    MonoErrorCodes.TYPE_MISMATCH,
+    `Native scans need a primitive element type, got ${array.elementClass.fullName}`,
+    "Use findPattern() for raw bytes or the callback-based where()/findIndex()",
+  );
+}
+
+function resolveRange(array: MonoArray, options: ArrayScanOptions): [number, number] {
+  const length = array.length;
+  const start = options.start ?? 0;
+  const end = options.end ?? length;
+  if (!Number.isInteger(start) || !Number.isInteger(end) || start < 0 || end > length || start > end) {
+    raise(
+      MonoErrorCodes.INVALID_ARGUMENT,
+      `Scan range [${start}, ${end}) is invalid for array of length ${length}`,
+    );
+  }
+  return [start, end];
+}
+
+/**
+ * Rewrite a predicate on an integer element type so every operand fits the
+ * element: fractional bounds are rounded toward the matching side, bounds
+ * outside the element range are clamped, and non-integer or out-of-range
+ * equality operands are dropped. Returns `true`/`false` when the predicate
+ * matches every element or none, so the kernel's fixed-width operands never
+ * wrap or truncate.
+ */
+function normalizePredicate(element: ScanElement, predicate: ArrayScanPredicate): ArrayScanPredicate | boolean {
+  const range = INTEGER_RANGES[element];
+  if (!range) {
+    return predicate;
+  }
+  const [min, max] = range;
+  const wide = element === "i64" || element === "u64";
+  const operand = (value: bigint): number | bigint => (wide ? value : Number(value));
+  const exact = (value: number | bigint): bigint | null => {
+    if (typeof value === "number" && !Number.isInteger(value)) {
+      return null;
+    }
+    const integer = BigInt(value);
+    return integer >= min && integer <= max ? integer : null;
+  };
+  const isNaNOperand = (value: number | bigint) => typeof value === "number" && Number.isNaN(value);
+
+  switch (predicate.op) {
+    case "eq":
+    case "ne": {
+      const value = exact(predicate.value);
+      if (value === null) {
+        return predicate.op === "ne";
+      }
+      return { op: predicate.op, value: operand(value) };
+    }
+    case "in": {
+      const values = new Set<bigint>();
+      for (const candidate of predicate.values) {
+        const value = exact(candidate);
+        if (value !== null) {
+          values.add(value);
+        }
+      }
+      return values.size === 0 ? false : { op: "in", values: Array.from(values, operand) };
+    }
+    case "between": {
+      if (isNaNOperand(predicate.min) || isNaNOperand(predicate.max)) {
+        return false;
+      }
+      const low = maxBigInt(integerBound(predicate.min, "ceil", min, max), min);
+      const high = minBigInt(integerBound(predicate.max, "floor", min, max), max);
+      if (low > high) {
+        return false;
+      }
+      if (low === min && high === max) {
+        return true;
+      }
+      return { op: "between", min: operand(low), max: operand(high) };
+    }
+  }
+
+  if (isNaNOperand(predicate.value)) {
+    return false;
+  }
+  // x < v  <=>  x <= ceil(v) - 1;  x > v  <=>  x >= floor(v) + 1
+  let upper: bigint | null = null;
+  let lower: bigint | null = null;
+  switch (predicate.op) {
+    case "lt":
+      upper = integerBound(predicate.value, "ceil", min, max) - 1n;
+      break;
+    case "le":
+      upper = integerBound(predicate.value, "floor", min, max);
+      break;
+    case "gt":
+      lower = integerBound(predicate.value, "floor", min, max) + 1n;
+      break;
+    case "ge":
+      lower = integerBound(predicate.value, "ceil", min, max);
+      break;
+  }
+  if (upper !== null) {
+    return upper < min ? false : upper >= max ? true : { op: "le", value: operand(upper) };
+  }
+  return lower! > max ? false : lower! <= min ? true : { op: "ge", value: operand(lower!) };
+}
+
+/** Round `value` to an integer; infinities map just outside `[min, max]`. */
+function integerBound(value: number | bigint, round: "floor" | "ceil", min: bigint, max: bigint): bigint {
+  if (typeof value === "bigint") {
+    return value;
+  }
+  if (value === Infinity) {
+    return max + 1n;
+  }
+  if (value === -Infinity) {
+    return min - 1n;
+  }
+  return BigInt(round === "floor" ? Math.floor(value) : Math.ceil(value));
+}
+
+function minBigInt(a: bigint, b: bigint): bigint {
+  return a < b ? a : b;
+}
+
+function maxBigInt(a: bigint, b: bigint): bigint {
+  return a > b ? a : b;
+}
+
+function rangeIndices(start: number, end: number): Uint32Array {
+  const result = new Uint32Array(end - start);
+  for (let i = 0; i < result.length; i++) {
+    result[i] = start + i;
+  }
+  return result;
+}
+
+function encodeOperands(
+  element: ScanElement,
+  predicate: ArrayScanPredicate,
+): { op: number; operands: NativePointer; count: number } {
+  const values =
+    predicate.op === "between"
+      ? [predicate.min, predicate.max]
+      : predicate.op === "in"
+        ? predicate.values
+        : [predicate.value];
+  const size = ELEMENT_SIZES[element];
+  const operands = Memory.alloc(Math.max(values.length, 1) * size);
+  values.forEach((value, i) => writeElement(operands.add(i * size), element, value));
+  return { op: OPCODES[predicate.op], operands, count: values.length };
+}
+
+function writeElement(address: NativePointer, element: ScanElement, value: number | bigint): void {
+  switch (element) {
+    case "i8":
+      address.writeS8(Number(value));
+      break;
+    case "u8":
+      address.writeU8(Number(value));
+      break;
+    case "i16":
+      address.writeS16(Number(value));
+      break;
+    case "u16":
+      address.writeU16(Number(value));
+      break;
+    case "i32":
+      address.writeS32(Number(value));
+      break;
+    case "u32":
+      address.writeU32(Number(value));
+      break;
+    case "i64":
+      address.writeS64(int64(value.toString()));
+      break;
+    case "u64":
+      address.writeU64(uint64(value.toString()));
+      break;
+    case "f32":
+      address.writeFloat(Number(value));
+      break;
+    case "f64":
+      address.writeDouble(Number(value));
+      break;
+  }
+}
+
+function readElement(address: NativePointer, element: ScanElement): number | bigint {
+  switch (element) {
+    case "i8":
+      return address.readS8();
+    case "u8":
+      return address.readU8();
+    case "i16":
+      return address.readS16();
+    case "u16":
+      return address.readU16();
+    case "i32":
+      return address.readS32();
+    case "u32":
+      return address.readU32();
+    case "i64":
+    case "u64":
+      return readWide(address, element);
+    case "f32":
+      return address.readFloat();
+    case "f64":
+      return address.readDouble();
+  }
+}
+
+function readWide(address: NativePointer, element: "i64" | "u64"): bigint {
+  return BigInt((element === "i64" ? address.readS64() : address.readU64()).toString());
+}
+
+function readRange(array: MonoArray, element: ScanElement, start: number, end: number): ArrayLike<number | bigint> {
+  const bytes = array.getElementAddress(start).readByteArray((end - start) * ELEMENT_SIZES[element])!;
+  return new TYPED_ARRAYS[element](bytes);
+}
+
+function concatIndices(chunks: Uint32Array[], total: number): Uint32Array {
+  if (chunks.length === 1) {
+    return chunks[0];
+  }
+  const result = new Uint32Array(total);
+  let offset = 0;
+  for (const chunk of chunks) {
+    result.set(chunk, offset);
+    offset += chunk.length;
+  }
+  return result;
+}
+
+function toPatternString(bytes: ArrayLike<number>): string {
+  const parts: string[] = [];
+  for (let i = 0; i < bytes.length; i++) {
+    parts.push((bytes[i] & 0xff).toString(16).padStart(2, "0"));
+  }
+  return parts.join(" ");
+}
+
+// ===== JS FALLBACK =====
+
+function findIndicesFallback(
+  values: ArrayLike<number | bigint>,
+  start: number,
+  predicate: ArrayScanPredicate,
+  limit: number,
+  element: ScanElement,
+): Uint32Array {
+  const matches = compilePredicate(predicate, element);
+  const result: number[] = [];
+  for (let i = 0; i < values.length && result.length < limit; i++) {
+    if (matches(values[i])) {
+      result.push(start + i);
+    }
+  }
+  return Uint32Array.from(result);
+}
+
+function compilePredicate(predicate: ArrayScanPredicate, element: ScanElement): (value: number | bigint) => boolean {
+  const wide = element === "i64" || element === "u64";
+  // The kernel compares f32 elements against operands stored as float, so round them the same way
+  const coerce = (value: number | bigint) =>
+    wide ? BigInt(value) : element === "f32" ? Math.fround(Number(value)) : Number(value);
+  switch (predicate.op) {
+    case "between": {
+      const min = coerce(predicate.min);
+      const max = coerce(predicate.max);
+      return value => value >= min && value <= max;
+    }
+    case "in": {
+      const set = new Set(predicate.values.map(coerce));
+      return value => set.has(value);
+    }
+  }
+  const operand = coerce(predicate.value);
+  switch (predicate.op) {
+    case "eq":
+      return value => value === operand;
+    case "ne":
+      return value => value !== operand;
+    case "lt":
+      return value => value < operand;
+    case "le":
+      return value => value <= operand;
+    case "gt":
+      return value => value > operand;
+    case "ge":
+      return value => value >= operand;
+  }
+}
+
+function summarizeFallback(values: ArrayLike<number | bigint>, start: number, element: ScanElement): ArrayScanSummary {
+  const wide = element === "i64" || element === "u64";
+  let count = 0;
+  let sum: number | bigint = wide ? 0n : 0;
+  let min: number | bigint | null = null;
+  let max: number | bigint | null = null;
+  let minIndex = -1;
+  let maxIndex = -1;
+  for (let i = 0; i < values.length; i++) {
+    const value = values[i];
+    if (value !== value) {
+      continue;
+    }
+    if (min === null || value < min) {
+      min = value;
+      minIndex = start + i;
+    }
+    if (max === null || value > max) {
+      max = value;
+      maxIndex = start + i;
+    }
+    sum = wide ? BigInt.asIntN(64, (sum as bigint) + (value as bigint)) : (sum as number) + (value as number);
+    count++;
+  }
+  if (element === "u64") {
+    sum = BigInt.asUintN(64, sum as bigint);
+  }
+  return { count, sum, min, max, minIndex, maxIndex };
+}
+
+// ===== KERNELS =====
+
+let kernelModule: CModule | null | undefined;
+const kernels = new Map<ScanElement, ScanKernel>();
+
+function getKernel(element: ScanElement): ScanKernel | null {
+  if (kernelModule === undefined) {
+    try {
+      kernelModule = new CModule(SCAN_KERNEL_SOURCE);
+    } catch (error) {
+      scanLogger.debug(`CModule unavailable, scanning in JavaScript: ${error}`);
+      kernelModule = null;
+    }
+  }
+  if (!kernelModule) {
+    return null;
+  }
+
+  let kernel = kernels.get(element);
+  if (!kernel) {
+    kernel = {
+      scan: new NativeFunction(kernelModule[`scan_${element}`], "uint", [
+        "pointer",
+        "uint",
+        "uint",
+        "int",
+        "pointer",
+        "uint",
+        "pointer",
+        "uint",
+        "pointer",
+      ]),
+      stats: new NativeFunction(kernelModule[`stats_${element}`], "void", ["pointer", "uint", "pointer"]),
+    };
+    kernels.set(element, kernel);
+  }
+  return kernel;
+}
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+const OPCODES: Readonly<Record<ArrayScanPredicate["op"], number>> = Object.freeze({
+  eq: 0,
+  ne: 1,
+  lt: 2,
+  le: 3,
+  gt: 4,
+  ge: 5,
+  between: 6,
+  in: 7,
+});
+
+const ELEMENT_SIZES: Readonly<Record<ScanElement, number>> = Object.freeze({
+  i8: 1,
+  u8: 1,
+  i16: 2,
+  u16: 2,
+  i32: 4,
+  u32: 4,
+  i64: 8,
+  u64: 8,
+  f32: 4,
+  f64: 8,
+});
+
+const TYPED_ARRAYS: Readonly<Record<ScanElement, new (buffer: ArrayBuffer) => ArrayLike<number | bigint>>> =
+  Object.freeze({
+    i8: Int8Array,
+    u8: Uint8Array,
+    i16: Int16Array,
+    u16: Uint16Array,
+    i32: Int32Array,
+    u32: Uint32Array,
+    i64: BigInt64Array,
+    u64: BigUint64Array,
+    f32: Float32Array,
+    f64: Float64Array,
+  });
+
+/** Inclusive value range of integer element types. */
+const INTEGER_RANGES: Readonly<Partial<Record<ScanElement, readonly [bigint, bigint]>>> = Object.freeze({
+  i8: [-(1n << 7n), (1n << 7n) - 1n],
+  u8: [0n, (1n << 8n) - 1n],
+  i16: [-(1n << 15n), (1n << 15n) - 1n],
+  u16: [0n, (1n << 16n) - 1n],
+  i32: [-(1n << 31n), (1n << 31n) - 1n],
+  u32: [0n, (1n << 32n) - 1n],
+  i64: [-(1n << 63n), (1n << 63n) - 1n],
+  u64: [0n, (1n << 64n) - 1n],
+});
+
+/** Matches written per native call before results are copied out. */
+const OUTPUT_CHUNK = 64 * 1024;
+
+/** sum (8) + min (8) + max (8) + minIndex (4) + maxIndex (4) + count (4), padded */
+const STATS_RESULT_SIZE = 40;
+
+/**
+ * One scan and one stats function per element type. `scan_*` writes up to
+ * `capacity` matching indices (or only counts them when `out` is NULL) and
+ * stores the index to resume from in `*next`.
+ */
+const SCAN_KERNEL_SOURCE = `
+#define OP_EQ 0
+#define OP_NE 1
+#define OP_LT 2
+#define OP_LE 3
+#define OP_GT 4
+#define OP_GE 5
+#define OP_BETWEEN 6
+#define OP_IN 7
+
+#define SCAN_MATCH(cond) \\
+  for (i = start; i < end; i++) \\
+  { \\
+    if (cond) \\
+    { \\
+      if (out != 0) \\
+      { \\
+        if (written == capacity) \\
+          break; \\
+        out[written] = i; \\
+      } \\
+      written++; \\
+    } \\
+  }
+
+#define DEFINE_KERNELS(name, T, ACC) \\
+static int \\
+contains_##name (T value, const T * values, unsigned int count) \\
+{ \\
+  unsigned int j; \\
+  for (j = 0; j != count; j++) \\
+    if (values[j] == value) \\
+      return 1; \\
+  return 0; \\
+} \\
+\\
+unsigned int \\
+scan_##name (const T * data, unsigned int start, unsigned int end, int op, const T * operands, \\
+    unsigned int operand_count, unsigned int * out, unsigned int capacity, unsigned int * next) \\
+{ \\
+  unsigned int i = end, written = 0; \\
+  T a = operand_count > 0 ? operands[0] : 0; \\
+  T b = operand_count > 1 ? operands[1] : 0; \\
+  switch (op) \\
+  { \\
+    case OP_EQ: SCAN_MATCH (data[i] == a) break; \\
+    case OP_NE: SCAN_MATCH (data[i] != a) break; \\
+    case OP_LT: SCAN_MATCH (data[i] < a) break; \\
+    case OP_LE: SCAN_MATCH (data[i] <= a) break; \\
+    case OP_GT: SCAN_MATCH (data[i] > a) break; \\
+    case OP_GE: SCAN_MATCH (data[i] >= a) break; \\
+    case OP_BETWEEN: SCAN_MATCH (data[i] >= a && data[i] <= b) break; \\
+    case OP_IN: SCAN_MATCH (contains_##name (data[i], operands, operand_count)) break; \\
+  } \\
+  *next = i; \\
+  return written; \\
+} \\
+\\
+void \\
+stats_##name (const T * data, unsigned int count, unsigned char * result) \\
+{ \\
+  unsigned int i, n = 0, min_index = 0, max_index = 0; \\
+  ACC sum = 0; \\
+  T min = 0, max = 0; \\
+  for (i = 0; i != count; i++) \\
+  { \\
+    T v = data[i]; \\
+    if (v != v) \\
+      continue; \\
+    if (n == 0 || v < min) \\
+    { \\
+      min = v; \\
+      min_index = i; \\
+    } \\
+    if (n == 0 || v > max) \\
+    { \\
+      max = v; \\
+      max_index = i; \\
+    } \\
+    sum += v; \\
+    n++; \\
+  } \\
+  *(ACC *) result = sum; \\
+  *(T *) (result + 8) = min; \\
+  *(T *) (result + 16) = max; \\
+  *(unsigned int *) (result + 24) = min_index; \\
+  *(unsigned int *) (result + 28) = max_index; \\
+  *(unsigned int *) (result + 32) = n; \\
+}
+
+DEFINE_KERNELS (i8, signed char, long long)
+DEFINE_KERNELS (u8, unsigned char, long long)
+DEFINE_KERNELS (i16, short, long long)
+DEFINE_KERNELS (u16, unsigned short, long long)
+DEFINE_KERNELS (i32, int, long long)
+DEFINE_KERNELS (u32, unsigned int, long long)
+DEFINE_KERNELS (i64, long long, long long)
+DEFINE_KERNELS (u64, unsigned long long, unsigned long long)
+DEFINE_KERNELS (f32, float, double)
+DEFINE_KERNELS (f64, double, double)
+`;
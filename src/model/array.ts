@@ -2,6 +2,15 @@ import type { MonoApi } from "../runtime/api";
 import { lazy } from "../utils/cache";
 import { MonoErrorCodes, raise } from "../utils/errors";
 import { pointerIsNull } from "../utils/memory";
+import {
+  countArrayMatches,
+  findArrayIndices,
+  findArrayPattern,
+  summarizeArray,
+  type ArrayScanOptions,
+  type ArrayScanPredicate,
+  type ArrayScanSummary,
+} from "./array-scan";
 import { MonoClass } from "./class";
 import { MonoObject } from "./object";
 import { MonoTypeKind, isNumericKind } from "./type";
@@ -83,6 +92,30 @@ export interface MonoArraySummary {
   isStringArray: boolean;
 }
 
+/**
+ * One dimension of a managed array: `length` elements starting at `lowerBound`.
+ */
+export interface MonoArrayBound {
+  length: number;
+  lowerBound: number;
+}
+
+/**
+ * Typed array produced by {@link MonoArray.getRegion}, chosen from the element type.
+ * Non-primitive value types are returned as raw bytes.
+ */
+export type MonoArrayRegion =
+  | Int8Array
+  | Uint8Array
+  | Int16Array
+  | Uint16Array
+  | Int32Array
+  | Uint32Array
+  | BigInt64Array
+  | BigUint64Array
+  | Float32Array
+  | Float64Array;
+
 /**
  * Type guards for MonoArray operations
  */
@@ -246,6 +279,264 @@ export class MonoArray<T = unknown> extends MonoObject implements Iterable<T> {
     return this.native.mono_array_addr_with_size(this.pointer, this.elementSize, index);
   }
 
+  // ===== MULTI-DIMENSIONAL ACCESS =====
+
+  /**
+   * Number of dimensions (1 for vectors such as `int[]`, 2 for `int[,]`, ...).
+   */
+  @lazy
+  get rank(): number {
+    const rank = Number(this.native.mono_class_get_rank(this.class.pointer));
+    return rank > 0 ? rank : 1;
+  }
+
+  /**
+   * Length and lower bound of every dimension.
+   *
+   * Read from the array's bounds block; when its layout cannot be confirmed the
+   * values come from `System.Array.GetLength` / `GetLowerBound` instead.
+   */
+  @lazy
+  get bounds(): readonly MonoArrayBound[] {
+    const boundsPtr = this.pointer.add(Process.pointerSize * 2).readPointer();
+    if (this.rank === 1 && pointerIsNull(boundsPtr)) {
+      return [{ length: this.length, lowerBound: 0 }];
+    }
+    return readArrayBounds(boundsPtr, this.rank, this.length, boundsStride(this.api)) ?? this.readBoundsManaged();
+  }
+
+  /**
+   * Length of every dimension.
+   */
+  get dimensions(): number[] {
+    return this.bounds.map(bound => bound.length);
+  }
+
+  /**
+   * Row-major element index for a multi-dimensional index.
+   * Indices follow C# semantics and include the lower bounds.
+   * @throws {MonoError} INVALID_ARGUMENT when the rank or any index is out of range
+   */
+  flatIndex(indices: readonly number[]): number {
+    const bounds = this.bounds;
+    this.assertRank(indices);
+    let flat = 0;
+    for (let d = 0; d < bounds.length; d++) {
+      const offset = indices[d] - bounds[d].lowerBound;
+      if (!Number.isInteger(offset) || offset < 0 || offset >= bounds[d].length) {
+        raise(
+          MonoErrorCodes.INVALID_ARGUMENT,
+          `Index ${indices[d]} is out of bounds for dimension ${d} of ${this.toString()}`,
+          `Valid range: ${bounds[d].lowerBound}..${bounds[d].lowerBound + bounds[d].length - 1}`,
+        );
+      }
+      flat = flat * bounds[d].length + offset;
+    }
+    return flat;
+  }
+
+  /**
+   * Get the address of the element at a multi-dimensional index.
+   */
+  getElementAddressAt(indices: readonly number[]): NativePointer {
+    return this.getElementAddress(this.flatIndex(indices));
+  }
+
+  /**
+   * Copy a rectangular region of a primitive or value-type array into a typed array.
+   *
+   * Contiguous rows are copied with one memory read each; when the region spans
+   * whole trailing dimensions they are merged into a single read.
+   *
+   * @param lo Inclusive start index per dimension (defaults to the lower bounds)
+   * @param hi Exclusive end index per dimension (defaults to the upper bounds)
+   * @returns Elements in row-major order; raw bytes for non-primitive value types
+   * @throws {MonoError} TYPE_MISMATCH for reference-type elements
+   *
+   * @example
+   * ```typescript
+   * const grid = Mono.array.wrap<number>(tilesPtr); // int[,]
+   * const [rows, cols] = grid.dimensions;
+   * const tiles = grid.getRegion([0, 0], [rows, cols]) as Int32Array;
+   * ```
+   */
+  getRegion(lo?: readonly number[], hi?: readonly number[]): MonoArrayRegion {
+    const bounds = this.bounds;
+    const rank = bounds.length;
+    const start = lo ?? bounds.map(bound => bound.lowerBound);
+    const end = hi ?? bounds.map(bound => bound.lowerBound + bound.length);
+    this.assertRank(start);
+    this.assertRank(end);
+
+    const extents: number[] = new Array(rank);
+    const offsets: number[] = new Array(rank);
+    let total = 1;
+    for (let d = 0; d < rank; d++) {
+      offsets[d] = start[d] - bounds[d].lowerBound;
+      extents[d] = end[d] - start[d];
+      if (offsets[d] < 0 || extents[d] < 0 || offsets[d] + extents[d] > bounds[d].length) {
+        raise(
+          MonoErrorCodes.INVALID_ARGUMENT,
+          `Region [${start[d]}, ${end[d]}) is out of bounds for dimension ${d} of ${this.toString()}`,
+          `Valid range: ${bounds[d].lowerBound}..${bounds[d].lowerBound + bounds[d].length}`,
+        );
+      }
+      total *= extents[d];
+    }
+
+    const elementSize = this.elementSize;
+    const region = this.createRegion(total);
+    if (total === 0) {
+      return region;
+    }
+
+    // Merge trailing dimensions the region covers entirely into one run
+    let split = rank - 1;
+    let run = extents[split];
+    while (split > 0 && extents[split] === bounds[split].length) {
+      split--;
+      run *= extents[split];
+    }
+
+    const out = new Uint8Array(region.buffer);
+    const base = this.getElementAddress(0);
+    const runBytes = run * elementSize;
+    const counters = new Array<number>(split).fill(0);
+    for (let written = 0; written < out.length; written += runBytes) {
+      let flat = 0;
+      for (let d = 0; d < rank; d++) {
+        const index = offsets[d] + (d < split ? counters[d] : 0);
+        flat = flat * bounds[d].length + index;
+      }
+      out.set(new Uint8Array(base.add(flat * elementSize).readByteArray(runBytes)!), written);
+
+      for (let d = split - 1; d >= 0; d--) {
+        if (++counters[d] < extents[d]) {
+          break;
+        }
+        counters[d] = 0;
+      }
+    }
+    return region;
+  }
+
+  // ===== NATIVE SCANS =====
+
+  /**
+   * Flat indices of primitive elements matching a predicate, scanned natively.
+   *
+   * @example
+   * ```typescript
+   * const hot = heatMap.findIndices({ op: "gt", value: 0.9 });
+   * const firstEnemy = tiles.findIndices({ op: "in", values: [7, 8, 9] }, { limit: 1 })[0];
+   * ```
+   */
+  findIndices(predicate: ArrayScanPredicate, options?: ArrayScanOptions): Uint32Array {
+    return findArrayIndices(this, predicate, options);
+  }
+
+  /**
+   * Count primitive elements matching a predicate, scanned natively.
+   */
+  countMatches(predicate: ArrayScanPredicate, options?: ArrayScanOptions): number {
+    return countArrayMatches(this, predicate, options);
+  }
+
+  /**
+   * Count, sum, minimum and maximum of primitive elements in one native pass.
+   */
+  summarize(options?: ArrayScanOptions): ArrayScanSummary {
+    return summarizeArray(this, options);
+  }
+
+  /**
+   * Byte offsets (relative to the first element) where a byte pattern occurs.
+   * @param pattern Frida pattern string such as `"de ad ?? ef"`, or raw bytes
+   */
+  findPattern(pattern: string | ArrayLike<number>, options?: ArrayScanOptions): number[] {
+    return findArrayPattern(this, pattern, options);
+  }
+
+  private assertRank(indices: readonly number[]): void {
+    if (indices.length !== this.rank) {
+      raise(
+        MonoErrorCodes.INVALID_ARGUMENT,
+        `Expected ${this.rank} indices for ${this.toString()}, got ${indices.length}`,
+      );
+    }
+  }
+
+  private createRegion(count: number): MonoArrayRegion {
+    const type = this.elementClass.type;
+    const kind = this.resolveElementKind();
+    switch (kind) {
+      case MonoTypeKind.I1:
+        return new Int8Array(count);
+      case MonoTypeKind.U1:
+      case MonoTypeKind.Boolean:
+        return new Uint8Array(count);
+      case MonoTypeKind.I2:
+        return new Int16Array(count);
+      case MonoTypeKind.U2:
+      case MonoTypeKind.Char:
+        return new Uint16Array(count);
+      case MonoTypeKind.I4:
+        return new Int32Array(count);
+      case MonoTypeKind.U4:
+        return new Uint32Array(count);
+      case MonoTypeKind.I8:
+        return new BigInt64Array(count);
+      case MonoTypeKind.U8:
+        return new BigUint64Array(count);
+      case MonoTypeKind.R4:
+        return new Float32Array(count);
+      case MonoTypeKind.R8:
+        return new Float64Array(count);
+      case MonoTypeKind.Int:
+      case MonoTypeKind.Pointer:
+        return Process.pointerSize === 8 ? new BigInt64Array(count) : new Int32Array(count);
+      case MonoTypeKind.UInt:
+        return Process.pointerSize === 8 ? new BigUint64Array(count) : new Uint32Array(count);
+    }
+    if (type.valueType) {
+      return new Uint8Array(count * this.elementSize);
+    }
+    raise(
+      MonoErrorCodes.TYPE_MISMATCH,
+      `Cannot copy a region of reference-type array ${this.toString()}`,
+      "Use getElementAddressAt() or getTyped(flatIndex(...)) for object elements",
+    );
+  }
+
+  private readBoundsManaged(): MonoArrayBound[] {
+    const arrayClass = this.native.mono_get_array_class();
+    const getLength = this.native.mono_class_get_method_from_name(
+      arrayClass,
+      this.api.allocUtf8StringCached("GetLength"),
+      1,
+    );
+    const getLowerBound = this.native.mono_class_get_method_from_name(
+      arrayClass,
+      this.api.allocUtf8StringCached("GetLowerBound"),
+      1,
+    );
+    if (pointerIsNull(getLength) || pointerIsNull(getLowerBound)) {
+      raise(MonoErrorCodes.METHOD_NOT_FOUND, "Cannot find Array.GetLength / Array.GetLowerBound");
+    }
+
+    const dimension = Memory.alloc(4);
+    const invoke = (method: NativePointer): number => {
+      const boxed = this.api.runtimeInvoke(method, this.pointer, [dimension]);
+      return (this.native.mono_object_unbox(boxed) as NativePointer).readS32();
+    };
+    const result: MonoArrayBound[] = [];
+    for (let d = 0; d < this.rank; d++) {
+      dimension.writeS32(d);
+      result.push({ length: invoke(getLength), lowerBound: invoke(getLowerBound) });
+    }
+    return result;
+  }
+
   private resolveElementKind(): MonoTypeKind {
     const type = this.elementClass.type;
     if (type.kind === MonoTypeKind.Enum) {
@@ -1699,6 +1990,55 @@ export class MonoArray<T = unknown> extends MonoObject implements Iterable<T> {
     return new MonoArray<T>(api, arrayPtr);
   }
 
+  /**
+   * Create a multi-dimensional array such as `int[,]`.
+   * @param api MonoApi instance
+   * @param elementClass The element type class
+   * @param lengths Length of each dimension
+   * @param lowerBounds Lower bound of each dimension (defaults to 0)
+   * @returns A new MonoArray of rank `lengths.length`
+   */
+  static newMultiDimensional<T = unknown>(
+    api: MonoApi,
+    elementClass: MonoClass,
+    lengths: readonly number[],
+    lowerBounds?: readonly number[],
+  ): MonoArray<T> {
+    const rank = lengths.length;
+    if (rank === 0 || (lowerBounds && lowerBounds.length !== rank)) {
+      raise(
+        MonoErrorCodes.INVALID_ARGUMENT,
+        "Multi-dimensional arrays need one length (and lower bound) per dimension",
+      );
+    }
+
+    const domain = api.getRootDomain();
+    const unityFactory = rank === 2 ? "mono_unity_array_new_2d" : rank === 3 ? "mono_unity_array_new_3d" : null;
+    if (!lowerBounds && unityFactory && api.hasExport(unityFactory)) {
+      const arrayPtr =
+        rank === 2
+          ? api.native.mono_unity_array_new_2d(domain, elementClass.pointer, lengths[0], lengths[1])
+          : api.native.mono_unity_array_new_3d(domain, elementClass.pointer, lengths[0], lengths[1], lengths[2]);
+      return new MonoArray<T>(api, arrayPtr);
+    }
+
+    const ps = Process.pointerSize;
+    const lengthsPtr = Memory.alloc(ps * rank);
+    const lowerBoundsPtr = Memory.alloc(ps * rank);
+    for (let d = 0; d < rank; d++) {
+      lengthsPtr.add(d * ps).writePointer(ptr(lengths[d]));
+      const lowerBound = lowerBounds?.[d] ?? 0;
+      if (ps === 8) {
+        lowerBoundsPtr.add(d * ps).writeS64(lowerBound);
+      } else {
+        lowerBoundsPtr.add(d * ps).writeS32(lowerBound);
+      }
+    }
+    const arrayClass = api.native.mono_array_class_get(elementClass.pointer, rank);
+    const arrayPtr = api.native.mono_array_new_full(domain, arrayClass, lengthsPtr, lowerBoundsPtr);
+    return new MonoArray<T>(api, arrayPtr);
+  }
+
   /**
    * Create numeric array
    */
@@ -1783,7 +2123,8 @@ export class MonoArray<T = unknown> extends MonoObject implements Iterable<T> {
    * ```
    */
   override toString(): string {
-    return `${this.elementClass.fullName}[${this.length}]`;
+    const sizes = this.rank > 1 ? this.dimensions.join(",") : this.length;
+    return `${this.elementClass.fullName}[${sizes}]`;
   }
 }
 
@@ -1793,6 +2134,99 @@ if (!getArrayWrapper()) {
 
 // ===== UTILITY FUNCTIONS =====
 
+/** `MonoArrayBounds` entry size per runtime, calibrated once; null when calibration failed. */
+const boundsStrides = new WeakMap<MonoApi, number | null>();
+
+/**
+ * Size of one `MonoArrayBounds` entry. `mono_array_size_t` is 32-bit on older
+ * runtimes and pointer-sized on newer ones. On 64-bit the layout is detected
+ * once from an `int[,]` created with known lengths and lower bounds.
+ */
+function boundsStride(api: MonoApi): number | null {
+  if (Process.pointerSize !== 8) {
+    return 8;
+  }
+  let stride = boundsStrides.get(api);
+  if (stride === undefined) {
+    stride = calibrateBoundsStride(api);
+    boundsStrides.set(api, stride);
+  }
+  return stride;
+}
+
+function calibrateBoundsStride(api: MonoApi): number | null {
+  if (!api.hasExport("mono_array_new_full") || !api.hasExport("mono_get_int32_class")) {
+    return null;
+  }
+  const lengths = [3, 5];
+  const lowerBounds = [7, -2];
+  try {
+    const lengthsPtr = Memory.alloc(16);
+    const lowerBoundsPtr = Memory.alloc(16);
+    for (let d = 0; d < 2; d++) {
+      lengthsPtr.add(d * 8).writeU64(lengths[d]);
+      lowerBoundsPtr.add(d * 8).writeS64(lowerBounds[d]);
+    }
+    const arrayClass = api.native.mono_array_class_get(api.native.mono_get_int32_class(), 2);
+    const arrayPtr = api.native.mono_array_new_full(api.getRootDomain(), arrayClass, lengthsPtr, lowerBoundsPtr);
+    const boundsPtr = arrayPtr.add(Process.pointerSize * 2).readPointer();
+    for (const stride of [16, 8]) {
+      const bounds = decodeBounds(boundsPtr, 2, stride);
+      if (bounds.every((bound, d) => bound.length === lengths[d] && bound.lowerBound === lowerBounds[d])) {
+        return stride;
+      }
+    }
+  } catch {
+    // Fall back to checking both layouts per array
+  }
+  return null;
+}
+
+/**
+ * Decode a `MonoArrayBounds` block and check that its lengths multiply to the
+ * array length. Without a calibrated stride both 64-bit layouts are tried, and
+ * the block is rejected when both fit but disagree: a rank-1 array with a
+ * 32-bit layout and lower bound 0 reads the same length under either.
+ */
+function readArrayBounds(
+  boundsPtr: NativePointer,
+  rank: number,
+  length: number,
+  stride: number | null,
+): MonoArrayBound[] | null {
+  if (pointerIsNull(boundsPtr)) {
+    return null;
+  }
+  const matches: MonoArrayBound[][] = [];
+  for (const candidate of stride !== null ? [stride] : [16, 8]) {
+    const bounds = decodeBounds(boundsPtr, rank, candidate);
+    if (bounds.reduce((product, bound) => product * bound.length, 1) === length) {
+      matches.push(bounds);
+    }
+  }
+  if (matches.length === 2 && !sameBounds(matches[0], matches[1])) {
+    return null;
+  }
+  return matches[0] ?? null;
+}
+
+function decodeBounds(boundsPtr: NativePointer, rank: number, stride: number): MonoArrayBound[] {
+  const wide = stride === 16;
+  const result: MonoArrayBound[] = [];
+  for (let d = 0; d < rank; d++) {
+    const entry = boundsPtr.add(d * stride);
+    const dimLength = wide ? entry.readU64().toNumber() : entry.readU32();
+    // The lower bound is int32 or intptr; its low 32 bits are enough either way
+    const lowerBound = entry.add(wide ? 8 : 4).readS32();
+    result.push({ length: dimLength, lowerBound });
+  }
+  return result;
+}
+
+function sameBounds(a: readonly MonoArrayBound[], b: readonly MonoArrayBound[]): boolean {
+  return a.every((bound, d) => bound.length === b[d].length && bound.lowerBound === b[d].lowerBound);
+}
+
 /**
  * Create a new MonoArray
  */
@@ -14,6 +14,7 @@ import { MonoHandle } from "./handle";
 import { MonoImage } from "./image";
 import { MonoMethod } from "./method";
 import { MonoObject } from "./object";
+import { ObjectFactory, type ConstructorSignature } from "./object-factory";
 import { MonoProperty } from "./property";
 import { MonoType, MonoTypeSummary } from "./type";
 
@@ -61,6 +62,7 @@ const TYPE_DESCRIBED_FLAGS: Record<string, number> = {
 export class MonoClass extends MonoHandle {
   #initialized = false;
   #methodCache: Map<string, MonoMethod | null> | null = null;
+  #methodCacheGeneration = 0;
 
   // ===== CORE PROPERTIES =====
 
@@ -173,7 +175,7 @@ export class MonoClass extends MonoHandle {
   @lazy
   get isDelegate(): boolean {
     // NOTE: mono_class_is_delegate is only available in mono-2.0-bdwgc.dll
-    if (this.api.hasExport("mono_class_is_delegate")) {
+    if (this.api.strategies.classes.isDelegate) {
       return (this.native.mono_class_is_delegate(this.pointer) as number) !== 0;
     }
     // Fallback: Check if this class inherits from System.Delegate
@@ -285,9 +287,11 @@ export class MonoClass extends MonoHandle {
     // Build cache key
     const cacheKey = `${name}:${paramCount}`;
 
-    // Initialize cache lazily
-    if (!this.#methodCache) {
+    // Initialize cache lazily; drop it when the class's image scope was invalidated
+    const generation = this.api.cacheScopes.generation(this.image.pointer);
+    if (!this.#methodCache || this.#methodCacheGeneration !== generation) {
       this.#methodCache = new Map();
+      this.#methodCacheGeneration = generation;
     }
 
     // Check cache first
@@ -295,9 +299,17 @@ export class MonoClass extends MonoHandle {
       return this.#methodCache.get(cacheKey) ?? null;
     }
 
-    // Perform actual lookup
-    const namePtr = this.api.allocUtf8StringCached(name);
-    const methodPtr = this.native.mono_class_get_method_from_name(this.pointer, namePtr, paramCount);
+    // Perform actual lookup, preferring a token recorded by the session.
+    // Tokens do not carry a generic context, so constructed generic classes always use the name lookup.
+    const session = this.api.session && !this.isConstructedGenericType ? this.api.session : null;
+    let methodPtr = session?.lookupMethod(this.pointer, this.fullName, name, paramCount) ?? null;
+    if (!methodPtr) {
+      const namePtr = this.api.allocUtf8StringCached(name);
+      methodPtr = this.native.mono_class_get_method_from_name(this.pointer, namePtr, paramCount) as NativePointer;
+      if (session && !pointerIsNull(methodPtr)) {
+        session.recordMethod(this.pointer, this.fullName, name, paramCount, methodPtr);
+      }
+    }
     const result = pointerIsNull(methodPtr) ? null : new MonoMethod(this.api, methodPtr);
 
     // Cache result
@@ -515,7 +527,7 @@ export class MonoClass extends MonoHandle {
    */
   implementsInterface(iface: MonoClass): boolean {
     // NOTE: mono_class_implements_interface is only available in mono-2.0-bdwgc.dll
-    if (this.api.hasExport("mono_class_implements_interface")) {
+    if (this.api.strategies.classes.implementsInterface) {
       return (this.native.mono_class_implements_interface(this.pointer, iface.pointer) as number) !== 0;
     }
     // Fallback: Check interfaces manually
@@ -632,6 +644,29 @@ export class MonoClass extends MonoHandle {
     }
   }
 
+  /**
+   * Create a reusable allocator for this class.
+   *
+   * The factory resolves the vtable and constructor once and marshals arguments
+   * into a preallocated argument vector, so it is much cheaper than repeated
+   * `newObject()` calls when creating many instances.
+   *
+   * @param signature Constructor selector: parameter count, parameter type names,
+   *                  or a specific constructor (default: parameterless)
+   * @returns ObjectFactory bound to the root domain
+   *
+   * @example
+   * ```typescript
+   * const factory = klass.createFactory(["System.Int32", "System.String"]);
+   * const obj = factory.new([42, "hello"]);
+   * const objs = factory.newMany(100, i => [i, `item${i}`]);
+   * ```
+   */
+  createFactory(signature?: ConstructorSignature): ObjectFactory {
+    this.ensureInitialized();
+    return new ObjectFactory(this.api, this, signature);
+  }
+
   /**
    * Find a constructor with the specified number of parameters.
    *
@@ -777,7 +812,7 @@ export class MonoClass extends MonoHandle {
   get genericArgumentCount(): number {
     // For constructed generic types, try Unity API if available
     if (this.isConstructedGenericType) {
-      if (this.api.hasExport("mono_unity_class_get_generic_argument_count")) {
+      if (this.api.strategies.generics.unityArgumentCount) {
         try {
           const count = this.native.mono_unity_class_get_generic_argument_count(this.pointer);
           return Number(count);
@@ -802,7 +837,7 @@ export class MonoClass extends MonoHandle {
   @lazy
   get genericArguments(): MonoClass[] {
     // This requires Unity API to enumerate actual type arguments
-    if (!this.api.hasExport("mono_unity_class_get_generic_argument_at")) {
+    if (!this.api.strategies.generics.unityArgumentAt) {
       return [];
     }
 
@@ -881,7 +916,7 @@ export class MonoClass extends MonoHandle {
     }
 
     // Try mono_reflection_type_from_name approach (most reliable)
-    if (this.api.hasExport("mono_reflection_type_from_name") && this.api.hasExport("mono_class_from_mono_type")) {
+    if (this.api.strategies.generics.reflectionTypes) {
       const result = this.makeGenericTypeViaReflection(typeArguments);
       if (result) {
         return result;
@@ -404,6 +404,7 @@ export class MonoDelegate extends MonoObject {
       return this.api.runtimeInvoke(this.invokeMethod.pointer, this.pointer, prepared);
     } catch (error) {
       if (error instanceof MonoManagedExceptionError && options.throwOnManagedException === false) {
+        error.release();
         return NULL;
       }
       raiseFrom(error);
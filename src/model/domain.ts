@@ -1,5 +1,5 @@
 import type { MonoApi } from "../runtime/api";
-import { lazy } from "../utils/cache";
+import { CacheScoped, lazy, scopedLazy } from "../utils/cache";
 import { MonoErrorCodes, raise } from "../utils/errors";
 import { pointerIsNull } from "../utils/memory";
 import { matchesPattern } from "../utils/pattern";
@@ -9,6 +9,8 @@ import { MonoField } from "./field";
 import { MonoHandle } from "./handle";
 import { MonoMethod } from "./method";
 import { MonoProperty } from "./property";
+import type { MonoType } from "./type";
+import { TypeNameResolver } from "./type-name";
 
 // ===== INTERFACES =====
 
@@ -101,7 +103,7 @@ export interface FindOptions {
  * console.log(domain.describe());
  * ```
  */
-export class MonoDomain extends MonoHandle {
+export class MonoDomain extends MonoHandle implements CacheScoped {
   /** Cached root domain pointer for comparison */
   private static rootDomainPtr: NativePointer | null = null;
 
@@ -388,6 +390,15 @@ export class MonoDomain extends MonoHandle {
     }
   }
 
+  /**
+   * Generation of this domain's cache scope.
+   * Assembly lists and namespace indexes are rebuilt when an assembly loads into
+   * or closes in this domain, or the domain unloads.
+   */
+  get cacheGeneration(): number {
+    return this.api.cacheScopes.generation(this.pointer);
+  }
+
   // ===== ASSEMBLY ACCESS =====
 
   /**
@@ -425,10 +436,14 @@ export class MonoDomain extends MonoHandle {
    * assemblies.forEach(asm => console.log(asm.name));
    * ```
    */
-  @lazy
+  @scopedLazy
   get assemblies(): MonoAssembly[] {
     const assemblies: MonoAssembly[] = [];
-    this.enumerateAssemblies(assembly => assemblies.push(assembly));
+    const scopes = this.api.cacheScopes;
+    this.enumerateAssemblies(assembly => {
+      assemblies.push(assembly);
+      scopes.noteImage(this.pointer, assembly.image.pointer);
+    });
     return assemblies;
   }
 
@@ -597,9 +612,17 @@ export class MonoDomain extends MonoHandle {
       }
     }
 
+    // Token recorded by this or a restored session skips the assembly scan
+    const session = this.api.session;
+    const recorded = session?.lookupClass(trimmed);
+    if (recorded) {
+      return new MonoClass(this.api, recorded);
+    }
+
     for (const assembly of this.assemblies) {
       const klass = assembly.image.tryClass(trimmed);
       if (klass) {
+        session?.recordClass(trimmed, klass.pointer);
         return klass;
       }
     }
@@ -640,6 +663,37 @@ export class MonoDomain extends MonoHandle {
     );
   }
 
+  /**
+   * Resolve a CLR type name, including generic instantiations, arrays, pointers and by-ref types.
+   *
+   * @param name Type name, e.g. "System.Collections.Generic.List`1[[Game.Item, Assembly-CSharp]]" or "Game.Grid[,]"
+   * @returns The type, or null if it cannot be resolved
+   *
+   * @remarks
+   * Uses `mono_reflection_type_from_name` and falls back to parsing the name and
+   * building the type from its parts. Results, including misses, are cached per
+   * runtime until an assembly loads or unloads.
+   *
+   * @example
+   * ```typescript
+   * const listOfString = domain.resolveType("System.Collections.Generic.List`1[[System.String, mscorlib]]");
+   * const grid = domain.resolveType("System.Int32[,]")?.class;
+   * ```
+   */
+  resolveType(name: string): MonoType | null {
+    return TypeNameResolver.for(this.api).resolve(this, name);
+  }
+
+  /**
+   * Resolve many type names at once, attaching to the runtime only once.
+   *
+   * @param names Type names; duplicates are resolved once
+   * @returns Map from each name to its type, or null if it cannot be resolved
+   */
+  resolveTypes(names: Iterable<string>): Map<string, MonoType | null> {
+    return TypeNameResolver.for(this.api).resolveMany(this, names);
+  }
+
   /**
    * Get all root namespaces in this domain.
    *
@@ -655,7 +709,7 @@ export class MonoDomain extends MonoHandle {
    * // ["System", "UnityEngine", "Game", ...]
    * ```
    */
-  @lazy
+  @scopedLazy
   get rootNamespaces(): string[] {
     const namespaces = new Set<string>();
 
@@ -683,7 +737,7 @@ export class MonoDomain extends MonoHandle {
    * // ["System", "System.Collections", "System.Collections.Generic", ...]
    * ```
    */
-  @lazy
+  @scopedLazy
   get allNamespaces(): string[] {
     const namespaces = new Set<string>();
 
@@ -833,7 +887,12 @@ export class MonoDomain extends MonoHandle {
     try {
       // Attempt to close the assembly
       // Note: This may not actually unload the assembly from memory in most Mono runtimes
+      const image = targetAssembly.image.pointer;
       this.native.mono_assembly_close(targetAssembly.pointer);
+      if (!this.api.cacheScopes.isTracking) {
+        this.api.cacheScopes.invalidateImage(image, "assembly-close");
+        this.api.cacheScopes.invalidateDomain(this.pointer, "assembly-close");
+      }
 
       return {
         success: true,
@@ -1070,7 +1129,7 @@ export class MonoDomain extends MonoHandle {
    * console.log(`Domain has ${domain.getTotalClassCount()} classes`);
    * ```
    */
-  @lazy get totalClassCount(): number {
+  @scopedLazy get totalClassCount(): number {
     let count = 0;
     for (const assembly of this.assemblies) {
       count += assembly.image.classCount;
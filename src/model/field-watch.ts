@@ -0,0 +1,480 @@
+/**
+ * Field access watchpoints.
+ *
+ * Watches the storage of static fields (resolved through
+ * `mono_vtable_get_static_field_data`) and of instance fields on specific
+ * objects with Frida's `MemoryAccessMonitor`. Faulting instruction addresses
+ * are attributed to managed methods through a {@link JitRangeIndex}, and
+ * notifications are delivered in batches outside the fault handler.
+ *
+ * `MemoryAccessMonitor` protects whole pages and reports only the first
+ * access to each page, so the monitor is re-armed after every notification.
+ * Accesses that land between a fault and the re-arm are not reported.
+ *
+ * @module model/field-watch
+ */
+
+import type { MonoApi } from "../runtime/api";
+import { GCHandlePool } from "../runtime/gchandle";
+import { MonoErrorCodes, raise } from "../utils/errors";
+import { Logger } from "../utils/log";
+import { pointerIsNull } from "../utils/memory";
+import type { MonoField } from "./field";
+import { JitRangeIndex } from "./jit-ranges";
+import type { MonoMethod } from "./method";
+import { MonoObject } from "./object";
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+/** Kind of access reported by a watchpoint. */
+export type FieldAccessOperation = "read" | "write";
+
+/** A single observed field access. */
+export interface FieldAccessEvent {
+  field: MonoField;
+  operation: FieldAccessOperation;
+  /** Watched object, or NULL for static fields */
+  instance: NativePointer;
+  /** Address of the field storage */
+  address: NativePointer;
+  /** Instruction that performed the access */
+  from: NativePointer;
+  /** Managed method containing `from`, or null for native code */
+  method: MonoMethod | null;
+  /** Offset of `from` within the compiled method, or -1 */
+  nativeOffset: number;
+  /** Copy of the field bytes taken before the access completed */
+  oldValue: NativePointer;
+  /** Live field storage (the new value once a write has completed) */
+  newValue: NativePointer;
+  threadId: number;
+  timestamp: number;
+}
+
+/** Watchpoint callbacks. Structurally compatible with `FieldAccessCallbacks`. */
+export interface FieldWatchCallbacks {
+  /** Receives each batch of accesses in the order they occurred */
+  onAccess?: (events: FieldAccessEvent[]) => void;
+  onRead?: (instance: NativePointer, value: NativePointer) => void;
+  onWrite?: (instance: NativePointer, oldValue: NativePointer, newValue: NativePointer) => void;
+}
+
+/** Options for {@link FieldWatchManager.watch}. */
+export interface FieldWatchOptions {
+  /** Objects whose instance field is watched. Required for instance fields. */
+  instances?: ReadonlyArray<MonoObject | NativePointer>;
+  /** Operations to report. Default: `["write"]` */
+  operations?: readonly FieldAccessOperation[];
+  /**
+   * Pin watched objects with GC handles so a moving collector cannot relocate
+   * them away from the protected pages. Default: true
+   */
+  pin?: boolean;
+}
+
+/** Watch manager tuning. */
+export interface FieldWatchConfig {
+  /** Delay before a batch is delivered and the monitor re-armed */
+  flushDelayMs: number;
+  /** Pending events kept between flushes; further accesses are dropped */
+  maxPendingEvents: number;
+}
+
+export const DEFAULT_FIELD_WATCH_CONFIG: FieldWatchConfig = {
+  flushDelayMs: 0,
+  maxPendingEvents: 1024,
+};
+
+/** Watch manager counters. */
+export interface FieldWatchStats {
+  watches: number;
+  ranges: number;
+  /** Page faults seen, including accesses to unwatched bytes on a watched page */
+  faults: number;
+  delivered: number;
+  dropped: number;
+}
+
+interface WatchTarget {
+  watch: FieldWatch;
+  instance: NativePointer;
+  base: NativePointer;
+  size: number;
+}
+
+interface FieldWatch {
+  id: number;
+  field: MonoField;
+  operations: ReadonlySet<FieldAccessOperation>;
+  callbacks: FieldWatchCallbacks;
+  targets: WatchTarget[];
+  pool: GCHandlePool | null;
+}
+
+interface PendingAccess {
+  target: WatchTarget;
+  operation: FieldAccessOperation;
+  from: NativePointer;
+  oldValue: NativePointer;
+  threadId: number;
+  timestamp: number;
+}
+
+const watchLogger = Logger.withTag("FieldWatch");
+
+/** `MemoryAccessMonitor` is process-wide; only one manager may drive it. */
+let monitorOwner: FieldWatchManager | null = null;
+
+// =============================================================================
+// FIELD WATCH MANAGER
+// =============================================================================
+
+/**
+ * Owns the process-wide `MemoryAccessMonitor` and multiplexes field watches onto it.
+ *
+ * @example
+ * ```typescript
+ * const watcher = new FieldWatchManager(api);
+ * const stop = watcher.watch(healthField, {
+ *   onAccess: events => events.forEach(e => console.log(`${e.method?.fullName} wrote health`)),
+ * }, { instances: [player] });
+ * ```
+ */
+export class FieldWatchManager {
+  private readonly config: FieldWatchConfig;
+  private readonly watches = new Map<number, FieldWatch>();
+  private armed: WatchTarget[] = [];
+  private pending: PendingAccess[] = [];
+  private timer: ReturnType<typeof setTimeout> | null = null;
+  private nextId = 1;
+  /** Nesting depth of {@link batch}; re-arming waits until it drops to 0. */
+  private batchDepth = 0;
+  private rearmPending = false;
+  private faults = 0;
+  private delivered = 0;
+  private dropped = 0;
+  private disposed = false;
+
+  /**
+   * @param api Low-level Mono API
+   * @param jit Index used to attribute faulting instructions; shared with other tools when provided
+   * @param config Optional tuning
+   */
+  constructor(
+    private readonly api: MonoApi,
+    readonly jit: JitRangeIndex = new JitRangeIndex(api),
+    config?: Partial<FieldWatchConfig>,
+  ) {
+    this.config = { ...DEFAULT_FIELD_WATCH_CONFIG, ...config };
+  }
+
+  /** Whether `MemoryAccessMonitor` exists in this Frida build. */
+  static get isSupported(): boolean {
+    return typeof MemoryAccessMonitor !== "undefined";
+  }
+
+  /** Number of active watches. */
+  get size(): number {
+    return this.watches.size;
+  }
+
+  /**
+   * Watch accesses to a field.
+   *
+   * @param field Field to watch
+   * @param callbacks Batch and per-access callbacks
+   * @param options Watched instances and operations
+   * @returns Function that removes the watch
+   * @throws {MonoError} NOT_SUPPORTED when the field has no addressable storage
+   *   or the monitor is unavailable; RESOURCE_LIMIT when another manager owns the monitor
+   */
+  watch(field: MonoField, callbacks: FieldWatchCallbacks, options: FieldWatchOptions = {}): () => void {
+    this.ensureNotDisposed();
+    if (!FieldWatchManager.isSupported) {
+      raise(MonoErrorCodes.NOT_SUPPORTED, "MemoryAccessMonitor is not available on this platform");
+    }
+    if (monitorOwner && monitorOwner !== this) {
+      raise(
+        MonoErrorCodes.RESOURCE_LIMIT,
+        "MemoryAccessMonitor is already driven by another FieldWatchManager",
+        "Watch all fields through a single Tracer",
+      );
+    }
+
+    const watch: FieldWatch = {
+      id: this.nextId++,
+      field,
+      operations: new Set(options.operations ?? ["write"]),
+      callbacks,
+      targets: [],
+      pool: null,
+    };
+    const size = Math.max(field.type.valueSize.size, 1);
+
+    if (field.isStatic) {
+      watch.targets.push({ watch, instance: NULL, base: this.staticFieldAddress(field), size });
+    } else {
+      const instances = options.instances ?? [];
+      if (instances.length === 0) {
+        raise(
+          MonoErrorCodes.INVALID_ARGUMENT,
+          `Instance field ${field.parent.name}.${field.name} needs at least one object to watch`,
+          "Pass options.instances",
+          { parameter: "options.instances" },
+        );
+      }
+      if (options.pin ?? true) {
+        watch.pool = new GCHandlePool(this.api);
+      }
+      for (const instance of instances) {
+        const pointer = instance instanceof MonoObject ? instance.pointer : instance;
+        if (pointerIsNull(pointer)) {
+          continue;
+        }
+        watch.pool?.create(pointer, true);
+        watch.targets.push({ watch, instance: pointer, base: pointer.add(field.offset), size });
+      }
+    }
+
+    this.watches.set(watch.id, watch);
+    this.rearm();
+    watchLogger.debug(`Watching ${field.parent.name}.${field.name} (${watch.targets.length} range(s))`);
+
+    return () => this.unwatch(watch.id);
+  }
+
+  /**
+   * Run `fn` with watch changes collected into one monitor update.
+   *
+   * Every watch and unwatch replaces the protected ranges, which disables and
+   * re-enables the process-wide monitor. Inside a batch the ranges are rebuilt
+   * once, when the outermost batch ends.
+   */
+  batch<T>(fn: () => T): T {
+    this.batchDepth++;
+    try {
+      return fn();
+    } finally {
+      this.batchDepth--;
+      if (this.batchDepth === 0 && this.rearmPending) {
+        this.rearm();
+      }
+    }
+  }
+
+  /** Deliver pending events immediately. */
+  flush(): void {
+    if (this.timer !== null) {
+      clearTimeout(this.timer);
+      this.timer = null;
+    }
+    this.rearm();
+
+    const batch = this.pending;
+    if (batch.length === 0) {
+      return;
+    }
+    this.pending = [];
+
+    const grouped = new Map<FieldWatch, FieldAccessEvent[]>();
+    for (const access of batch) {
+      const watch = access.target.watch;
+      if (!this.watches.has(watch.id)) {
+        continue;
+      }
+      let events = grouped.get(watch);
+      if (!events) {
+        events = [];
+        grouped.set(watch, events);
+      }
+      events.push(this.toEvent(access));
+    }
+
+    for (const [watch, events] of grouped) {
+      this.deliver(watch, events);
+    }
+  }
+
+  /** Counters since creation. */
+  getStats(): FieldWatchStats {
+    return {
+      watches: this.watches.size,
+      ranges: this.armed.length,
+      faults: this.faults,
+      delivered: this.delivered,
+      dropped: this.dropped,
+    };
+  }
+
+  /** Remove every watch and release the monitor. */
+  unwatchAll(): void {
+    for (const watch of this.watches.values()) {
+      watch.pool?.dispose();
+    }
+    this.watches.clear();
+    this.pending = [];
+    this.rearm();
+  }
+
+  /** Remove every watch and permanently dispose this manager. */
+  dispose(): void {
+    if (this.disposed) return;
+    this.unwatchAll();
+    if (this.timer !== null) {
+      clearTimeout(this.timer);
+      this.timer = null;
+    }
+    this.disposed = true;
+  }
+
+  // ===== INTERNAL =====
+
+  private unwatch(id: number): void {
+    const watch = this.watches.get(id);
+    if (!watch) {
+      return;
+    }
+    this.watches.delete(id);
+    watch.pool?.dispose();
+    this.rearm();
+  }
+
+  private staticFieldAddress(field: MonoField): NativePointer {
+    if (field.isLiteral) {
+      raise(MonoErrorCodes.NOT_SUPPORTED, `Constant field ${field.parent.name}.${field.name} has no storage to watch`);
+    }
+    if (field.offset < 0) {
+      raise(
+        MonoErrorCodes.NOT_SUPPORTED,
+        `Thread-static field ${field.parent.name}.${field.name} cannot be watched`,
+        "Only fields stored in the vtable's static data can be watched",
+      );
+    }
+    if (!this.api.hasExport("mono_vtable_get_static_field_data")) {
+      raise(MonoErrorCodes.EXPORT_NOT_FOUND, "mono_vtable_get_static_field_data is not exported by this runtime");
+    }
+    const vtable = field.parent.getVTable();
+    const data = this.api.native.mono_vtable_get_static_field_data(vtable) as NativePointer;
+    if (pointerIsNull(data)) {
+      raise(MonoErrorCodes.NOT_SUPPORTED, `Class ${field.parent.fullName} has no static field data`);
+    }
+    return data.add(field.offset);
+  }
+
+  /** Replace the monitored ranges with the current watch targets. */
+  private rearm(): void {
+    if (this.batchDepth > 0) {
+      this.rearmPending = true;
+      return;
+    }
+    this.rearmPending = false;
+    if (monitorOwner === this) {
+      MemoryAccessMonitor.disable();
+      monitorOwner = null;
+    }
+
+    const targets: WatchTarget[] = [];
+    for (const watch of this.watches.values()) {
+      targets.push(...watch.targets);
+    }
+    this.armed = targets;
+    if (targets.length === 0 || this.disposed) {
+      return;
+    }
+
+    MemoryAccessMonitor.enable(
+      targets.map(target => ({ base: target.base, size: target.size })),
+      { onAccess: details => this.onFault(details) },
+    );
+    monitorOwner = this;
+  }
+
+  /** Runs inside the fault handler: record what is needed and defer everything else. */
+  private onFault(details: MemoryAccessDetails): void {
+    this.faults++;
+    const operation = details.operation;
+    if (operation === "read" || operation === "write") {
+      const address = details.address;
+      for (const target of this.armed) {
+        if (
+          address.compare(target.base) >= 0 &&
+          address.compare(target.base.add(target.size)) < 0 &&
+          target.watch.operations.has(operation)
+        ) {
+          this.record(target, operation, details.from);
+        }
+      }
+    }
+    // The page is unprotected now whether or not the access was ours
+    this.schedule();
+  }
+
+  private record(target: WatchTarget, operation: FieldAccessOperation, from: NativePointer): void {
+    if (this.pending.length >= this.config.maxPendingEvents) {
+      this.dropped++;
+      return;
+    }
+    this.pending.push({
+      target,
+      operation,
+      from,
+      oldValue: Memory.dup(target.base, target.size),
+      threadId: Process.getCurrentThreadId(),
+      timestamp: Date.now(),
+    });
+  }
+
+  private schedule(): void {
+    if (this.timer === null) {
+      this.timer = setTimeout(() => {
+        this.timer = null;
+        this.flush();
+      }, this.config.flushDelayMs);
+    }
+  }
+
+  private toEvent(access: PendingAccess): FieldAccessEvent {
+    const target = access.target;
+    const info = this.jit.lookup(access.from);
+    return {
+      field: target.watch.field,
+      operation: access.operation,
+      instance: target.instance,
+      address: target.base,
+      from: access.from,
+      method: info ? info.method : null,
+      nativeOffset: info ? info.nativeOffset : -1,
+      oldValue: access.oldValue,
+      newValue: target.base,
+      threadId: access.threadId,
+      timestamp: access.timestamp,
+    };
+  }
+
+  private deliver(watch: FieldWatch, events: FieldAccessEvent[]): void {
+    const { onAccess, onRead, onWrite } = watch.callbacks;
+    try {
+      if (onAccess) {
+        onAccess(events);
+      }
+      for (const event of events) {
+        if (event.operation === "write" && onWrite) {
+          onWrite(event.instance, event.oldValue, event.newValue);
+        } else if (event.operation === "read" && onRead) {
+          onRead(event.instance, event.newValue);
+        }
+      }
+    } catch (error) {
+      watchLogger.warn(`Field watch callback for ${watch.field.name} threw: ${error}`);
+    }
+    this.delivered += events.length;
+  }
+
+  private ensureNotDisposed(): void {
+    if (this.disposed) {
+      raise(MonoErrorCodes.DISPOSED, "FieldWatchManager has been disposed", "Create a new FieldWatchManager");
+    }
+  }
+}
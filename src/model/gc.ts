@@ -531,14 +531,18 @@ export class GarbageCollector {
   /**
    * Disposes this GarbageCollector and releases all managed handles.
    * The instance cannot be used after disposal.
+   *
+   * @returns Number of handles freed by the disposal
    */
-  dispose(): void {
-    if (this.disposed) return;
+  dispose(): number {
+    if (this.disposed) return 0;
 
+    const released = this.pool.releaseAll();
     this.pool.dispose();
     this.disposed = true;
 
     gcLogger.debug("GarbageCollector disposed");
+    return released;
   }
 
   private ensureNotDisposed(): void {
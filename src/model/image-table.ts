@@ -0,0 +1,335 @@
+/**
+ * Columnar TypeDef table for an image.
+ *
+ * Decodes the TYPEDEF and NESTEDCLASS metadata tables in one pass with
+ * `mono_metadata_decode_row` and keeps the columns in flat typed arrays:
+ * tokens, flags, name/namespace string heap offsets, extends and the
+ * enclosing type. Names are read from the string heap on demand and shared
+ * by offset, so namespace listings and namespace filters need one native
+ * call per row instead of a `MonoClass` and several calls per type.
+ *
+ * Runtimes without the metadata exports fall back to walking the classes
+ * once through `mono_class_get`.
+ *
+ * @module model/image-table
+ */
+
+import { Logger } from "../utils/log";
+import { pointerIsNull } from "../utils/memory";
+import { readUtf8String } from "../utils/string";
+import type { MonoImage } from "./image";
+
+const tableLogger = Logger.withTag("ImageTable");
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+/**
+ * Build statistics for an {@link ImageTypeTable}.
+ */
+export interface ImageTypeTableStats {
+  /** TypeDef rows, including the `<Module>` pseudo type */
+  rows: number;
+  /** Rows nested in another type */
+  nested: number;
+  /** Where the rows were read from */
+  source: "metadata" | "classes";
+  buildTimeMs: number;
+}
+
+// ============================================================================
+// IMAGE TYPE TABLE
+// ============================================================================
+
+/**
+ * TypeDef rows of one image, decoded once.
+ *
+ * Rows are 0-based; row `i` has token `0x02000000 | (i + 1)`.
+ *
+ * @example
+ * ```typescript
+ * const table = image.typeTable;
+ * for (const row of table.rowsInNamespace("Game")) {
+ *   console.log(table.name(row), table.tokens[row].toString(16));
+ * }
+ * ```
+ */
+export class ImageTypeTable {
+  private readonly strings = new Map<number, string>();
+  private namespaceIndex: Map<string, number[]> | null = null;
+  private sortedNamespaces: string[] | null = null;
+
+  private constructor(
+    /** TypeDef tokens */
+    readonly tokens: Uint32Array,
+    /** `TypeAttributes` flags */
+    readonly flags: Uint32Array,
+    /** Name string keys (string heap offsets when read from metadata) */
+    readonly nameOffsets: Uint32Array,
+    /** Namespace string keys (string heap offsets when read from metadata) */
+    readonly namespaceOffsets: Uint32Array,
+    /** Base type token (TypeDef, TypeRef or TypeSpec), 0 when none */
+    readonly extendsTokens: Uint32Array,
+    /** 1-based row of the enclosing type, 0 for top-level types */
+    readonly enclosingRows: Uint32Array,
+    /** Build statistics */
+    readonly stats: ImageTypeTableStats,
+    private readonly readHeapString: ((offset: number) => string) | null,
+  ) {}
+
+  /** Number of rows. */
+  get count(): number {
+    return this.tokens.length;
+  }
+
+  /** Simple name of the type in `row`. */
+  name(row: number): string {
+    return this.string(this.nameOffsets[row]);
+  }
+
+  /** Namespace of the type in `row`; empty for nested and global types. */
+  namespace(row: number): string {
+    return this.string(this.namespaceOffsets[row]);
+  }
+
+  /** Whether the type in `row` is nested in another type. */
+  isNested(row: number): boolean {
+    return this.enclosingRows[row] !== 0;
+  }
+
+  /** Unique namespaces, sorted. */
+  get namespaces(): string[] {
+    if (!this.sortedNamespaces) {
+      this.sortedNamespaces = Array.from(this.getNamespaceIndex().keys()).sort();
+    }
+    return this.sortedNamespaces;
+  }
+
+  /** Rows whose namespace is exactly `namespace`. */
+  rowsInNamespace(namespace: string): readonly number[] {
+    return this.getNamespaceIndex().get(namespace) ?? EMPTY_ROWS;
+  }
+
+  /**
+   * Decode the TypeDef table of `image`.
+   */
+  static build(image: MonoImage): ImageTypeTable {
+    const startTime = Date.now();
+    const table = image.api.strategies.classes.metadataRows
+      ? ImageTypeTable.fromMetadata(image, startTime)
+      : ImageTypeTable.fromClasses(image, startTime);
+    tableLogger.debug(
+      `Indexed ${image.name}: ${table.stats.rows} types (${table.stats.nested} nested) ` +
+        `from ${table.stats.source} in ${table.stats.buildTimeMs}ms`,
+    );
+    return table;
+  }
+
+  // ===== INTERNAL =====
+
+  private static fromMetadata(image: MonoImage, startTime: number): ImageTypeTable {
+    const native = image.api.native;
+    const typeDefs = native.mono_image_get_table_info(image.pointer, TABLE_TYPEDEF);
+    const count = pointerIsNull(typeDefs) ? 0 : (native.mono_table_info_get_rows(typeDefs) as number);
+
+    const tokens = new Uint32Array(count);
+    const flags = new Uint32Array(count);
+    const names = new Uint32Array(count);
+    const namespaces = new Uint32Array(count);
+    const extendsTokens = new Uint32Array(count);
+    const enclosingRows = new Uint32Array(count);
+    const columns = Memory.alloc(TYPEDEF_COLUMNS * 4);
+
+    const safepoints = image.api.getThreadManager()?.safepoints.scope();
+    try {
+      for (let row = 0; row < count; row++) {
+        native.mono_metadata_decode_row(typeDefs, row, columns, TYPEDEF_COLUMNS);
+        const values = new Uint32Array(columns.readByteArray(TYPEDEF_COLUMNS * 4)!);
+        tokens[row] = TOKEN_TYPEDEF | (row + 1);
+        flags[row] = values[TYPEDEF_FLAGS];
+        names[row] = values[TYPEDEF_NAME];
+        namespaces[row] = values[TYPEDEF_NAMESPACE];
+        extendsTokens[row] = decodeTypeDefOrRef(values[TYPEDEF_EXTENDS]);
+        safepoints?.poll();
+      }
+    } finally {
+      safepoints?.end();
+    }
+
+    let nested = 0;
+    const nestedClasses = native.mono_image_get_table_info(image.pointer, TABLE_NESTEDCLASS);
+    const nestedCount = pointerIsNull(nestedClasses) ? 0 : (native.mono_table_info_get_rows(nestedClasses) as number);
+    for (let row = 0; row < nestedCount; row++) {
+      native.mono_metadata_decode_row(nestedClasses, row, columns, NESTEDCLASS_COLUMNS);
+      const values = new Uint32Array(columns.readByteArray(NESTEDCLASS_COLUMNS * 4)!);
+      const nestedRow = values[NESTEDCLASS_NESTED];
+      if (nestedRow > 0 && nestedRow <= count) {
+        enclosingRows[nestedRow - 1] = values[NESTEDCLASS_ENCLOSING];
+        nested++;
+      }
+    }
+
+    const imagePointer = image.pointer;
+    return new ImageTypeTable(
+      tokens,
+      flags,
+      names,
+      namespaces,
+      extendsTokens,
+      enclosingRows,
+      { rows: count, nested, source: "metadata", buildTimeMs: Date.now() - startTime },
+      offset => readUtf8String(native.mono_metadata_string_heap(imagePointer, offset)),
+    );
+  }
+
+  private static fromClasses(image: MonoImage, startTime: number): ImageTypeTable {
+    const native = image.api.native;
+    const count = image.classCount;
+
+    const tokens = new Uint32Array(count);
+    const flags = new Uint32Array(count);
+    const names = new Uint32Array(count);
+    const namespaces = new Uint32Array(count);
+    const extendsTokens = new Uint32Array(count);
+    const enclosingRows = new Uint32Array(count);
+
+    // Without the string heap, keys index a local pool; key 0 is the empty string
+    const pool = new Map<string, number>([["", 0]]);
+    const intern = (value: string): number => {
+      let key = pool.get(value);
+      if (key === undefined) {
+        key = pool.size;
+        pool.set(value, key);
+      }
+      return key;
+    };
+
+    let nested = 0;
+    const safepoints = image.api.getThreadManager()?.safepoints.scope();
+    try {
+      for (let row = 0; row < count; row++) {
+        const token = TOKEN_TYPEDEF | (row + 1);
+        tokens[row] = token;
+        safepoints?.poll();
+        const klass = native.mono_class_get(image.pointer, token);
+        if (pointerIsNull(klass)) {
+          continue;
+        }
+        flags[row] = native.mono_class_get_flags(klass) as number;
+        names[row] = intern(readUtf8String(native.mono_class_get_name(klass)));
+        namespaces[row] = intern(readUtf8String(native.mono_class_get_namespace(klass)));
+        const parent = native.mono_class_get_parent(klass);
+        if (!pointerIsNull(parent)) {
+          extendsTokens[row] = native.mono_class_get_type_token(parent) as number;
+        }
+        const outer = native.mono_class_get_nesting_type(klass);
+        if (!pointerIsNull(outer)) {
+          enclosingRows[row] = (native.mono_class_get_type_token(outer) as number) & TOKEN_INDEX_MASK;
+          nested++;
+        }
+      }
+    } finally {
+      safepoints?.end();
+    }
+
+    const table = new ImageTypeTable(
+      tokens,
+      flags,
+      names,
+      namespaces,
+      extendsTokens,
+      enclosingRows,
+      { rows: count, nested, source: "classes", buildTimeMs: Date.now() - startTime },
+      null,
+    );
+    for (const [value, key] of pool) {
+      table.strings.set(key, value);
+    }
+    return table;
+  }
+
+  private string(offset: number): string {
+    let value = this.strings.get(offset);
+    if (value === undefined) {
+      value = offset === 0 || !this.readHeapString ? "" : this.readHeapString(offset);
+      this.strings.set(offset, value);
+    }
+    return value;
+  }
+
+  private getNamespaceIndex(): Map<string, number[]> {
+    if (this.namespaceIndex) {
+      return this.namespaceIndex;
+    }
+    // Group by heap offset first so each distinct namespace is read once
+    const byOffset = new Map<number, number[]>();
+    for (let row = 0; row < this.namespaceOffsets.length; row++) {
+      const offset = this.namespaceOffsets[row];
+      const rows = byOffset.get(offset);
+      if (rows) {
+        rows.push(row);
+      } else {
+        byOffset.set(offset, [row]);
+      }
+    }
+    const index = new Map<string, number[]>();
+    for (const [offset, rows] of byOffset) {
+      const namespace = this.string(offset);
+      const existing = index.get(namespace);
+      index.set(namespace, existing ? mergeRows(existing, rows) : rows);
+    }
+    this.namespaceIndex = index;
+    return index;
+  }
+}
+
+/** Merge two ascending row lists (duplicate heap strings for the same namespace). */
+function mergeRows(a: number[], b: number[]): number[] {
+  const merged: number[] = [];
+  let i = 0;
+  let j = 0;
+  while (i < a.length || j < b.length) {
+    if (j >= b.length || (i < a.length && a[i] < b[j])) {
+      merged.push(a[i++]);
+    } else {
+      merged.push(b[j++]);
+    }
+  }
+  return merged;
+}
+
+/** Decode a TypeDefOrRef coded index into a token; 0 when the row is 0. */
+function decodeTypeDefOrRef(coded: number): number {
+  const row = coded >>> 2;
+  if (row === 0) {
+    return 0;
+  }
+  return ((TYPEDEFORREF_TABLES[coded & 3] << 24) | row) >>> 0;
+}
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+const EMPTY_ROWS: readonly number[] = Object.freeze([]);
+
+const TABLE_TYPEDEF = 0x02;
+const TABLE_NESTEDCLASS = 0x29;
+const TOKEN_TYPEDEF = 0x02000000;
+const TOKEN_INDEX_MASK = 0x00ffffff;
+
+/** MONO_TYPEDEF_* column indexes */
+const TYPEDEF_FLAGS = 0;
+const TYPEDEF_NAME = 1;
+const TYPEDEF_NAMESPACE = 2;
+const TYPEDEF_EXTENDS = 3;
+const TYPEDEF_COLUMNS = 6;
+
+/** MONO_NESTED_CLASS_* column indexes */
+const NESTEDCLASS_NESTED = 0;
+const NESTEDCLASS_ENCLOSING = 1;
+const NESTEDCLASS_COLUMNS = 2;
+
+/** TypeDefOrRef coded index tag -> table: TypeDef, TypeRef, TypeSpec */
+const TYPEDEFORREF_TABLES = [0x02, 0x01, 0x1b, 0x00];
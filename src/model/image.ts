@@ -1,11 +1,13 @@
 import type { MonoApi } from "../runtime/api";
-import { lazy } from "../utils/cache";
+import { CacheScoped, lazy, scopedLazy } from "../utils/cache";
 import { MonoErrorCodes, raise } from "../utils/errors";
 import { pointerIsNull } from "../utils/memory";
 import { readUtf8String } from "../utils/string";
 import { MonoClass } from "./class";
 import { MonoDomain } from "./domain";
 import { MonoHandle } from "./handle";
+import { ImageTypeTable } from "./image-table";
+import { ILXrefIndex } from "./xref";
 
 /**
  * Summary information for a MonoImage, providing essential metadata about
@@ -62,7 +64,7 @@ export interface MonoImageSummary {
  * console.log(image.describe());
  * ```
  */
-export class MonoImage extends MonoHandle {
+export class MonoImage extends MonoHandle implements CacheScoped {
   // ===== STATIC FACTORY METHODS =====
 
   /**
@@ -84,6 +86,14 @@ export class MonoImage extends MonoHandle {
 
   // ===== CORE PROPERTIES =====
 
+  /**
+   * Generation of this image's cache scope.
+   * Class and token indexes are rebuilt after the image is closed or its domain unloads.
+   */
+  get cacheGeneration(): number {
+    return this.api.cacheScopes.generation(this.pointer);
+  }
+
   /**
    * Get image name (assembly name without extension).
    *
@@ -114,7 +124,7 @@ export class MonoImage extends MonoHandle {
    * classes.forEach(c => console.log(c.fullName));
    * ```
    */
-  @lazy
+  @scopedLazy
   get classes(): MonoClass[] {
     const classes: MonoClass[] = [];
     this.enumerateClasses(klass => classes.push(klass));
@@ -129,13 +139,9 @@ export class MonoImage extends MonoHandle {
    * console.log(`Image has ${image.classCount} classes`);
    * ```
    */
-  @lazy
+  @scopedLazy
   get classCount(): number {
-    const table = this.native.mono_image_get_table_info(this.pointer, MONO_METADATA_TABLE_TYPEDEF);
-    if (pointerIsNull(table)) {
-      return 0;
-    }
-    return this.native.mono_table_info_get_rows(table) as number;
+    return this.api.strategies.classes.typeDefCount(this.pointer);
   }
 
   /**
@@ -146,14 +152,34 @@ export class MonoImage extends MonoHandle {
    * image.namespaces.forEach(ns => console.log(ns || "(global)"));
    * ```
    */
-  @lazy
   get namespaces(): string[] {
-    const namespaces = new Set<string>();
-    this.enumerateClasses(klass => {
-      const ns = klass.namespace;
-      namespaces.add(ns);
-    });
-    return Array.from(namespaces).sort();
+    return this.typeTable.namespaces;
+  }
+
+  /**
+   * Get the number of unique namespaces in this image.
+   */
+  get namespaceCount(): number {
+    return this.typeTable.namespaces.length;
+  }
+
+  /**
+   * Columnar TypeDef table (tokens, flags, names, namespaces, extends, nesting).
+   *
+   * @remarks
+   * Decoded from metadata in a single pass on first access and shared by
+   * `namespaces`, `namespaceCount`, `classTokens` and `getClassesByNamespace()`.
+   * Classes are only created for rows that are actually returned.
+   *
+   * @example
+   * ```typescript
+   * const table = image.typeTable;
+   * console.log(`${table.count} types in ${table.namespaces.length} namespaces`);
+   * ```
+   */
+  @scopedLazy
+  get typeTable(): ImageTypeTable {
+    return ImageTypeTable.build(this);
   }
 
   // ===== CLASS LOOKUP =====
@@ -356,14 +382,14 @@ export class MonoImage extends MonoHandle {
    * const globalClasses = image.getClassesByNamespace('');
    */
   getClassesByNamespace(namespace: string): MonoClass[] {
+    const table = this.typeTable;
     const classes: MonoClass[] = [];
-
-    this.enumerateClasses(klass => {
-      if (klass.namespace === namespace) {
-        classes.push(klass);
+    for (const row of table.rowsInNamespace(namespace)) {
+      const klassPtr = this.native.mono_class_get(this.pointer, table.tokens[row]);
+      if (!pointerIsNull(klassPtr)) {
+        classes.push(new MonoClass(this.api, klassPtr));
       }
-    });
-
+    }
     return classes;
   }
 
@@ -382,14 +408,27 @@ export class MonoImage extends MonoHandle {
    * // [0x02000001, 0x02000002, ...]
    * ```
    */
-  @lazy
+  @scopedLazy
   get classTokens(): number[] {
-    const count = this.classCount;
-    const tokens: number[] = [];
-    for (let index = 0; index < count; index += 1) {
-      tokens.push(MONO_METADATA_TOKEN_TYPEDEF | (index + 1));
-    }
-    return tokens;
+    return Array.from(this.typeTable.tokens);
+  }
+
+  /**
+   * IL cross-reference index for the methods defined in this image.
+   *
+   * @remarks
+   * Built on first access by decoding every method body once; later queries do not touch IL.
+   * Use `ILXrefIndex.tryFromBuffer()` to restore a persisted index instead of rebuilding.
+   *
+   * @example
+   * ```typescript
+   * const callers = image.xrefs.callersOf(playerClass.method("TakeDamage"));
+   * const writers = image.xrefs.fieldWriters(playerClass.field("health"));
+   * ```
+   */
+  @scopedLazy
+  get xrefs(): ILXrefIndex {
+    return ILXrefIndex.build(this);
   }
 
   // ===== ENUMERATION =====
@@ -402,6 +441,8 @@ export class MonoImage extends MonoHandle {
    * @remarks
    * This is more memory-efficient than accessing `classes` for large assemblies
    * as it doesn't create an array of all classes.
+   * On cooperative-suspend runtimes the GC may run between visits, so do not
+   * keep unrooted managed objects across visitor calls.
    *
    * @example
    * ```typescript
@@ -413,12 +454,18 @@ export class MonoImage extends MonoHandle {
   enumerateClasses(visitor: (klass: MonoClass, index: number) => void): void {
     // Generate tokens inline to avoid circular dependency with classTokens getter
     const count = this.classCount;
-    for (let index = 0; index < count; index += 1) {
-      const token = MONO_METADATA_TOKEN_TYPEDEF | (index + 1);
-      const klassPtr = this.native.mono_class_get(this.pointer, token);
-      if (!pointerIsNull(klassPtr)) {
-        visitor(new MonoClass(this.api, klassPtr), index);
+    const safepoints = this.api.getThreadManager()?.safepoints.scope();
+    try {
+      for (let index = 0; index < count; index += 1) {
+        const token = MONO_METADATA_TOKEN_TYPEDEF | (index + 1);
+        const klassPtr = this.native.mono_class_get(this.pointer, token);
+        if (!pointerIsNull(klassPtr)) {
+          visitor(new MonoClass(this.api, klassPtr), index);
+        }
+        safepoints?.poll();
       }
+    } finally {
+      safepoints?.end();
     }
   }
 
@@ -477,7 +524,7 @@ export class MonoImage extends MonoHandle {
     return {
       name: this.name,
       classCount: this.classCount,
-      namespaceCount: this.namespaces.length,
+      namespaceCount: this.namespaceCount,
       namespaces: this.namespaces,
       pointer: this.pointer.toString(),
     };
@@ -527,19 +574,6 @@ export class MonoImage extends MonoHandle {
     return `MonoImage(${this.name}, ${this.classCount} classes)`;
   }
 
-  /**
-   * Get the number of unique namespaces in this image.
-   *
-   * @example
-   * ```typescript
-   * console.log(`Image has ${image.namespaceCount} namespaces`);
-   * ```
-   */
-  @lazy
-  get namespaceCount(): number {
-    return this.namespaces.length;
-  }
-
   /**
    * Find classes whose names match a predicate.
    *
@@ -629,5 +663,4 @@ export class MonoImage extends MonoHandle {
   }
 }
 
-const MONO_METADATA_TABLE_TYPEDEF = 0x02;
 const MONO_METADATA_TOKEN_TYPEDEF = 0x02000000;
@@ -26,7 +26,8 @@ export * from "./reference";
 // ============================================================================
 
 // Array
-export { ArrayTypeGuards, MonoArray, MonoArraySummary } from "./array";
+export { ArrayTypeGuards, MonoArray, MonoArrayBound, MonoArrayRegion, MonoArraySummary } from "./array";
+export { ArrayScanComparison, ArrayScanOptions, ArrayScanPredicate, ArrayScanSummary } from "./array-scan";
 
 // Assembly
 export { MonoAssembly as Assembly, MonoAssembly } from "./assembly";
@@ -50,11 +51,36 @@ export {
   MonoFieldSummary,
 } from "./field";
 
+// Field watchpoints
+export {
+  DEFAULT_FIELD_WATCH_CONFIG,
+  FieldWatchManager,
+  type FieldAccessEvent,
+  type FieldAccessOperation,
+  type FieldWatchCallbacks,
+  type FieldWatchConfig,
+  type FieldWatchOptions,
+  type FieldWatchStats,
+} from "./field-watch";
+
 // Image
 export { MonoImage as Image, MonoImage, MonoImageSummary } from "./image";
+export { ImageTypeTable, type ImageTypeTableStats } from "./image-table";
+
+// JIT code ranges
+export { JitRangeIndex, type JitAddressInfo, type JitCodeRange } from "./jit-ranges";
+
+// Managed collections (List/Dictionary/HashSet readers)
+export { ManagedCollectionKind, ManagedCollectionReader, type CollectionReadOptions } from "./managed-collections";
 
 // Method
 export { InvokeOptions, MonoMethod as Method, MethodAccessibility, MonoMethod, MonoMethodSummary } from "./method";
+export {
+  MethodReplacement,
+  type ReplaceImplementationOptions,
+  type ReplacementImplementation,
+  type ReplacementSignature,
+} from "./method-replacement";
 
 // Method Signature
 export {
@@ -68,10 +94,31 @@ export {
 
 // Object
 export { MonoObject, MonoObject as Object } from "./object";
+export { ObjectFieldDelta, ObjectWatch, ObjectWatchStats } from "./object-watch";
+export { ObjectFactory, type ConstructorSignature, type FactoryArgumentsProvider } from "./object-factory";
 
 // Property
 export { MonoProperty, MonoPropertySummary, MonoProperty as Property } from "./property";
 
+// Source locations
+export {
+  SourceLocation,
+  SourceLocationResolver,
+  type SourceLocationQuery,
+  type SourceLocationStats,
+} from "./source-location";
+
+// Stack
+export {
+  DEFAULT_STACK_WALKER_CONFIG,
+  ManagedStackFrame,
+  StackWalker,
+  createStackWalker,
+  type StackThreadTarget,
+  type StackWalkOptions,
+  type StackWalkerConfig,
+} from "./stack";
+
 // String
 export { MonoString, MonoStringSummary } from "./string";
 
@@ -95,6 +142,29 @@ export {
   readPrimitiveValue,
   writePrimitiveValue,
 } from "./type";
+export {
+  TypeNameResolver,
+  formatTypeName,
+  parseTypeName,
+  type ParsedTypeName,
+  type TypeNameModifier,
+  type TypeNameResolverStats,
+} from "./type-name";
+export { TypeKeyedMap } from "./type-map";
+
+// IL cross-references
+export { ILXrefIndex, ILXrefKind, type ILXref, type ILXrefStats } from "./xref";
+
+// Unity scene snapshots
+export { SceneSnapshot, UnitySceneSnapshotter, type SceneSnapshotOptions, type SceneSpace } from "./unity-scene";
+export {
+  UNITY_STRUCT_FLOATS,
+  UnityStruct,
+  UnityTransformReader,
+  readUnityStruct,
+  readUnityStructArray,
+  unityStructOf,
+} from "./unity-values";
 
 // ============================================================================
 // HELPERS (shared utilities for model types)
@@ -115,11 +185,13 @@ export {
   allocPrimitiveValue,
   convertJsToMono,
   convertMonoToJs,
+  getTypeConversionInfo,
   resolveInstance,
   resolveUnderlyingPrimitive,
   unboxValue,
   validateNumericValue,
   type ConversionOptions,
+  type TypeConversionInfo,
 } from "../runtime/value-conversion";
 
 // ============================================================================
@@ -174,7 +246,9 @@ export {
   // Domain objects
   createPerformanceTracker,
   createTracer,
+  type CallStackOptions,
   type FieldAccessCallbacks,
+  type FieldTraceOptions,
   type MethodCallbacks,
   type MethodCallbacksExtended,
   type MethodCallbacksTimed,
@@ -0,0 +1,171 @@
+/**
+ * JIT code-range index.
+ *
+ * Maps native code addresses to the managed methods whose compiled body
+ * contains them. Ranges are discovered on demand through
+ * `mono_jit_info_table_find` and kept in a sorted table, so any later address
+ * inside an already-seen method resolves with a binary search instead of a
+ * runtime call. Addresses that belong to no managed method are remembered in
+ * a bounded negative cache.
+ *
+ * @module model/jit-ranges
+ */
+
+import type { MonoApi } from "../runtime/api";
+import { LruCache } from "../utils/cache";
+import { pointerIsNull } from "../utils/memory";
+import { MonoMethod } from "./method";
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+/** Compiled code range of one managed method. */
+export interface JitCodeRange {
+  readonly method: MonoMethod;
+  readonly start: NativePointer;
+  readonly size: number;
+}
+
+/** Result of attributing a code address. */
+export interface JitAddressInfo {
+  readonly method: MonoMethod;
+  readonly start: NativePointer;
+  /** Offset of the address from the start of the compiled method */
+  readonly nativeOffset: number;
+}
+
+// =============================================================================
+// JIT RANGE INDEX
+// =============================================================================
+
+/**
+ * Sorted, lazily populated index of JIT code ranges.
+ *
+ * @example
+ * ```typescript
+ * const index = new JitRangeIndex(api);
+ * const info = index.lookup(details.from);
+ * if (info) console.log(`${info.method.fullName}+0x${info.nativeOffset.toString(16)}`);
+ * ```
+ */
+export class JitRangeIndex {
+  private readonly ranges: JitCodeRange[] = [];
+  private readonly misses: LruCache<string, true>;
+  private queries = 0;
+
+  /**
+   * @param api Low-level Mono API
+   * @param missCapacity Maximum number of remembered non-managed addresses
+   */
+  constructor(
+    private readonly api: MonoApi,
+    missCapacity = DEFAULT_MISS_CAPACITY,
+  ) {
+    this.misses = new LruCache(missCapacity);
+  }
+
+  /** Number of indexed method bodies. */
+  get size(): number {
+    return this.ranges.length;
+  }
+
+  /** Number of lookups that had to query the runtime. */
+  get runtimeQueries(): number {
+    return this.queries;
+  }
+
+  /**
+   * Attribute a code address to a managed method.
+   * @param address Native instruction address (e.g. a faulting PC or return address)
+   * @returns Method and offset, or null when the address is not in JIT code
+   */
+  lookup(address: NativePointer): JitAddressInfo | null {
+    const range = this.find(address) ?? this.discover(address);
+    if (!range) {
+      return null;
+    }
+    return { method: range.method, start: range.start, nativeOffset: address.sub(range.start).toInt32() };
+  }
+
+  /** Snapshot of all indexed ranges, ordered by start address. */
+  getRanges(): JitCodeRange[] {
+    return this.ranges.slice();
+  }
+
+  /**
+   * Forget every indexed range.
+   * Call after methods were recompiled or code was unloaded.
+   */
+  clear(): void {
+    this.ranges.length = 0;
+    this.misses.clear();
+  }
+
+  // ===== INTERNAL =====
+
+  /** Binary search for the last range starting at or before `address`. */
+  private find(address: NativePointer): JitCodeRange | null {
+    const ranges = this.ranges;
+    let low = 0;
+    let high = ranges.length - 1;
+    while (low <= high) {
+      const mid = (low + high) >>> 1;
+      if (ranges[mid].start.compare(address) <= 0) {
+        low = mid + 1;
+      } else {
+        high = mid - 1;
+      }
+    }
+    if (high < 0) {
+      return null;
+    }
+    const candidate = ranges[high];
+    return address.compare(candidate.start.add(candidate.size)) < 0 ? candidate : null;
+  }
+
+  private discover(address: NativePointer): JitCodeRange | null {
+    const key = address.toString();
+    if (this.misses.has(key)) {
+      return null;
+    }
+
+    this.queries++;
+    const native = this.api.native;
+    const jitInfo = native.mono_jit_info_table_find(this.api.getRootDomain(), address) as NativePointer;
+    const methodPtr = pointerIsNull(jitInfo) ? NULL : (native.mono_jit_info_get_method(jitInfo) as NativePointer);
+    if (pointerIsNull(methodPtr)) {
+      this.misses.set(key, true);
+      return null;
+    }
+
+    const range: JitCodeRange = {
+      method: new MonoMethod(this.api, methodPtr),
+      start: native.mono_jit_info_get_code_start(jitInfo) as NativePointer,
+      size: native.mono_jit_info_get_code_size(jitInfo) as number,
+    };
+    this.insert(range);
+    return range;
+  }
+
+  private insert(range: JitCodeRange): void {
+    const ranges = this.ranges;
+    let low = 0;
+    let high = ranges.length;
+    while (low < high) {
+      const mid = (low + high) >>> 1;
+      if (ranges[mid].start.compare(range.start) < 0) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    if (low < ranges.length && ranges[low].start.equals(range.start)) {
+      ranges[low] = range;
+    } else {
+      ranges.splice(low, 0, range);
+    }
+  }
+}
+
+const DEFAULT_MISS_CAPACITY = 4096;
@@ -0,0 +1,521 @@
+/**
+ * Layout-aware readers for BCL generic collections.
+ *
+ * Reads `List<T>`, `Dictionary<TKey, TValue>` and `HashSet<T>` straight from
+ * memory instead of calling `get_Count` / `get_Item` / enumerators through
+ * managed invocation. The internal field layout is resolved once per
+ * instantiation and covers the three implementations shipped with Mono:
+ *
+ * - corefx / .NET Core (`_items`, `_entries`, `_buckets`, ...)
+ * - reference source (`entries`, `buckets`, `m_slots`, ...)
+ * - legacy Mono (`linkSlots`, `keySlots`, `valueSlots`, `touchedSlots`, ...)
+ *
+ * Backing arrays are copied with a single bulk read and decoded from the
+ * copy. Reads are not atomic: a collection mutated concurrently by managed
+ * code may yield a torn snapshot.
+ *
+ * @module model/managed-collections
+ */
+
+import type { MonoApi } from "../runtime/api";
+import { readTypedValue } from "../runtime/value-conversion";
+import type { TypedReadOptions } from "../types";
+import { MonoErrorCodes, raise } from "../utils/errors";
+import { pointerIsNull } from "../utils/memory";
+import { MonoArray } from "./array";
+import type { MonoClass } from "./class";
+import type { MonoField } from "./field";
+import { MonoObject } from "./object";
+import { MonoTypeKind, type MonoType } from "./type";
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+/** Options for collection reads. */
+export interface CollectionReadOptions extends TypedReadOptions {
+  /** Stop after this many elements/entries (default: all) */
+  limit?: number;
+}
+
+/** Collection kinds understood by {@link ManagedCollectionReader}. */
+export const ManagedCollectionKind = Object.freeze({
+  List: "List",
+  Dictionary: "Dictionary",
+  HashSet: "HashSet",
+} as const);
+
+export type ManagedCollectionKind = (typeof ManagedCollectionKind)[keyof typeof ManagedCollectionKind];
+
+/** Decodes one value from a bulk-copied buffer; `address` is the live location of the same bytes. */
+type ValueDecoder = (view: DataView, offset: number, address: NativePointer) => unknown;
+
+interface ListLayout {
+  kind: typeof ManagedCollectionKind.List;
+  items: number;
+  size: number;
+  element: MonoType;
+}
+
+/**
+ * Hashed collections, normalized to "an array of entries plus a used-slot bound".
+ * Legacy Mono keeps keys, values and links in parallel arrays; the other
+ * implementations use one entry struct array.
+ */
+interface HashedLayout {
+  kind: typeof ManagedCollectionKind.Dictionary | typeof ManagedCollectionKind.HashSet;
+  /** Offset of the used-slot bound (`_count`, `count`, `m_lastIndex`, `_lastIndex`, `touchedSlots`) */
+  bound: number;
+  /** Offset of the entry (or legacy link) array field */
+  entries: number;
+  entryStride: number;
+  hashOffset: number;
+  nextOffset: number;
+  keyOffset: number;
+  valueOffset: number;
+  /**
+   * Free entries are marked with hash code -1 (reference source and pre-.NET 5 corefx slots).
+   * `_entries` layouts chain free entries through `next < -1` and may store negative live hashes.
+   */
+  hashMarksFree: boolean;
+  key: MonoType;
+  value: MonoType | null;
+  /** Legacy Mono: parallel key/value arrays and a HASH_FLAG liveness bit */
+  legacy: { keys: number; values: number | null } | null;
+}
+
+type CollectionLayout = ListLayout | HashedLayout;
+
+// =============================================================================
+// READER
+// =============================================================================
+
+/**
+ * Direct-memory reader for managed collections.
+ *
+ * @example
+ * ```typescript
+ * const inventory = Mono.collections.readDictionary<string, MonoObject>(player.getFieldValue("inventory"));
+ * for (const [id, item] of inventory) {
+ *   console.log(id, item);
+ * }
+ *
+ * const names = Mono.collections.readList<string>(namesList);
+ * ```
+ */
+export class ManagedCollectionReader {
+  private readonly layouts = new Map<string, CollectionLayout | null>();
+
+  /**
+   * @param api Low-level Mono API
+   */
+  constructor(private readonly api: MonoApi) {}
+
+  /** Number of collection instantiations whose layout has been resolved. */
+  get cachedLayoutCount(): number {
+    return this.layouts.size;
+  }
+
+  /**
+   * Identify a collection object.
+   * @returns Collection kind, or null if the object is not a supported collection
+   */
+  kindOf(collection: MonoObject | NativePointer): ManagedCollectionKind | null {
+    const object = toObject(this.api, collection);
+    return object ? (this.layoutFor(object.class)?.kind ?? null) : null;
+  }
+
+  /**
+   * Number of elements without reading them.
+   */
+  count(collection: MonoObject | NativePointer): number {
+    const object = this.requireObject(collection);
+    const layout = this.requireLayout(object.class, null);
+    if (layout.kind === ManagedCollectionKind.List) {
+      return object.pointer.add(layout.size).readS32();
+    }
+    return this.visitEntries(object.pointer, layout, {}, null);
+  }
+
+  /**
+   * Read a `List<T>` into a JS array.
+   */
+  readList<T = unknown>(list: MonoObject | NativePointer, options: CollectionReadOptions = {}): T[] {
+    const object = this.requireObject(list);
+    const layout = this.requireLayout(object.class, ManagedCollectionKind.List) as ListLayout;
+
+    const size = object.pointer.add(layout.size).readS32();
+    const itemsPtr = object.pointer.add(layout.items).readPointer();
+    if (size <= 0 || pointerIsNull(itemsPtr)) {
+      return [];
+    }
+
+    const items = new MonoArray(this.api, itemsPtr);
+    // A list growing on another thread can publish _size before the larger _items array
+    const count = Math.min(size, items.length, options.limit ?? size);
+    if (count <= 0) {
+      return [];
+    }
+    const stride = items.elementSize;
+    const base = items.getElementAddress(0);
+    const view = new DataView(base.readByteArray(count * stride)!);
+    const decode = createDecoder(this.api, layout.element, options);
+
+    const result = new Array<T>(count);
+    for (let i = 0; i < count; i++) {
+      const offset = i * stride;
+      result[i] = decode(view, offset, base.add(offset)) as T;
+    }
+    return result;
+  }
+
+  /**
+   * Read a `Dictionary<TKey, TValue>` into a JS Map (insertion order preserved).
+   */
+  readDictionary<K = unknown, V = unknown>(
+    dictionary: MonoObject | NativePointer,
+    options: CollectionReadOptions = {},
+  ): Map<K, V> {
+    const object = this.requireObject(dictionary);
+    const layout = this.requireLayout(object.class, ManagedCollectionKind.Dictionary) as HashedLayout;
+    const result = new Map<K, V>();
+    this.visitEntries(object.pointer, layout, options, (key, value) => {
+      result.set(key as K, value as V);
+    });
+    return result;
+  }
+
+  /**
+   * Read a `HashSet<T>` into a JS array.
+   */
+  readHashSet<T = unknown>(set: MonoObject | NativePointer, options: CollectionReadOptions = {}): T[] {
+    const object = this.requireObject(set);
+    const layout = this.requireLayout(object.class, ManagedCollectionKind.HashSet) as HashedLayout;
+    const result: T[] = [];
+    this.visitEntries(object.pointer, layout, options, key => {
+      result.push(key as T);
+    });
+    return result;
+  }
+
+  /**
+   * Read any supported collection: arrays for lists and sets, a Map for dictionaries.
+   */
+  read(collection: MonoObject | NativePointer, options: CollectionReadOptions = {}): unknown[] | Map<unknown, unknown> {
+    const object = this.requireObject(collection);
+    const layout = this.requireLayout(object.class, null);
+    switch (layout.kind) {
+      case ManagedCollectionKind.List:
+        return this.readList(object, options);
+      case ManagedCollectionKind.Dictionary:
+        return this.readDictionary(object, options);
+      default:
+        return this.readHashSet(object, options);
+    }
+  }
+
+  /** Forget all resolved layouts. */
+  clearCache(): void {
+    this.layouts.clear();
+  }
+
+  // ===== ENTRY ITERATION =====
+
+  private visitEntries(
+    instance: NativePointer,
+    layout: HashedLayout,
+    options: CollectionReadOptions,
+    visit: ((key: unknown, value: unknown) => void) | null,
+  ): number {
+    const bound = instance.add(layout.bound).readS32();
+    const limit = options.limit ?? Infinity;
+    if (bound <= 0 || limit <= 0) {
+      return 0;
+    }
+
+    const entriesPtr = instance.add(layout.entries).readPointer();
+    if (pointerIsNull(entriesPtr)) {
+      return 0;
+    }
+
+    const entries = new MonoArray(this.api, entriesPtr);
+    const slots = Math.min(bound, entries.length);
+    const base = entries.getElementAddress(0);
+    const view = new DataView(base.readByteArray(slots * layout.entryStride)!);
+    const decodeKey = visit ? createDecoder(this.api, layout.key, options) : null;
+    const decodeValue = visit && layout.value ? createDecoder(this.api, layout.value, options) : null;
+
+    // Legacy Mono stores keys/values in their own arrays
+    let keyBase = base;
+    let keyView = view;
+    let keyStride = layout.entryStride;
+    let valueBase = base;
+    let valueView = view;
+    let valueStride = layout.entryStride;
+    if (layout.legacy && visit) {
+      [keyBase, keyView, keyStride] = this.copyParallelArray(instance, layout.legacy.keys, slots);
+      if (layout.legacy.values !== null) {
+        [valueBase, valueView, valueStride] = this.copyParallelArray(instance, layout.legacy.values, slots);
+      }
+    }
+
+    let emitted = 0;
+    for (let i = 0; i < slots && emitted < limit; i++) {
+      const entry = i * layout.entryStride;
+      const hash = view.getInt32(entry + layout.hashOffset, true);
+      if (layout.legacy) {
+        if ((hash & LEGACY_HASH_FLAG) === 0) {
+          continue;
+        }
+      } else {
+        const next = view.getInt32(entry + layout.nextOffset, true);
+        if (next < -1 || (layout.hashMarksFree && hash < 0)) {
+          continue;
+        }
+      }
+
+      emitted++;
+      if (!visit) {
+        continue;
+      }
+      const keyAt = layout.legacy ? i * keyStride : entry + layout.keyOffset;
+      const valueAt = layout.legacy ? i * valueStride : entry + layout.valueOffset;
+      const key = decodeKey!(keyView, keyAt, keyBase.add(keyAt));
+      const value = decodeValue ? decodeValue(valueView, valueAt, valueBase.add(valueAt)) : undefined;
+      visit(key, value);
+    }
+    return emitted;
+  }
+
+  private copyParallelArray(
+    instance: NativePointer,
+    fieldOffset: number,
+    slots: number,
+  ): [NativePointer, DataView, number] {
+    const arrayPtr = instance.add(fieldOffset).readPointer();
+    if (pointerIsNull(arrayPtr)) {
+      raise(MonoErrorCodes.NULL_POINTER, "Collection storage array is null", "The collection may be mid-resize");
+    }
+    const array = new MonoArray(this.api, arrayPtr);
+    const stride = array.elementSize;
+    const base = array.getElementAddress(0);
+    return [base, new DataView(base.readByteArray(Math.min(slots, array.length) * stride)!), stride];
+  }
+
+  // ===== LAYOUT RESOLUTION =====
+
+  private requireObject(collection: MonoObject | NativePointer): MonoObject {
+    const object = toObject(this.api, collection);
+    if (!object) {
+      raise(MonoErrorCodes.NULL_POINTER, "Collection is null", "Pass a non-null collection object");
+    }
+    return object;
+  }
+
+  private requireLayout(klass: MonoClass, expected: ManagedCollectionKind | null): CollectionLayout {
+    const layout = this.layoutFor(klass);
+    if (!layout || (expected !== null && layout.kind !== expected)) {
+      raise(
+        MonoErrorCodes.NOT_SUPPORTED,
+        `'${klass.fullName}' is not a supported ${expected ?? "collection"} type`,
+        "Supported: System.Collections.Generic List<T>, Dictionary<TKey, TValue>, HashSet<T>",
+      );
+    }
+    return layout;
+  }
+
+  private layoutFor(klass: MonoClass): CollectionLayout | null {
+    const key = klass.pointer.toString();
+    let layout = this.layouts.get(key);
+    if (layout === undefined) {
+      layout = resolveLayout(klass);
+      this.layouts.set(key, layout);
+    }
+    return layout;
+  }
+}
+
+// =============================================================================
+// LAYOUT HELPERS
+// =============================================================================
+
+function resolveLayout(klass: MonoClass): CollectionLayout | null {
+  // Walk up so subclasses of List<T> etc. resolve to the BCL layout
+  for (let current: MonoClass | null = klass; current; current = current.parent) {
+    if (current.namespace !== "System.Collections.Generic") {
+      continue;
+    }
+    const name = current.name;
+    if (name === "List`1") {
+      return resolveListLayout(current);
+    }
+    if (name === "Dictionary`2") {
+      return resolveHashedLayout(current, ManagedCollectionKind.Dictionary);
+    }
+    if (name === "HashSet`1") {
+      return resolveHashedLayout(current, ManagedCollectionKind.HashSet);
+    }
+  }
+  return null;
+}
+
+function resolveListLayout(klass: MonoClass): ListLayout | null {
+  const items = findField(klass, "_items", "items");
+  const size = findField(klass, "_size", "size");
+  const element = items?.type.elementType;
+  if (!items || !size || !element) {
+    return null;
+  }
+  return { kind: ManagedCollectionKind.List, items: items.offset, size: size.offset, element };
+}
+
+function resolveHashedLayout(
+  klass: MonoClass,
+  kind: typeof ManagedCollectionKind.Dictionary | typeof ManagedCollectionKind.HashSet,
+): HashedLayout | null {
+  const isDictionary = kind === ManagedCollectionKind.Dictionary;
+
+  // Legacy Mono: Link[] plus parallel key/value arrays
+  const links = findField(klass, "linkSlots", "links");
+  if (links) {
+    const keys = findField(klass, "keySlots", "slots");
+    const values = isDictionary ? findField(klass, "valueSlots") : null;
+    const touched = findField(klass, "touchedSlots", "touched");
+    const linkClass = links.type.elementType?.class;
+    const hash = linkClass ? findField(linkClass, "HashCode") : null;
+    const keyType = keys?.type.elementType;
+    if (!keys || !touched || !linkClass || !hash || !keyType || (isDictionary && !values)) {
+      return null;
+    }
+    return {
+      kind,
+      bound: touched.offset,
+      entries: links.offset,
+      entryStride: linkClass.instanceSize - OBJECT_HEADER_SIZE,
+      hashOffset: hash.offset - OBJECT_HEADER_SIZE,
+      nextOffset: -1,
+      keyOffset: 0,
+      valueOffset: 0,
+      hashMarksFree: false,
+      key: keyType,
+      value: values?.type.elementType ?? null,
+      legacy: { keys: keys.offset, values: values?.offset ?? null },
+    };
+  }
+
+  // corefx / reference source: one entry struct array
+  const entries = findField(klass, "_entries", "entries", "m_slots", "_slots");
+  const bound = isDictionary ? findField(klass, "_count", "count") : findField(klass, "m_lastIndex", "_lastIndex", "_count");
+  const entryClass = entries?.type.elementType?.class;
+  if (!entries || !bound || !entryClass) {
+    return null;
+  }
+
+  const hash = findField(entryClass, "hashCode", "HashCode");
+  const next = findField(entryClass, "next", "Next");
+  const key = isDictionary ? findField(entryClass, "key", "Key") : findField(entryClass, "value", "Value");
+  const value = isDictionary ? findField(entryClass, "value", "Value") : null;
+  if (!hash || !next || !key || (isDictionary && !value)) {
+    return null;
+  }
+
+  const header = OBJECT_HEADER_SIZE;
+  return {
+    kind,
+    bound: bound.offset,
+    entries: entries.offset,
+    entryStride: entryClass.instanceSize - header,
+    hashOffset: hash.offset - header,
+    nextOffset: next.offset - header,
+    keyOffset: key.offset - header,
+    valueOffset: value ? value.offset - header : 0,
+    hashMarksFree: entries.name !== "_entries" && hash.type.kind !== MonoTypeKind.U4,
+    key: key.type,
+    value: value?.type ?? null,
+    legacy: null,
+  };
+}
+
+function findField(klass: MonoClass, ...names: string[]): MonoField | null {
+  for (const name of names) {
+    const field = klass.tryField(name);
+    if (field) {
+      return field;
+    }
+  }
+  return null;
+}
+
+function toObject(api: MonoApi, value: MonoObject | NativePointer): MonoObject | null {
+  if (value instanceof MonoObject) {
+    return value;
+  }
+  return pointerIsNull(value) ? null : new MonoObject(api, value);
+}
+
+// =============================================================================
+// VALUE DECODING
+// =============================================================================
+
+/**
+ * Build a decoder for one element type. Primitives and strings are read from
+ * the bulk copy; everything else defers to `readTypedValue` on the live address.
+ */
+function createDecoder(api: MonoApi, type: MonoType, options: TypedReadOptions): ValueDecoder {
+  const kind = type.kind === MonoTypeKind.Enum ? (type.underlyingType?.kind ?? type.kind) : type.kind;
+  const bigInt = options.returnBigInt === true;
+
+  switch (kind) {
+    case MonoTypeKind.Boolean:
+      return (view, offset) => view.getUint8(offset) !== 0;
+    case MonoTypeKind.I1:
+      return (view, offset) => view.getInt8(offset);
+    case MonoTypeKind.U1:
+      return (view, offset) => view.getUint8(offset);
+    case MonoTypeKind.I2:
+      return (view, offset) => view.getInt16(offset, true);
+    case MonoTypeKind.U2:
+    case MonoTypeKind.Char:
+      return (view, offset) => view.getUint16(offset, true);
+    case MonoTypeKind.I4:
+      return (view, offset) => view.getInt32(offset, true);
+    case MonoTypeKind.U4:
+      return (view, offset) => view.getUint32(offset, true);
+    case MonoTypeKind.I8:
+      return bigInt
+        ? (view, offset) => view.getBigInt64(offset, true)
+        : (view, offset) => Number(view.getBigInt64(offset, true));
+    case MonoTypeKind.U8:
+      return bigInt
+        ? (view, offset) => view.getBigUint64(offset, true)
+        : (view, offset) => Number(view.getBigUint64(offset, true));
+    case MonoTypeKind.R4:
+      return (view, offset) => view.getFloat32(offset, true);
+    case MonoTypeKind.R8:
+      return (view, offset) => view.getFloat64(offset, true);
+    case MonoTypeKind.String:
+      if (options.returnRaw) {
+        break;
+      }
+      return (view, offset) => {
+        const strPtr = readPointerAt(view, offset);
+        return pointerIsNull(strPtr) ? null : api.readMonoString(strPtr, true);
+      };
+    default:
+      break;
+  }
+
+  return (_view, _offset, address) => readTypedValue(api, address, type, options);
+}
+
+function readPointerAt(view: DataView, offset: number): NativePointer {
+  return Process.pointerSize === 8
+    ? ptr(view.getBigUint64(offset, true).toString())
+    : ptr(view.getUint32(offset, true));
+}
+
+/** sizeof(MonoObject): value-type field offsets include the boxed object header. */
+const OBJECT_HEADER_SIZE = Process.pointerSize * 2;
+
+/** Legacy Mono `Link.HashCode` marks occupied slots with the sign bit. */
+const LEGACY_HASH_FLAG = 0x80000000 | 0;
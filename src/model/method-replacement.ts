@@ -0,0 +1,229 @@
+/**
+ * Whole-method replacement.
+ *
+ * Redirects a method's compiled code to another implementation with
+ * `Interceptor.replaceFast`, so the original body no longer runs and no
+ * per-call JavaScript hook fires unless the replacement itself is a JS
+ * `NativeCallback`. The original code stays callable through
+ * {@link MethodReplacement.original}.
+ *
+ * Call sites the JIT has inlined the method into are not affected.
+ *
+ * @module model/method-replacement
+ */
+
+import { resolveUnderlyingPrimitive } from "../runtime/value-conversion";
+import { MonoErrorCodes, raise } from "../utils/errors";
+import { Logger } from "../utils/log";
+import type { MonoMethod } from "./method";
+import { monoTypeKindToNative, MonoTypeKind, type MonoType } from "./type";
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+/**
+ * New body for a method:
+ * - NativePointer: any native function, e.g. a CModule symbol
+ * - NativeCallback: a JavaScript implementation
+ * - MonoMethod: another managed method with the same native signature
+ */
+export type ReplacementImplementation = NativePointer | NativeCallback<any, any> | MonoMethod;
+
+/** Native signature override for {@link MethodReplacement.original}. */
+export interface ReplacementSignature {
+  returnType: NativeFunctionReturnType;
+  /** Including the leading `this` pointer for instance methods */
+  argTypes: NativeFunctionArgumentType[];
+}
+
+/** Options for `MonoMethod.replaceImplementation`. */
+export interface ReplaceImplementationOptions {
+  /**
+   * Signature used to build the callable original. Derived from the managed
+   * signature when omitted; required for methods that pass structs by value.
+   */
+  signature?: ReplacementSignature;
+}
+
+const replaceLogger = Logger.withTag("Replace");
+
+/** Active replacements keyed by patched code address. */
+const activeReplacements = new Map<string, MethodReplacement>();
+
+/** Nesting depth of {@link batchInterceptorChanges}; flushes wait until it drops to 0. */
+let flushDeferral = 0;
+
+// =============================================================================
+// METHOD REPLACEMENT
+// =============================================================================
+
+/**
+ * Handle for an installed replacement.
+ *
+ * @example
+ * ```typescript
+ * const stub = new NativeCallback(() => {}, "void", ["pointer"]);
+ * const replacement = logMethod.replaceImplementation(stub);
+ * // ...
+ * replacement.revert();
+ * ```
+ */
+export class MethodReplacement {
+  private callable: NativeFunction<any, any[]> | null = null;
+  private readonly revertListeners: Array<() => void> = [];
+  private active = true;
+
+  private constructor(
+    readonly method: MonoMethod,
+    /** Patched code address */
+    readonly target: NativePointer,
+    /** Code the method now runs */
+    readonly implementation: NativePointer,
+    /** Trampoline that runs the original body */
+    readonly originalAddress: NativePointer,
+    private readonly signature: ReplacementSignature | undefined,
+    /** Implementation as passed in; holding it keeps NativeCallbacks alive while patched */
+    readonly source: ReplacementImplementation,
+  ) {}
+
+  /**
+   * Replace `method`'s compiled code.
+   * @throws {MonoError} If the method cannot be compiled or is already replaced
+   */
+  static install(
+    method: MonoMethod,
+    implementation: ReplacementImplementation,
+    options: ReplaceImplementationOptions = {},
+  ): MethodReplacement {
+    const target = method.compile();
+    const key = target.toString();
+    if (activeReplacements.has(key)) {
+      raise(
+        MonoErrorCodes.INVALID_ARGUMENT,
+        `Method ${method.fullName} is already replaced`,
+        "Call revert() on the existing replacement first",
+      );
+    }
+
+    const code = implementation instanceof NativePointer ? implementation : implementation.compile();
+    if (!(implementation instanceof NativePointer)) {
+      warnOnArityMismatch(method, implementation);
+    }
+
+    const originalAddress = Interceptor.replaceFast(target, code);
+    flushInterceptor();
+
+    const replacement = new MethodReplacement(method, target, code, originalAddress, options.signature, implementation);
+    activeReplacements.set(key, replacement);
+    replaceLogger.debug(`Replaced ${method.fullName} at ${target}`);
+    return replacement;
+  }
+
+  /** Whether the replacement is still installed. */
+  get isActive(): boolean {
+    return this.active;
+  }
+
+  /**
+   * The original method body as a NativeFunction.
+   *
+   * Arguments follow the native calling convention: the `this` pointer first
+   * for instance methods, references and strings as pointers.
+   *
+   * @throws {MonoError} NOT_SUPPORTED when the signature passes structs by value
+   *   and no explicit signature was given
+   */
+  get original(): NativeFunction<any, any[]> {
+    if (!this.callable) {
+      const { returnType, argTypes } = this.signature ?? deriveSignature(this.method);
+      this.callable = new NativeFunction(this.originalAddress, returnType, argTypes);
+    }
+    return this.callable;
+  }
+
+  /** Restore the original code. Idempotent. */
+  revert(): void {
+    if (!this.active) {
+      return;
+    }
+    this.active = false;
+    Interceptor.revert(this.target);
+    flushInterceptor();
+    activeReplacements.delete(this.target.toString());
+    replaceLogger.debug(`Restored ${this.method.fullName}`);
+    for (const listener of this.revertListeners) {
+      listener();
+    }
+  }
+
+  /** Register a callback that runs once the original code is restored. */
+  onRevert(listener: () => void): void {
+    this.revertListeners.push(listener);
+  }
+}
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+/**
+ * Run `fn` with Interceptor changes collected into one transaction.
+ *
+ * GumJS commits attach/detach/replace/revert lazily; only the explicit
+ * flushes after each replacement split a teardown into one code patch per
+ * method. Inside a batch those flushes are skipped and a single flush runs
+ * when the outermost batch ends.
+ */
+export function batchInterceptorChanges<T>(fn: () => T): T {
+  flushDeferral++;
+  try {
+    return fn();
+  } finally {
+    flushDeferral--;
+    if (flushDeferral === 0) {
+      Interceptor.flush();
+    }
+  }
+}
+
+function flushInterceptor(): void {
+  if (flushDeferral === 0) {
+    Interceptor.flush();
+  }
+}
+
+/** Native signature of a method's compiled code. */
+function deriveSignature(method: MonoMethod): ReplacementSignature {
+  const argTypes: NativeFunctionArgumentType[] = method.isInstanceMethod ? ["pointer"] : [];
+  for (const type of method.parameterTypes) {
+    argTypes.push(nativeTypeOf(method, type) as NativeFunctionArgumentType);
+  }
+  return { returnType: nativeTypeOf(method, method.returnType) as NativeFunctionReturnType, argTypes };
+}
+
+function nativeTypeOf(method: MonoMethod, type: MonoType): string {
+  if (type.byRef) {
+    return "pointer";
+  }
+  const effective = resolveUnderlyingPrimitive(type);
+  const kind = effective.kind;
+  if (kind === MonoTypeKind.ValueType || (kind === MonoTypeKind.GenericInst && effective.valueType)) {
+    raise(
+      MonoErrorCodes.NOT_SUPPORTED,
+      `Cannot derive a native signature for ${method.fullName}: ${type.name} is passed by value`,
+      "Pass options.signature with the platform ABI types",
+    );
+  }
+  return monoTypeKindToNative(kind);
+}
+
+function warnOnArityMismatch(method: MonoMethod, implementation: MonoMethod): void {
+  const expected = method.parameterCount + (method.isInstanceMethod ? 1 : 0);
+  const actual = implementation.parameterCount + (implementation.isInstanceMethod ? 1 : 0);
+  if (expected !== actual) {
+    replaceLogger.warn(
+      `Replacing ${method.fullName} (${expected} native args) with ${implementation.fullName} (${actual} native args)`,
+    );
+  }
+}
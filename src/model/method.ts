@@ -13,6 +13,7 @@ import { tryGetClassPtrFromMonoType } from "../runtime/type-resolution";
 import {
   allocPrimitiveValue,
   boxPrimitiveValue,
+  getTypeConversionInfo,
   resolveUnderlyingPrimitive,
   unboxValue,
 } from "../runtime/value-conversion";
@@ -28,6 +29,11 @@ import { MonoClass } from "./class";
 import type { MemberAccessibility, MethodArgument } from "./handle";
 import { MonoHandle } from "./handle";
 import { MonoImage } from "./image";
+import {
+  MethodReplacement,
+  type ReplaceImplementationOptions,
+  type ReplacementImplementation,
+} from "./method-replacement";
 import { MonoMethodSignature, MonoParameterInfo } from "./method-signature";
 import { MonoObject } from "./object";
 import { MonoType, MonoTypeKind, MonoTypeSummary, isPointerLikeKind } from "./type";
@@ -558,7 +564,7 @@ export class MonoMethod extends MonoHandle {
     }
 
     // Try mono_class_inflate_generic_method with constructed context
-    if (this.api.hasExport("mono_class_inflate_generic_method")) {
+    if (this.api.strategies.generics.inflateMethod) {
       const result = this.makeGenericMethodViaInflation(typeArguments);
       if (result) {
         return result;
@@ -603,7 +609,7 @@ export class MonoMethod extends MonoHandle {
       // First, check if we can get the generic container for this method
       // The generic container has context.method_inst that we can use as a template
 
-      if (this.api.hasExport("mono_method_get_generic_container")) {
+      if (this.api.strategies.generics.methodContainer) {
         const container = this.native.mono_method_get_generic_container(this.pointer);
         if (!pointerIsNull(container)) {
           // MonoGenericContainer has a context field with method_inst
@@ -929,6 +935,28 @@ export class MonoMethod extends MonoHandle {
     return this.tryCompile() !== null;
   }
 
+  /**
+   * Replace this method's compiled body with another implementation.
+   *
+   * Unlike a return-value hook, the original body does not run and no JS
+   * callback fires per call unless `impl` is itself a `NativeCallback`.
+   * The original remains callable through {@link MethodReplacement.original}.
+   *
+   * @param impl Native function (e.g. a CModule symbol), NativeCallback, or a MonoMethod with the same signature
+   * @param options Native signature override for the callable original
+   * @returns Handle used to call the original and to revert the replacement
+   * @throws {MonoJitError} if this method or a MonoMethod `impl` cannot be compiled
+   *
+   * @example
+   * const noop = new CModule("void noop(void *self) {}").noop;
+   * const replacement = analyticsMethod.replaceImplementation(noop);
+   * replacement.original(instance); // still reachable
+   * replacement.revert();
+   */
+  replaceImplementation(impl: ReplacementImplementation, options?: ReplaceImplementationOptions): MethodReplacement {
+    return MethodReplacement.install(this, impl, options);
+  }
+
   // ===== METHOD INVOCATION =====
 
   /**
@@ -951,6 +979,7 @@ export class MonoMethod extends MonoHandle {
       return result;
     } catch (error) {
       if (error instanceof MonoManagedExceptionError && options.throwOnManagedException === false) {
+        error.release();
         return NULL;
       }
       raiseFrom(error);
@@ -1027,7 +1056,8 @@ export class MonoMethod extends MonoHandle {
     }
 
     const retType = this.returnType;
-    const kind = retType.kind;
+    const info = getTypeConversionInfo(retType);
+    const kind = info.kind;
 
     // Handle void
     if (kind === MonoTypeKind.Void) {
@@ -1040,7 +1070,7 @@ export class MonoMethod extends MonoHandle {
     }
 
     // Handle value types (need to unbox)
-    if (retType.valueType) {
+    if (info.valueType) {
       return unboxValue(this.api, rawResult, retType, {
         returnBigInt: options.returnBigInt,
         structAsObject: true,
@@ -1083,11 +1113,13 @@ export class MonoMethod extends MonoHandle {
     if (value instanceof MonoObject) {
       return value.pointer;
     }
+    const info = getTypeConversionInfo(type);
     if (typeof value === "string") {
-      return this.api.stringNew(value);
+      // By-ref slots may be written by the callee, so they never get a shared string
+      return info.byRef ? this.api.stringNew(value) : this.api.stringCache.get(value);
     }
     if (typeof value === "number" || typeof value === "boolean" || typeof value === "bigint") {
-      if (type.byRef || isPointerLikeKind(type.kind)) {
+      if (info.byRef || isPointerLikeKind(info.kind)) {
         raise(
           MonoErrorCodes.TYPE_MISMATCH,
           `Parameter ${index} on ${this.fullName} expects a pointer or reference; received primitive value`,
@@ -1314,7 +1346,7 @@ export class MonoMethod extends MonoHandle {
    * @returns True if types are compatible
    */
   private isCompatiblePrimitiveType(jsType: string, monoType: MonoType): boolean {
-    const typeName = monoType.name.toLowerCase();
+    const typeName = getTypeConversionInfo(monoType).name.toLowerCase();
 
     switch (jsType) {
       case "number":
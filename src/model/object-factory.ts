@@ -0,0 +1,283 @@
+/**
+ * Object allocation fast path.
+ *
+ * An {@link ObjectFactory} resolves everything `MonoClass.newObject` looks up
+ * per call - the vtable, the constructor, and how each constructor argument
+ * is marshalled - once, and reuses a single native argument vector for every
+ * allocation.
+ *
+ * @module model/object-factory
+ */
+
+import type { MonoApi } from "../runtime/api";
+import { resolveUnderlyingPrimitive } from "../runtime/value-conversion";
+import { MonoErrorCodes, raise } from "../utils/errors";
+import { pointerIsNull } from "../utils/memory";
+import type { MonoClass } from "./class";
+import type { MethodArgument } from "./handle";
+import { MonoMethod } from "./method";
+import { MonoObject } from "./object";
+import { isPointerLikeKind, isPrimitiveKind, MonoTypeKind, writePrimitiveValue, type MonoType } from "./type";
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+/**
+ * Constructor selector for {@link MonoClass.createFactory}.
+ *
+ * - omitted: the parameterless constructor
+ * - number: the constructor with that many parameters
+ * - string[]: parameter type names, e.g. `["System.Int32", "System.String"]`
+ * - MonoMethod: a specific `.ctor` of the class
+ */
+export type ConstructorSignature = number | readonly string[] | MonoMethod;
+
+/** Produces constructor arguments for the n-th object in {@link ObjectFactory.newMany}. */
+export type FactoryArgumentsProvider = (index: number) => MethodArgument[];
+
+/** Marshals one constructor argument, returning the pointer stored in argv. */
+type ArgumentWriter = (value: MethodArgument) => NativePointer;
+
+// =============================================================================
+// OBJECT FACTORY
+// =============================================================================
+
+/**
+ * Preresolved allocator and constructor invoker for one class.
+ *
+ * Objects are not rooted, exactly as with `newObject()`: hold a GC handle
+ * (`Mono.gc.handle`) for any instance that must survive a collection.
+ *
+ * @example
+ * ```typescript
+ * const makeVector = vectorClass.createFactory(["System.Single", "System.Single", "System.Single"]);
+ * const v = makeVector.new([1, 2, 3]);
+ * const many = makeVector.newMany(1000, i => [i, i * 2, 0]);
+ * ```
+ */
+export class ObjectFactory {
+  /** Constructor invoked for each object, or null for zero-initialized value types. */
+  readonly constructorMethod: MonoMethod | null;
+  private readonly vtable: NativePointer;
+  private readonly domain: NativePointer;
+  private readonly useSpecific: boolean;
+  private readonly unboxThis: boolean;
+  private readonly argv: NativePointer;
+  private readonly writers: ArgumentWriter[];
+  private busy = false;
+  private created = 0;
+
+  /**
+   * @param api Low-level Mono API
+   * @param klass Class to instantiate
+   * @param signature Constructor selector
+   */
+  constructor(
+    private readonly api: MonoApi,
+    readonly klass: MonoClass,
+    signature?: ConstructorSignature,
+  ) {
+    if (klass.isInterface || klass.isAbstract) {
+      raise(
+        MonoErrorCodes.NOT_SUPPORTED,
+        `Cannot create instances of ${klass.isInterface ? "interface" : "abstract class"} '${klass.fullName}'`,
+        "Create a factory for a concrete type",
+      );
+    }
+
+    this.domain = api.getRootDomain();
+    this.vtable = klass.getVTable(this.domain);
+    this.useSpecific = api.hasExport("mono_object_new_specific");
+    this.unboxThis = klass.isValueType;
+    this.constructorMethod = resolveConstructor(klass, signature);
+
+    const parameterTypes = this.constructorMethod?.parameterTypes ?? [];
+    this.writers = parameterTypes.map((type, index) => createArgumentWriter(api, this.constructorMethod!, type, index));
+    this.argv = this.writers.length > 0 ? Memory.alloc(this.writers.length * Process.pointerSize) : NULL;
+  }
+
+  /** Number of parameters the constructor takes. */
+  get parameterCount(): number {
+    return this.writers.length;
+  }
+
+  /** Number of objects created by this factory. */
+  get createdCount(): number {
+    return this.created;
+  }
+
+  /**
+   * Allocate and construct one object.
+   * @param args Constructor arguments
+   * @returns Pointer to the new object
+   * @throws {MonoManagedExceptionError} if the constructor throws
+   */
+  newRaw(args: MethodArgument[] = []): NativePointer {
+    if (args.length > this.writers.length) {
+      raise(
+        MonoErrorCodes.INVALID_ARGUMENT,
+        `Constructor of '${this.klass.fullName}' takes ${this.writers.length} argument(s), got ${args.length}`,
+        "Pass arguments matching the factory's constructor signature",
+        { parameter: "args", value: args.length },
+      );
+    }
+
+    const objectPtr = this.allocate();
+    const ctor = this.constructorMethod;
+    if (ctor) {
+      const instance = this.unboxThis ? (this.api.native.mono_object_unbox(objectPtr) as NativePointer) : objectPtr;
+      if (this.busy) {
+        // Re-entered from inside a constructor: the shared argv is in use
+        ctor.invoke(instance, args);
+      } else {
+        this.busy = true;
+        try {
+          for (let i = 0; i < this.writers.length; i++) {
+            this.argv.add(i * Process.pointerSize).writePointer(this.writers[i](args[i]));
+          }
+          this.api.runtimeInvokeArgv(ctor.pointer, instance, this.argv);
+        } finally {
+          this.busy = false;
+        }
+      }
+    }
+
+    this.created++;
+    return objectPtr;
+  }
+
+  /**
+   * Allocate and construct one object.
+   * @param args Constructor arguments
+   * @returns New MonoObject
+   */
+  new(args: MethodArgument[] = []): MonoObject {
+    return new MonoObject(this.api, this.newRaw(args));
+  }
+
+  /**
+   * Allocate and construct `count` objects.
+   * @param count Number of objects
+   * @param argsFn Supplies constructor arguments for each index (omit for parameterless constructors)
+   * @returns Objects in creation order
+   */
+  newMany(count: number, argsFn?: FactoryArgumentsProvider): MonoObject[] {
+    if (!Number.isInteger(count) || count < 0) {
+      raise(MonoErrorCodes.INVALID_ARGUMENT, "count must be a non-negative integer", undefined, {
+        parameter: "count",
+        value: count,
+      });
+    }
+
+    const objects = new Array<MonoObject>(count);
+    for (let i = 0; i < count; i++) {
+      objects[i] = new MonoObject(this.api, this.newRaw(argsFn ? argsFn(i) : []));
+    }
+    return objects;
+  }
+
+  private allocate(): NativePointer {
+    const objectPtr = this.useSpecific
+      ? (this.api.native.mono_object_new_specific(this.vtable) as NativePointer)
+      : (this.api.native.mono_object_new(this.domain, this.klass.pointer) as NativePointer);
+    if (pointerIsNull(objectPtr)) {
+      raise(MonoErrorCodes.MEMORY_ERROR, `Failed to allocate instance of '${this.klass.fullName}'`);
+    }
+    return objectPtr;
+  }
+}
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+function resolveConstructor(klass: MonoClass, signature: ConstructorSignature | undefined): MonoMethod | null {
+  if (signature instanceof MonoMethod) {
+    if (!signature.isConstructor || !signature.declaringClass.pointer.equals(klass.pointer)) {
+      raise(
+        MonoErrorCodes.INVALID_ARGUMENT,
+        `'${signature.fullName}' is not a constructor of '${klass.fullName}'`,
+        "Pass one of klass.constructors",
+        { parameter: "signature" },
+      );
+    }
+    return signature;
+  }
+
+  if (typeof signature === "number" || signature === undefined) {
+    const count = signature ?? 0;
+    const ctor = klass.findConstructor(count);
+    if (!ctor && !(count === 0 && klass.isValueType)) {
+      raise(
+        MonoErrorCodes.METHOD_NOT_FOUND,
+        `No constructor with ${count} parameter(s) found on class '${klass.fullName}'`,
+        "Check the constructor signature",
+      );
+    }
+    return ctor;
+  }
+
+  const wanted = signature;
+  const match = klass.constructors.find(ctor => {
+    const types = ctor.parameterTypes;
+    return types.length === wanted.length && types.every((type, i) => typeMatches(type, wanted[i]));
+  });
+  if (!match) {
+    raise(
+      MonoErrorCodes.METHOD_NOT_FOUND,
+      `No constructor (${wanted.join(", ")}) found on class '${klass.fullName}'`,
+      "Check the parameter type names",
+    );
+  }
+  return match;
+}
+
+function typeMatches(type: MonoType, name: string): boolean {
+  return type.name === name || type.fullName === name;
+}
+
+/**
+ * Build the marshaller for one constructor parameter. Primitive parameters
+ * get a dedicated value slot that is overwritten on every call.
+ */
+function createArgumentWriter(api: MonoApi, ctor: MonoMethod, type: MonoType, index: number): ArgumentWriter {
+  const passesPointer = type.byRef || isPointerLikeKind(type.kind);
+  const effective = passesPointer ? type : resolveUnderlyingPrimitive(type);
+  const kind = effective.kind;
+  const primitive = !passesPointer && (isPrimitiveKind(kind) || kind === MonoTypeKind.Char);
+  const slot = primitive ? Memory.alloc(Math.max(effective.valueSize.size, 8)) : NULL;
+
+  return (value: MethodArgument) => {
+    if (value === null || value === undefined) {
+      return NULL;
+    }
+    if (value instanceof MonoObject) {
+      return value.pointer;
+    }
+    if (typeof value === "string") {
+      return type.byRef ? api.stringNew(value) : api.stringCache.get(value);
+    }
+    if (typeof value === "number" || typeof value === "boolean" || typeof value === "bigint") {
+      if (!primitive) {
+        raise(
+          MonoErrorCodes.TYPE_MISMATCH,
+          `Parameter ${index} on ${ctor.fullName} expects ${passesPointer ? "a pointer or reference" : type.name}; ` +
+            "received primitive value",
+          "Pass a NativePointer or MonoObject instead of a primitive value",
+        );
+      }
+      if (typeof value === "bigint") {
+        if (kind === MonoTypeKind.U8) {
+          slot.writeU64(uint64(value.toString()));
+        } else {
+          slot.writeS64(int64(value.toString()));
+        }
+      } else {
+        writePrimitiveValue(slot, kind, value);
+      }
+      return slot;
+    }
+    return value;
+  };
+}
@@ -0,0 +1,439 @@
+/**
+ * Shadow-copy change detection for instance fields.
+ *
+ * An {@link ObjectWatch} keeps a native copy of the byte range that covers the
+ * watched fields of every object. Each poll compares live memory against the
+ * copy in a CModule, first over the whole range and then per field only for
+ * objects that differ, refreshes the copy, and reports just the changed
+ * (object, field) pairs. Polling thousands of mostly idle objects therefore
+ * costs one native call instead of one field read per object and field.
+ *
+ * Reference-type fields are compared by pointer: a new object assigned to a
+ * field is a change, mutations inside the referenced object are not.
+ *
+ * @module model/object-watch
+ */
+
+import type { MonoApi } from "../runtime/api";
+import { GCHandle, GCHandlePool } from "../runtime/gchandle";
+import { MonoErrorCodes, raise } from "../utils/errors";
+import { Logger } from "../utils/log";
+import { pointerIsNull } from "../utils/memory";
+import type { MonoClass } from "./class";
+import type { MonoField } from "./field";
+import { MonoObject } from "./object";
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+/** One changed field reported by {@link ObjectWatch.poll}. */
+export interface ObjectFieldDelta {
+  /** Current position of the object in the watch */
+  index: number;
+  object: NativePointer;
+  field: MonoField;
+  /** New value, decoded with `MonoField.readValue` */
+  value: unknown;
+}
+
+/** Counters for an {@link ObjectWatch}. */
+export interface ObjectWatchStats {
+  objects: number;
+  fields: number;
+  /** Bytes shadowed per object */
+  rangeBytes: number;
+  polls: number;
+  /** Changed fields reported across all polls */
+  changes: number;
+  /** Duration of the most recent poll */
+  lastPollMs: number;
+  /** Whether comparisons run in the CModule kernel */
+  native: boolean;
+}
+
+type DiffKernel = NativeFunction<
+  number,
+  [NativePointer, number, NativePointer, number, number, NativePointer, NativePointer, number, NativePointer]
+>;
+
+const watchLogger = Logger.withTag("ObjectWatch");
+
+// =============================================================================
+// OBJECT WATCH
+// =============================================================================
+
+/**
+ * Change detector for a fixed set of fields over many objects of one class.
+ *
+ * Watched objects are pinned with GC handles until removed or disposed.
+ *
+ * @example
+ * ```typescript
+ * const watch = Mono.watch(enemies, ["health", "position"]);
+ * setInterval(() => {
+ *   for (const delta of watch.poll()) {
+ *     console.log(`${delta.object} ${delta.field.name} -> ${delta.value}`);
+ *   }
+ * }, 16);
+ * ```
+ */
+export class ObjectWatch {
+  /** Watched fields, in the order used by raw deltas */
+  readonly fields: readonly MonoField[];
+  private readonly klass: MonoClass;
+  private readonly rangeStart: number;
+  private readonly rangeSize: number;
+  private readonly fieldOffsets: NativePointer;
+  private readonly fieldSizes: NativePointer;
+  private readonly pool: GCHandlePool;
+  private objects: NativePointer[] = [];
+  private handles: GCHandle[] = [];
+  private capacity = 0;
+  private objectTable: NativePointer = NULL;
+  private shadow: NativePointer = NULL;
+  private output: NativePointer = NULL;
+  private outputCapacity = 0;
+  private polls = 0;
+  private changes = 0;
+  private lastPollMs = 0;
+  private disposed = false;
+
+  /**
+   * @param api Low-level Mono API
+   * @param objects Objects to watch; all must be instances of the first object's class
+   * @param fields Instance fields (or names resolved on that class)
+   */
+  constructor(
+    private readonly api: MonoApi,
+    objects: ReadonlyArray<MonoObject | NativePointer>,
+    fields: ReadonlyArray<MonoField | string>,
+    klass?: MonoClass,
+  ) {
+    const first = objects.find(object => !pointerIsNull(toPointer(object)));
+    const owner = klass ?? (first ? new MonoObject(api, toPointer(first)).class : null);
+    if (!owner) {
+      raise(MonoErrorCodes.INVALID_ARGUMENT, "Cannot infer the watched class from an empty object list");
+    }
+    if (fields.length === 0) {
+      raise(MonoErrorCodes.INVALID_ARGUMENT, "ObjectWatch needs at least one field");
+    }
+    this.klass = owner;
+    this.fields = fields.map(field => (typeof field === "string" ? owner.field(field) : field));
+
+    let start = Infinity;
+    let end = 0;
+    const sizes = this.fields.map(field => {
+      if (field.isStatic) {
+        raise(MonoErrorCodes.NOT_SUPPORTED, `Cannot watch static field ${field.fullName}`, "Use Mono.trace.watchField");
+      }
+      const size = field.type.valueSize.size;
+      start = Math.min(start, field.offset);
+      end = Math.max(end, field.offset + size);
+      return size;
+    });
+    this.rangeStart = start;
+    this.rangeSize = end - start;
+
+    this.fieldOffsets = Memory.alloc(this.fields.length * 4);
+    this.fieldSizes = Memory.alloc(this.fields.length * 4);
+    this.fields.forEach((field, i) => {
+      this.fieldOffsets.add(i * 4).writeU32(field.offset - start);
+      this.fieldSizes.add(i * 4).writeU32(sizes[i]);
+    });
+
+    this.pool = new GCHandlePool(api);
+    this.add(objects);
+  }
+
+  /** Number of watched objects. */
+  get size(): number {
+    return this.objects.length;
+  }
+
+  /** Whether the watch has been disposed. */
+  get isDisposed(): boolean {
+    return this.disposed;
+  }
+
+  /**
+   * Start watching more objects. Their current state becomes the baseline.
+   * @throws {MonoError} TYPE_MISMATCH if an object is not an instance of the watched class
+   */
+  add(objects: ReadonlyArray<MonoObject | NativePointer>): void {
+    this.ensureNotDisposed();
+    this.reserve(this.objects.length + objects.length);
+    for (const object of objects) {
+      const pointer = toPointer(object);
+      if (pointerIsNull(pointer)) {
+        continue;
+      }
+      if (pointerIsNull(this.api.native.mono_object_isinst(pointer, this.klass.pointer) as NativePointer)) {
+        raise(MonoErrorCodes.TYPE_MISMATCH, `Object ${pointer} is not an instance of ${this.klass.fullName}`);
+      }
+      const index = this.objects.length;
+      this.objects.push(pointer);
+      this.handles.push(this.pool.create(pointer, true));
+      this.objectTable.add(index * Process.pointerSize).writePointer(pointer);
+      Memory.copy(this.rowOf(index), pointer.add(this.rangeStart), this.rangeSize);
+    }
+  }
+
+  /**
+   * Stop watching an object. The last object takes its index.
+   * @returns Whether the object was watched
+   */
+  remove(object: MonoObject | NativePointer): boolean {
+    this.ensureNotDisposed();
+    const pointer = toPointer(object);
+    const index = this.objects.findIndex(candidate => candidate.equals(pointer));
+    if (index < 0) {
+      return false;
+    }
+
+    const last = this.objects.length - 1;
+    this.pool.release(this.handles[index]);
+    if (index !== last) {
+      this.objects[index] = this.objects[last];
+      this.handles[index] = this.handles[last];
+      this.objectTable.add(index * Process.pointerSize).writePointer(this.objects[index]);
+      Memory.copy(this.rowOf(index), this.rowOf(last), this.rangeSize);
+    }
+    this.objects.pop();
+    this.handles.pop();
+    return true;
+  }
+
+  /**
+   * Report fields changed since the previous poll, decoding their new values.
+   */
+  poll(): ObjectFieldDelta[] {
+    const raw = this.pollRaw();
+    const deltas: ObjectFieldDelta[] = new Array(raw.length / 2);
+    for (let i = 0; i < raw.length; i += 2) {
+      const object = this.objects[raw[i]];
+      const field = this.fields[raw[i + 1]];
+      deltas[i / 2] = { index: raw[i], object, field, value: field.readValue(object) };
+    }
+    return deltas;
+  }
+
+  /**
+   * Report fields changed since the previous poll as `[objectIndex, fieldIndex, ...]` pairs.
+   */
+  pollRaw(): Uint32Array {
+    this.ensureNotDisposed();
+    const started = Date.now();
+    const count = this.objects.length;
+    let result: Uint32Array;
+    if (count === 0) {
+      result = new Uint32Array(0);
+    } else {
+      const kernel = getDiffKernel();
+      result = kernel ? this.diffNative(kernel, count) : this.diffFallback(count);
+    }
+    this.polls++;
+    this.changes += result.length / 2;
+    this.lastPollMs = Date.now() - started;
+    return result;
+  }
+
+  /** Re-baseline every object without reporting changes. */
+  resync(): void {
+    this.ensureNotDisposed();
+    for (let i = 0; i < this.objects.length; i++) {
+      Memory.copy(this.rowOf(i), this.objects[i].add(this.rangeStart), this.rangeSize);
+    }
+  }
+
+  /** Get counters. */
+  getStats(): ObjectWatchStats {
+    return {
+      objects: this.objects.length,
+      fields: this.fields.length,
+      rangeBytes: this.rangeSize,
+      polls: this.polls,
+      changes: this.changes,
+      lastPollMs: this.lastPollMs,
+      native: getDiffKernel() !== null,
+    };
+  }
+
+  /** Release all GC handles and native buffers. Idempotent. */
+  dispose(): void {
+    if (this.disposed) {
+      return;
+    }
+    this.disposed = true;
+    this.pool.dispose();
+    this.objects = [];
+    this.handles = [];
+    this.objectTable = NULL;
+    this.shadow = NULL;
+    this.output = NULL;
+    this.capacity = 0;
+    this.outputCapacity = 0;
+  }
+
+  // ===== INTERNAL =====
+
+  private diffNative(kernel: DiffKernel, count: number): Uint32Array {
+    const needed = count * this.fields.length * 2;
+    if (needed > this.outputCapacity) {
+      this.outputCapacity = needed;
+      this.output = Memory.alloc(needed * 4);
+    }
+    const pairs = kernel(
+      this.objectTable,
+      count,
+      this.shadow,
+      this.rangeStart,
+      this.rangeSize,
+      this.fieldOffsets,
+      this.fieldSizes,
+      this.fields.length,
+      this.output,
+    );
+    return pairs === 0 ? new Uint32Array(0) : new Uint32Array(this.output.readByteArray(pairs * 8)!);
+  }
+
+  private diffFallback(count: number): Uint32Array {
+    const result: number[] = [];
+    const size = this.rangeSize;
+    for (let o = 0; o < count; o++) {
+      const source = this.objects[o].add(this.rangeStart);
+      const live = new Uint8Array(source.readByteArray(size)!);
+      const copy = new Uint8Array(this.rowOf(o).readByteArray(size)!);
+      if (bytesEqual(live, copy, 0, size)) {
+        continue;
+      }
+      for (let f = 0; f < this.fields.length; f++) {
+        const begin = this.fields[f].offset - this.rangeStart;
+        const end = begin + this.fieldSizes.add(f * 4).readU32();
+        if (!bytesEqual(live, copy, begin, end)) {
+          result.push(o, f);
+        }
+      }
+      this.rowOf(o).writeByteArray(live.buffer as ArrayBuffer);
+    }
+    return Uint32Array.from(result);
+  }
+
+  private rowOf(index: number): NativePointer {
+    return this.shadow.add(index * this.rangeSize);
+  }
+
+  private reserve(count: number): void {
+    if (count <= this.capacity) {
+      return;
+    }
+    const capacity = Math.max(count, this.capacity * 2, MIN_CAPACITY);
+    const objectTable = Memory.alloc(capacity * Process.pointerSize);
+    const shadow = Memory.alloc(capacity * this.rangeSize);
+    if (this.objects.length > 0) {
+      Memory.copy(objectTable, this.objectTable, this.objects.length * Process.pointerSize);
+      Memory.copy(shadow, this.shadow, this.objects.length * this.rangeSize);
+    }
+    this.objectTable = objectTable;
+    this.shadow = shadow;
+    this.capacity = capacity;
+  }
+
+  private ensureNotDisposed(): void {
+    if (this.disposed) {
+      raise(MonoErrorCodes.DISPOSED, "ObjectWatch has been disposed");
+    }
+  }
+}
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+function toPointer(object: MonoObject | NativePointer): NativePointer {
+  return object instanceof MonoObject ? object.pointer : object;
+}
+
+function bytesEqual(a: Uint8Array, b: Uint8Array, begin: number, end: number): boolean {
+  for (let i = begin; i < end; i++) {
+    if (a[i] !== b[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+let diffModule: CModule | null | undefined;
+let diffKernel: DiffKernel | null = null;
+
+function getDiffKernel(): DiffKernel | null {
+  if (diffModule === undefined) {
+    try {
+      diffModule = new CModule(DIFF_KERNEL_SOURCE);
+      diffKernel = new NativeFunction(diffModule.diff_objects, "uint", [
+        "pointer",
+        "uint",
+        "pointer",
+        "uint",
+        "uint",
+        "pointer",
+        "pointer",
+        "uint",
+        "pointer",
+      ]);
+    } catch (error) {
+      watchLogger.debug(`CModule unavailable, diffing in JavaScript: ${error}`);
+      diffModule = null;
+    }
+  }
+  return diffKernel;
+}
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+const MIN_CAPACITY = 64;
+
+/**
+ * Compare each object's range with its shadow row; for rows that differ,
+ * record every differing field as an (object, field) pair and refresh the row.
+ * Returns the number of pairs written.
+ */
+const DIFF_KERNEL_SOURCE = `
+unsigned int
+diff_objects (unsigned char * const * objects, unsigned int count, unsigned char * shadow,
+    unsigned int range_start, unsigned int range_size, const unsigned int * field_offsets,
+    const unsigned int * field_sizes, unsigned int field_count, unsigned int * out)
+{
+  unsigned int o, f, k, written = 0;
+
+  for (o = 0; o != count; o++)
+  {
+    const unsigned char * live = objects[o] + range_start;
+    unsigned char * copy = shadow + o * range_size;
+
+    for (k = 0; k != range_size && live[k] == copy[k]; k++)
+      ;
+    if (k == range_size)
+      continue;
+
+    for (f = 0; f != field_count; f++)
+    {
+      unsigned int end = field_offsets[f] + field_sizes[f];
+      for (k = field_offsets[f]; k != end && live[k] == copy[k]; k++)
+        ;
+      if (k != end)
+      {
+        out[written++] = o;
+        out[written++] = f;
+      }
+    }
+
+    for (k = 0; k != range_size; k++)
+      copy[k] = live[k];
+  }
+
+  return written / 2;
+}
+`;
@@ -0,0 +1,283 @@
+/**
+ * Source-location resolution for managed frames.
+ *
+ * Maps (method, IL offset) and (method, native offset) pairs to file/line
+ * information through the runtime's debug symbol support. Every lookup
+ * returns a `MonoDebugSourceLocation` that must be released with
+ * `mono_debug_free_source_location`, so results (including misses) are
+ * cached and file names are interned into a shared table.
+ *
+ * @module model/source-location
+ */
+
+import type { MonoApi } from "../runtime/api";
+import { LruCache } from "../utils/cache";
+import { Logger } from "../utils/log";
+import { pointerIsNull } from "../utils/memory";
+import { readUtf8String } from "../utils/string";
+import type { MonoMethod } from "./method";
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+/** A resolved source position. */
+export class SourceLocation {
+  constructor(
+    private readonly files: readonly string[],
+    private readonly fileIndex: number,
+    /** 1-based line number */
+    readonly line: number,
+    /** 1-based column, or 0 when the symbol file does not record columns */
+    readonly column: number,
+    /** IL offset of the sequence point that produced this location */
+    readonly ilOffset: number,
+  ) {}
+
+  /** Source file path as recorded in the symbol file. */
+  get file(): string {
+    return this.files[this.fileIndex];
+  }
+
+  /** `file:line` or `file:line:column`. */
+  toString(): string {
+    return this.column > 0 ? `${this.file}:${this.line}:${this.column}` : `${this.file}:${this.line}`;
+  }
+}
+
+/** A single request for {@link SourceLocationResolver.resolveMany}. */
+export interface SourceLocationQuery {
+  method: MonoMethod | NativePointer;
+  /** IL offset; preferred when >= 0 */
+  ilOffset?: number;
+  /** Native code offset; used when no IL offset is known */
+  nativeOffset?: number;
+}
+
+/** Cache counters for a {@link SourceLocationResolver}. */
+export interface SourceLocationStats {
+  hits: number;
+  misses: number;
+  cached: number;
+  files: number;
+}
+
+const sourceLogger = Logger.withTag("SourceLocation");
+
+// =============================================================================
+// RESOLVER
+// =============================================================================
+
+/**
+ * Cached file/line resolver.
+ *
+ * @example
+ * ```typescript
+ * const resolver = new SourceLocationResolver(api);
+ * const location = resolver.resolve(method, 0x12);
+ * console.log(location?.toString()); // "Assets/Scripts/Player.cs:42"
+ * ```
+ */
+export class SourceLocationResolver {
+  private readonly cache: LruCache<string, SourceLocation | null>;
+  private readonly debugInfo = new LruCache<string, NativePointer | null>(DEBUG_INFO_CAPACITY);
+  // Replaced (not truncated) on clear so previously returned locations keep their file names
+  private files: string[] = [];
+  private readonly fileIds = new Map<string, number>();
+  private hits = 0;
+  private misses = 0;
+  private available: boolean | null = null;
+
+  /**
+   * @param api Low-level Mono API
+   * @param capacity Maximum number of cached (method, offset) entries
+   */
+  constructor(
+    private readonly api: MonoApi,
+    capacity = DEFAULT_SOURCE_LOCATION_CAPACITY,
+  ) {
+    this.cache = new LruCache(capacity);
+  }
+
+  /**
+   * Whether the runtime can resolve source locations at all.
+   * False when the lookup exports are missing or debugging was never enabled.
+   */
+  get isAvailable(): boolean {
+    if (this.available === null) {
+      this.available = this.detectAvailability();
+    }
+    return this.available;
+  }
+
+  /**
+   * Resolve the source location for an IL offset inside a method.
+   * @returns Location, or null when no sequence point covers the offset
+   */
+  resolve(method: MonoMethod | NativePointer, ilOffset: number): SourceLocation | null {
+    return this.lookup(toPointer(method), ilOffset, -1);
+  }
+
+  /**
+   * Resolve the source location for a native code offset inside a method.
+   * @returns Location, or null when the offset cannot be mapped
+   */
+  resolveNative(method: MonoMethod | NativePointer, nativeOffset: number): SourceLocation | null {
+    return this.lookup(toPointer(method), -1, nativeOffset);
+  }
+
+  /**
+   * Resolve many locations at once.
+   *
+   * Duplicate queries are collapsed so each distinct (method, offset) pair
+   * reaches the runtime at most once.
+   *
+   * @returns Locations aligned with `queries`
+   */
+  resolveMany(queries: readonly SourceLocationQuery[]): Array<SourceLocation | null> {
+    const results = new Array<SourceLocation | null>(queries.length);
+    const batch = new Map<string, SourceLocation | null>();
+
+    for (let i = 0; i < queries.length; i++) {
+      const query = queries[i];
+      const pointer = toPointer(query.method);
+      const il = query.ilOffset ?? -1;
+      const native = il >= 0 ? -1 : (query.nativeOffset ?? -1);
+      const key = cacheKey(pointer, il, native);
+      let location = batch.get(key);
+      if (location === undefined) {
+        location = this.lookup(pointer, il, native);
+        batch.set(key, location);
+      }
+      results[i] = location;
+    }
+
+    return results;
+  }
+
+  /** Cache counters. */
+  getStats(): SourceLocationStats {
+    return { hits: this.hits, misses: this.misses, cached: this.cache.size, files: this.files.length };
+  }
+
+  /** Drop cached locations, debug-info handles and the file table. */
+  clear(): void {
+    this.cache.clear();
+    this.debugInfo.clear();
+    this.files = [];
+    this.fileIds.clear();
+    this.hits = 0;
+    this.misses = 0;
+    this.available = null;
+  }
+
+  // ===== INTERNAL =====
+
+  private lookup(method: NativePointer, ilOffset: number, nativeOffset: number): SourceLocation | null {
+    if (pointerIsNull(method) || (ilOffset < 0 && nativeOffset < 0) || !this.isAvailable) {
+      return null;
+    }
+
+    const key = cacheKey(method, ilOffset, nativeOffset);
+    if (this.cache.has(key)) {
+      this.hits++;
+      return this.cache.get(key)!;
+    }
+
+    this.misses++;
+    let location: SourceLocation | null = null;
+    try {
+      const raw = ilOffset >= 0 ? this.lookupByIL(method, ilOffset) : this.lookupByNative(method, nativeOffset);
+      if (raw && !pointerIsNull(raw)) {
+        try {
+          location = this.decode(raw);
+        } finally {
+          this.api.native.mono_debug_free_source_location(raw);
+        }
+      }
+    } catch (error) {
+      sourceLogger.debug(`Source lookup failed for ${method}: ${error}`);
+    }
+
+    this.cache.set(key, location);
+    return location;
+  }
+
+  private lookupByIL(method: NativePointer, ilOffset: number): NativePointer | null {
+    if (!this.api.hasExport("mono_debug_method_lookup_location")) {
+      return null;
+    }
+    const info = this.debugInfo.getOrCreate(method.toString(), () => {
+      const found = this.api.native.mono_debug_lookup_method(method) as NativePointer;
+      return pointerIsNull(found) ? null : found;
+    });
+    if (!info) {
+      return null;
+    }
+    return this.api.native.mono_debug_method_lookup_location(info, ilOffset) as NativePointer;
+  }
+
+  private lookupByNative(method: NativePointer, nativeOffset: number): NativePointer {
+    return this.api.native.mono_debug_lookup_source_location(
+      method,
+      nativeOffset,
+      this.api.getRootDomain(),
+    ) as NativePointer;
+  }
+
+  /** struct MonoDebugSourceLocation { gchar *source_file; guint32 row, column; guint32 il_offset; } */
+  private decode(raw: NativePointer): SourceLocation | null {
+    const filePtr = raw.readPointer();
+    if (pointerIsNull(filePtr)) {
+      return null;
+    }
+    const fields = raw.add(Process.pointerSize);
+    return new SourceLocation(
+      this.files,
+      this.internFile(readUtf8String(filePtr)),
+      fields.readU32(),
+      fields.add(4).readU32(),
+      fields.add(8).readU32(),
+    );
+  }
+
+  private internFile(path: string): number {
+    let id = this.fileIds.get(path);
+    if (id === undefined) {
+      id = this.files.length;
+      this.files.push(path);
+      this.fileIds.set(path, id);
+    }
+    return id;
+  }
+
+  private detectAvailability(): boolean {
+    if (
+      !this.api.hasExport("mono_debug_lookup_source_location") ||
+      !this.api.hasExport("mono_debug_free_source_location")
+    ) {
+      return false;
+    }
+    if (this.api.hasExport("mono_debug_enabled")) {
+      try {
+        return (this.api.native.mono_debug_enabled() as number) !== 0;
+      } catch {
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
+function toPointer(method: MonoMethod | NativePointer): NativePointer {
+  return method instanceof NativePointer ? method : method.pointer;
+}
+
+function cacheKey(method: NativePointer, ilOffset: number, nativeOffset: number): string {
+  return ilOffset >= 0 ? `${method}:${ilOffset}` : `${method}@${nativeOffset}`;
+}
+
+const DEFAULT_SOURCE_LOCATION_CAPACITY = 16384;
+
+/** Methods whose `MonoDebugMethodInfo` handle is kept; the runtime owns the handles. */
+const DEBUG_INFO_CAPACITY = 4096;
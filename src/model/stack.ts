@@ -0,0 +1,583 @@
+/**
+ * Managed stack walking.
+ *
+ * Captures the managed call stack of the current thread through
+ * `mono_stack_walk` / `mono_stack_walk_no_il`, and of arbitrary threads by
+ * mapping a native backtrace through the JIT info table.
+ *
+ * Frames are collected into a preallocated native buffer by a single
+ * long-lived callback and decoded in one pass afterwards, so walking the
+ * stack does not allocate wrappers until frames are actually consumed.
+ *
+ * @module model/stack
+ */
+
+import type { MonoApi } from "../runtime/api";
+import { LruCache } from "../utils/cache";
+import { MonoErrorCodes, raise } from "../utils/errors";
+import { Logger } from "../utils/log";
+import { pointerIsNull } from "../utils/memory";
+import { MonoMethod } from "./method";
+import { SourceLocationResolver, type SourceLocation, type SourceLocationQuery } from "./source-location";
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+/** Options accepted by {@link StackWalker.current} and {@link StackWalker.ofThread}. */
+export interface StackWalkOptions {
+  /** Maximum number of frames to capture (default: walker capacity) */
+  maxFrames?: number;
+  /** Number of leading managed frames to drop; native frames are not counted (default: 0) */
+  skipFrames?: number;
+  /**
+   * Ask the runtime for IL offsets during the walk (`mono_stack_walk`).
+   * When false the cheaper `mono_stack_walk_no_il` is used and IL offsets are
+   * resolved lazily per frame via `mono_debug_il_offset_from_address`.
+   * Default: false.
+   */
+  ilOffsets?: boolean;
+  /** Keep frames without managed code (runtime trampolines, wrappers). Default: false. */
+  includeNative?: boolean;
+  /** Resolve file/line for all frames in one batch before returning. Default: false. */
+  symbolize?: boolean;
+}
+
+/** Configuration for a {@link StackWalker}. */
+export interface StackWalkerConfig {
+  /** Number of frames the native walk buffer can hold */
+  maxFrames: number;
+  /** Capacity of the interned method cache */
+  methodCacheCapacity: number;
+  /** Capacity of the return-address -> JIT info cache used by `ofThread` */
+  addressCacheCapacity: number;
+  /** Capacity of the (method, offset) -> source location cache */
+  sourceLocationCapacity: number;
+  /** Capacity of the (method, native offset) -> IL offset cache */
+  ilOffsetCacheCapacity: number;
+}
+
+/** Default configuration for StackWalker. */
+export const DEFAULT_STACK_WALKER_CONFIG: StackWalkerConfig = {
+  maxFrames: 256,
+  methodCacheCapacity: 4096,
+  addressCacheCapacity: 8192,
+  sourceLocationCapacity: 16384,
+  ilOffsetCacheCapacity: 16384,
+};
+
+/** Thread selector accepted by {@link StackWalker.ofThread}. */
+export type StackThreadTarget = number | ThreadDetails | CpuContext;
+
+interface JitLookup {
+  method: NativePointer;
+  codeStart: NativePointer;
+}
+
+const stackLogger = Logger.withTag("Stack");
+
+// =============================================================================
+// FRAME
+// =============================================================================
+
+/**
+ * A single managed stack frame.
+ *
+ * The method wrapper is shared with every other frame that refers to the same
+ * method, and the IL offset is only computed when first read if the walk did
+ * not already provide it.
+ */
+export class ManagedStackFrame {
+  #ilOffset: number;
+  #location: SourceLocation | null | undefined = undefined;
+
+  constructor(
+    private readonly walker: StackWalker,
+    /** Method executing in this frame */
+    readonly method: MonoMethod,
+    /** Offset from the start of the method's native code */
+    readonly nativeOffset: number,
+    ilOffset: number,
+    /** Whether the frame belongs to managed (JIT/AOT) code */
+    readonly managed: boolean,
+  ) {
+    this.#ilOffset = ilOffset;
+  }
+
+  /**
+   * IL offset of the current instruction, or -1 when it cannot be determined
+   * (no debug info, or the frame is inside a runtime wrapper).
+   */
+  get ilOffset(): number {
+    if (this.#ilOffset === UNRESOLVED_IL_OFFSET) {
+      this.#ilOffset = this.walker.resolveILOffset(this.method, this.nativeOffset);
+    }
+    return this.#ilOffset;
+  }
+
+  /**
+   * Source file and line for this frame, or null without debug symbols.
+   * Resolved on first access unless the walk was symbolized.
+   */
+  get location(): SourceLocation | null {
+    if (this.#location === undefined) {
+      this.#location = this.walker.sourceLocations.resolveMany([this.locationQuery()])[0];
+    }
+    return this.#location;
+  }
+
+  /** Whether {@link location} has already been resolved. */
+  get isSymbolized(): boolean {
+    return this.#location !== undefined;
+  }
+
+  /**
+   * `Namespace.Class::Method+IL_xxxx` style description, followed by
+   * `(file:line)` once the frame has been symbolized.
+   */
+  toString(): string {
+    const il = this.ilOffset;
+    const offset = il >= 0 ? `IL_${il.toString(16).padStart(4, "0")}` : `0x${this.nativeOffset.toString(16)}`;
+    const location = this.#location ? ` (${this.#location})` : "";
+    return `${this.method.fullName}+${offset}${location}`;
+  }
+
+  /** @internal Query used for (batched) source resolution; avoids forcing a lazy IL lookup. */
+  locationQuery(): SourceLocationQuery {
+    return this.#ilOffset >= 0
+      ? { method: this.method, ilOffset: this.#ilOffset }
+      : { method: this.method, nativeOffset: this.nativeOffset };
+  }
+
+  /** @internal */
+  assignLocation(location: SourceLocation | null): void {
+    this.#location = location;
+  }
+}
+
+// =============================================================================
+// STACK WALKER
+// =============================================================================
+
+/**
+ * Captures managed call stacks.
+ *
+ * @example
+ * ```typescript
+ * const frames = Mono.stack.current();
+ * for (const frame of frames) {
+ *   console.log(frame.toString());
+ * }
+ *
+ * // Inspect another thread from its Frida thread id
+ * const other = Mono.stack.ofThread(Process.enumerateThreads()[1].id);
+ * ```
+ */
+export class StackWalker {
+  /** Cached file/line resolver shared by every frame this walker produces. */
+  readonly sourceLocations: SourceLocationResolver;
+  private readonly config: StackWalkerConfig;
+  private readonly methods: LruCache<string, MonoMethod>;
+  private readonly addresses: LruCache<string, JitLookup | null>;
+  private readonly ilOffsets: LruCache<string, number>;
+  private readonly stride: number;
+  private readonly buffer: NativePointer;
+  private readonly state: NativePointer;
+  private readonly callback: NativePointer;
+  // Strong references keep the native callback alive for the walker's lifetime
+  private readonly keepAlive: CModule | NativeCallback<"int", ["pointer", "int", "int", "int", "pointer"]>;
+  private walking = false;
+  private disposed = false;
+
+  /**
+   * @param api Low-level Mono API
+   * @param config Optional buffer and cache sizing
+   */
+  constructor(
+    private readonly api: MonoApi,
+    config?: Partial<StackWalkerConfig>,
+  ) {
+    this.config = { ...DEFAULT_STACK_WALKER_CONFIG, ...config };
+    if (!Number.isInteger(this.config.maxFrames) || this.config.maxFrames <= 0) {
+      raise(MonoErrorCodes.INVALID_ARGUMENT, "maxFrames must be a positive integer", undefined, {
+        parameter: "maxFrames",
+        value: this.config.maxFrames,
+      });
+    }
+
+    this.methods = new LruCache(this.config.methodCacheCapacity);
+    this.addresses = new LruCache(this.config.addressCacheCapacity);
+    this.ilOffsets = new LruCache(this.config.ilOffsetCacheCapacity);
+    this.sourceLocations = new SourceLocationResolver(api, this.config.sourceLocationCapacity);
+
+    // struct frame { void *method; int native_offset; int il_offset; int managed; }
+    this.stride = Process.pointerSize === 8 ? 24 : 16;
+    this.buffer = Memory.alloc(this.stride * this.config.maxFrames);
+
+    // struct state { struct frame *frames; unsigned capacity; unsigned count; }
+    this.state = Memory.alloc(Process.pointerSize + 8);
+    this.state.writePointer(this.buffer);
+
+    const { callback, keepAlive } = createWalkCallback(this.stride);
+    this.callback = callback;
+    this.keepAlive = keepAlive;
+  }
+
+  /** Whether this walker has been disposed. */
+  get isDisposed(): boolean {
+    return this.disposed;
+  }
+
+  /** Number of distinct methods currently interned. */
+  get cachedMethodCount(): number {
+    return this.methods.size;
+  }
+
+  // ===== CURRENT THREAD =====
+
+  /**
+   * Capture the managed stack of the calling thread.
+   * @param options Walk options
+   * @returns Frames ordered innermost first
+   */
+  current(options: StackWalkOptions = {}): ManagedStackFrame[] {
+    this.ensureNotDisposed();
+
+    const wantIL = options.ilOffsets === true && this.api.hasExport("mono_stack_walk");
+    const capacity = Math.min(
+      this.config.maxFrames,
+      (options.skipFrames ?? 0) + (options.maxFrames ?? this.config.maxFrames),
+    );
+
+    // The JS lock is released during the native walk, so another thread may
+    // already own the shared buffer; give concurrent walks their own scratch space.
+    const shared = !this.walking;
+    const buffer = shared ? this.buffer : Memory.alloc(this.stride * capacity);
+    const state = shared ? this.state : Memory.alloc(Process.pointerSize + 8);
+    if (!shared) {
+      state.writePointer(buffer);
+    }
+
+    if (shared) {
+      this.walking = true;
+    }
+    try {
+      state.add(Process.pointerSize).writeU32(capacity);
+      state.add(Process.pointerSize + 4).writeU32(0);
+
+      if (wantIL) {
+        this.api.native.mono_stack_walk(this.callback, state);
+      } else {
+        this.api.native.mono_stack_walk_no_il(this.callback, state);
+      }
+
+      const count = state.add(Process.pointerSize + 4).readU32();
+      const frames = this.decode(buffer, count, wantIL, options);
+      if (options.symbolize === true) {
+        this.symbolize(frames);
+      }
+      return frames;
+    } finally {
+      if (shared) {
+        this.walking = false;
+      }
+    }
+  }
+
+  // ===== OTHER THREADS =====
+
+  /**
+   * Capture the managed frames of another thread.
+   *
+   * The thread's native backtrace is mapped through `mono_jit_info_table_find`;
+   * return addresses are cached so repeated snapshots of the same thread only
+   * pay for the JIT lookup once per call site. When the target is the calling
+   * thread this delegates to {@link current}.
+   *
+   * @param thread Frida thread id, ThreadDetails, or a captured CpuContext
+   * @param options Walk options (`ilOffsets` is ignored; offsets are resolved lazily)
+   * @returns Frames ordered innermost first
+   */
+  ofThread(thread: StackThreadTarget, options: StackWalkOptions = {}): ManagedStackFrame[] {
+    this.ensureNotDisposed();
+
+    let context: CpuContext | undefined;
+    if (typeof thread === "number" || isThreadDetails(thread)) {
+      const id = typeof thread === "number" ? thread : thread.id;
+      if (id === Process.getCurrentThreadId()) {
+        return this.current(options);
+      }
+      context =
+        typeof thread === "number" ? Process.enumerateThreads().find(t => t.id === id)?.context : thread.context;
+      if (!context) {
+        raise(MonoErrorCodes.INVALID_ARGUMENT, `Thread ${id} not found`, "Pass a live thread id", {
+          parameter: "thread",
+          value: id,
+        });
+      }
+    } else {
+      context = thread;
+    }
+
+    const addresses = Thread.backtrace(context, Backtracer.FUZZY);
+    const domain = this.api.getRootDomain();
+    const skip = options.skipFrames ?? 0;
+    const limit = options.maxFrames ?? this.config.maxFrames;
+    const frames: ManagedStackFrame[] = [];
+    let seen = 0;
+
+    for (const address of addresses) {
+      const frame = this.frameAtIn(domain, address);
+      if (!frame) {
+        continue;
+      }
+      if (seen++ < skip) {
+        continue;
+      }
+      frames.push(frame);
+      if (frames.length >= limit) {
+        break;
+      }
+    }
+
+    if (options.symbolize === true) {
+      this.symbolize(frames);
+    }
+    return frames;
+  }
+
+  /**
+   * Map a single code address to the managed frame it belongs to.
+   * @returns Frame, or null when the address is not inside JIT/AOT code
+   */
+  frameAt(address: NativePointer): ManagedStackFrame | null {
+    this.ensureNotDisposed();
+    return this.frameAtIn(this.api.getRootDomain(), address);
+  }
+
+  // ===== RESOLUTION =====
+
+  /**
+   * Resolve source locations for a set of frames in one batch.
+   * Frames that share a (method, offset) pair hit the runtime only once.
+   */
+  symbolize(frames: readonly ManagedStackFrame[]): void {
+    const pending = frames.filter(frame => !frame.isSymbolized);
+    if (pending.length === 0) {
+      return;
+    }
+    const locations = this.sourceLocations.resolveMany(pending.map(frame => frame.locationQuery()));
+    for (let i = 0; i < pending.length; i++) {
+      pending[i].assignLocation(locations[i]);
+    }
+  }
+
+  /**
+   * Map a native offset inside a method to its IL offset.
+   * Results are cached per (method, native offset), so repeated frames cost one runtime query.
+   * @returns IL offset, or -1 if the runtime has no mapping
+   */
+  resolveILOffset(method: MonoMethod, nativeOffset: number): number {
+    if (!this.api.hasExport("mono_debug_il_offset_from_address")) {
+      return -1;
+    }
+    return this.ilOffsets.getOrCreate(`${method.pointer}@${nativeOffset}`, () =>
+      this.queryILOffset(method, nativeOffset),
+    );
+  }
+
+  /** Drop interned methods, cached JIT and IL offset lookups, and source locations. */
+  clearCaches(): void {
+    this.methods.clear();
+    this.addresses.clear();
+    this.ilOffsets.clear();
+    this.sourceLocations.clear();
+  }
+
+  /** Release caches. The native buffer is freed with the walker. */
+  dispose(): void {
+    if (this.disposed) {
+      return;
+    }
+    this.clearCaches();
+    this.disposed = true;
+  }
+
+  // ===== INTERNAL =====
+
+  private queryILOffset(method: MonoMethod, nativeOffset: number): number {
+    try {
+      const il = this.api.native.mono_debug_il_offset_from_address(
+        method.pointer,
+        this.api.getRootDomain(),
+        nativeOffset,
+      ) as number;
+      return il >= 0 ? il : -1;
+    } catch (error) {
+      stackLogger.debug(`IL offset lookup failed for ${method.fullName}: ${error}`);
+      return -1;
+    }
+  }
+
+  private decode(
+    buffer: NativePointer,
+    count: number,
+    haveIL: boolean,
+    options: StackWalkOptions,
+  ): ManagedStackFrame[] {
+    const skip = options.skipFrames ?? 0;
+    const limit = options.maxFrames ?? this.config.maxFrames;
+    const frames: ManagedStackFrame[] = [];
+    const methodOffset = 0;
+    const nativeOffsetOffset = Process.pointerSize;
+    let skipped = 0;
+
+    for (let i = 0; i < count && frames.length < limit; i++) {
+      const record = buffer.add(i * this.stride);
+      const methodPtr = record.add(methodOffset).readPointer();
+      const managed = record.add(nativeOffsetOffset + 8).readS32() !== 0;
+      if (pointerIsNull(methodPtr)) {
+        continue;
+      }
+      // Only managed frames count toward skipFrames, matching ofThread()
+      if (skipped < skip) {
+        if (managed) {
+          skipped++;
+        }
+        continue;
+      }
+      if (!managed && options.includeNative !== true) {
+        continue;
+      }
+      const nativeOffset = record.add(nativeOffsetOffset).readS32();
+      // The runtime reports missing IL offsets as -1; keep those resolved so they are not looked up again
+      const ilOffset = haveIL ? Math.max(record.add(nativeOffsetOffset + 4).readS32(), -1) : UNRESOLVED_IL_OFFSET;
+      frames.push(new ManagedStackFrame(this, this.internMethod(methodPtr), nativeOffset, ilOffset, managed));
+    }
+
+    return frames;
+  }
+
+  private internMethod(pointer: NativePointer): MonoMethod {
+    return this.methods.getOrCreate(pointer.toString(), () => new MonoMethod(this.api, pointer));
+  }
+
+  private frameAtIn(domain: NativePointer, address: NativePointer): ManagedStackFrame | null {
+    const lookup = this.lookupAddress(domain, address);
+    if (!lookup) {
+      return null;
+    }
+    const nativeOffset = address.sub(lookup.codeStart).toInt32();
+    return new ManagedStackFrame(this, this.internMethod(lookup.method), nativeOffset, UNRESOLVED_IL_OFFSET, true);
+  }
+
+  private lookupAddress(domain: NativePointer, address: NativePointer): JitLookup | null {
+    return this.addresses.getOrCreate(address.toString(), () => {
+      const jitInfo = this.api.native.mono_jit_info_table_find(domain, address) as NativePointer;
+      if (pointerIsNull(jitInfo)) {
+        return null;
+      }
+      const method = this.api.native.mono_jit_info_get_method(jitInfo) as NativePointer;
+      if (pointerIsNull(method)) {
+        return null;
+      }
+      return { method, codeStart: this.api.native.mono_jit_info_get_code_start(jitInfo) as NativePointer };
+    });
+  }
+
+  private ensureNotDisposed(): void {
+    if (this.disposed) {
+      raise(MonoErrorCodes.DISPOSED, "StackWalker has been disposed", "Create a new StackWalker instance");
+    }
+  }
+}
+
+/**
+ * Factory function to create a StackWalker.
+ */
+export function createStackWalker(api: MonoApi, config?: Partial<StackWalkerConfig>): StackWalker {
+  return new StackWalker(api, config);
+}
+
+// =============================================================================
+// NATIVE CALLBACK
+// =============================================================================
+
+/**
+ * Build the frame collector passed to `mono_stack_walk*`.
+ *
+ * A CModule keeps the per-frame work entirely native; platforms without a
+ * CModule backend fall back to an equivalent NativeCallback writing the same
+ * record layout.
+ */
+function createWalkCallback(stride: number): {
+  callback: NativePointer;
+  keepAlive: CModule | NativeCallback<"int", ["pointer", "int", "int", "int", "pointer"]>;
+} {
+  try {
+    const module = new CModule(WALK_CALLBACK_SOURCE);
+    return { callback: module.collect_frame, keepAlive: module };
+  } catch (error) {
+    stackLogger.debug(`CModule unavailable, using NativeCallback frame collector: ${error}`);
+  }
+
+  const ps = Process.pointerSize;
+  const callback = new NativeCallback(
+    (method: NativePointer, nativeOffset: number, ilOffset: number, managed: number, data: NativePointer) => {
+      const capacity = data.add(ps).readU32();
+      const count = data.add(ps + 4).readU32();
+      if (count >= capacity) {
+        return 1;
+      }
+      const record = data.readPointer().add(count * stride);
+      record.writePointer(method);
+      record.add(ps).writeS32(nativeOffset);
+      record.add(ps + 4).writeS32(ilOffset);
+      record.add(ps + 8).writeS32(managed);
+      data.add(ps + 4).writeU32(count + 1);
+      return 0;
+    },
+    "int",
+    ["pointer", "int", "int", "int", "pointer"],
+  );
+  return { callback, keepAlive: callback };
+}
+
+function isThreadDetails(value: StackThreadTarget): value is ThreadDetails {
+  return typeof value === "object" && value !== null && "id" in value && "context" in value;
+}
+
+/** Marker for frames whose IL offset has not been computed yet. */
+const UNRESOLVED_IL_OFFSET = -2;
+
+const WALK_CALLBACK_SOURCE = `
+typedef struct {
+  void * method;
+  int native_offset;
+  int il_offset;
+  int managed;
+} Frame;
+
+typedef struct {
+  Frame * frames;
+  unsigned int capacity;
+  unsigned int count;
+} WalkState;
+
+int
+collect_frame (void * method, int native_offset, int il_offset, int managed, void * data)
+{
+  WalkState * state = data;
+  Frame * frame;
+
+  if (state->count >= state->capacity)
+    return 1;
+
+  frame = &state->frames[state->count++];
+  frame->method = method;
+  frame->native_offset = native_offset;
+  frame->il_offset = il_offset;
+  frame->managed = managed;
+  return 0;
+}
+`;
@@ -1,8 +1,6 @@
 import type { MonoApi } from "../runtime/api";
 import { lazy } from "../utils/cache";
 import { MonoErrorCodes, raise } from "../utils/errors";
-import { pointerIsNull } from "../utils/memory";
-import { readUtf16String, readUtf8String } from "../utils/string";
 import { MonoObject } from "./object";
 
 /**
@@ -67,16 +65,13 @@ export class MonoString extends MonoObject implements Iterable<string> {
    */
   @lazy
   get length(): number {
-    if (this.api.hasExport("mono_string_length")) {
-      return this.native.mono_string_length(this.pointer) as number;
-    }
-    // Fallback: get length from string conversion
-    return this.content.length;
+    return this.api.strategies.stringLength(this.pointer);
   }
 
   /**
    * Get the string content as a JavaScript string.
-   * Uses mono_string_to_utf8 or mono_string_to_utf16.
+   * Uses mono_string_to_utf8, mono_string_to_utf16 or mono_string_chars,
+   * whichever the runtime exports first (resolved once per runtime).
    * Value is cached on first access.
    *
    * Memory management:
@@ -86,42 +81,7 @@ export class MonoString extends MonoObject implements Iterable<string> {
    */
   @lazy
   get content(): string {
-    // Try mono_string_to_utf8 first (most reliable for Unity Mono)
-    // Note: mono_string_to_utf8 allocates memory that must be freed
-    if (this.api.hasExport("mono_string_to_utf8")) {
-      const utf8Ptr = this.native.mono_string_to_utf8(this.pointer);
-      if (!pointerIsNull(utf8Ptr)) {
-        try {
-          return readUtf8String(utf8Ptr);
-        } finally {
-          this.api.tryFree(utf8Ptr);
-        }
-      }
-    }
-
-    // Fallback: Try mono_string_to_utf16
-    // Note: mono_string_to_utf16 allocates memory that must be freed
-    if (this.api.hasExport("mono_string_to_utf16")) {
-      const utf16Ptr = this.native.mono_string_to_utf16(this.pointer);
-      if (!pointerIsNull(utf16Ptr)) {
-        try {
-          return readUtf16String(utf16Ptr);
-        } finally {
-          this.api.tryFree(utf16Ptr);
-        }
-      }
-    }
-
-    // Last resort: Try mono_string_chars + mono_string_length
-    // Note: mono_string_chars returns a pointer INTO the managed string object
-    // This is NOT heap-allocated, do NOT free it
-    if (this.api.hasExport("mono_string_chars") && this.api.hasExport("mono_string_length")) {
-      const chars = this.native.mono_string_chars(this.pointer);
-      const len = this.native.mono_string_length(this.pointer) as number;
-      return readUtf16String(chars, len);
-    }
-
-    return "";
+    return this.api.strategies.readString(this.pointer);
   }
 
   // ===== TYPE CHECKS =====
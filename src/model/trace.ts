@@ -27,8 +27,21 @@ import { Logger } from "../utils/log";
 import type { MonoClass } from "./class";
 import { MonoDomain } from "./domain";
 import type { MonoField } from "./field";
+import {
+  FieldWatchManager,
+  type FieldAccessOperation,
+  type FieldWatchCallbacks,
+  type FieldWatchOptions,
+} from "./field-watch";
 import type { MonoMethod } from "./method";
+import {
+  batchInterceptorChanges,
+  type MethodReplacement,
+  type ReplaceImplementationOptions,
+  type ReplacementImplementation,
+} from "./method-replacement";
 import type { MonoProperty } from "./property";
+import { StackWalker, type ManagedStackFrame } from "./stack";
 
 // =============================================================================
 // TYPES
@@ -63,12 +76,30 @@ export interface MethodCallbacksTimed {
   onLeave?: (retval: NativePointer, durationMs: number) => void;
 }
 
+/** Options for {@link Tracer.methodWithCallStack}. */
+export interface CallStackOptions {
+  /**
+   * Describe managed frames as `Method+IL_xxxx (file:line)` using the cached
+   * source-location resolver instead of native symbol names. Default: false.
+   */
+  symbolize?: boolean;
+}
+
 /** Field read/write callbacks. */
 export interface FieldAccessCallbacks {
   onRead?: (instance: NativePointer, value: NativePointer) => void;
   onWrite?: (instance: NativePointer, oldValue: NativePointer, newValue: NativePointer) => void;
 }
 
+/** Options for {@link Tracer.field}. */
+export interface FieldTraceOptions extends FieldWatchOptions {
+  /**
+   * Watch the field's storage with the process-wide `MemoryAccessMonitor` when
+   * no matching property exists. Default: false
+   */
+  watchStorage?: boolean;
+}
+
 /** Property get/set callbacks. */
 export interface PropertyAccessCallbacks {
   onGet?: (instance: NativePointer, value: NativePointer) => void;
@@ -363,15 +394,17 @@ export class PerformanceTracker {
     }
   }
 
-  /** Detach all interceptors and clear tracked stats. */
+  /** Detach all interceptors (in one Interceptor transaction) and clear tracked stats. */
   clear(): void {
-    for (const detach of this.detachers.values()) {
-      try {
-        detach();
-      } catch {
-        // ignore detach errors
+    batchInterceptorChanges(() => {
+      for (const detach of this.detachers.values()) {
+        try {
+          detach();
+        } catch {
+          // ignore detach errors
+        }
       }
-    }
+    });
     this.detachers.clear();
     this.stats.clear();
   }
@@ -470,6 +503,18 @@ function capitalize(str: string): string {
   return str.charAt(0).toUpperCase() + str.slice(1);
 }
 
+function describeNativeAddress(address: NativePointer): string {
+  const symbol = DebugSymbol.fromAddress(address);
+  return symbol ? `${symbol.moduleName}!${symbol.name}` : address.toString();
+}
+
+/** Describe a backtrace, symbolizing all managed frames in one batch. */
+function describeManagedBacktrace(walker: StackWalker, backtrace: NativePointer[]): string[] {
+  const frames = backtrace.map(address => walker.frameAt(address));
+  walker.symbolize(frames.filter((frame): frame is ManagedStackFrame => frame !== null));
+  return frames.map((frame, i) => (frame ? frame.toString() : describeNativeAddress(backtrace[i])));
+}
+
 let hookIdCounter = 0;
 function generateHookId(): string {
   return `hook_${++hookIdCounter}_${Date.now()}`;
@@ -484,6 +529,8 @@ function generateHookId(): string {
 export class Tracer {
   private readonly hooks = new Map<string, HookInfo>();
   private readonly config: TracerConfig;
+  private stackWalker: StackWalker | null = null;
+  private fieldWatcher: FieldWatchManager | null = null;
   private disposed = false;
 
   /**
@@ -791,26 +838,72 @@ export class Tracer {
     }
   }
 
+  /**
+   * Replace a method's body via {@link MonoMethod.replaceImplementation}.
+   *
+   * Unlike {@link replaceReturnValue} the original body is skipped entirely.
+   * The replacement is tracked like a hook, so {@link detachAll} reverts it.
+   *
+   * @returns The replacement handle; `revert()` also removes it from this tracer.
+   */
+  replaceImplementation(
+    monoMethod: MonoMethod,
+    impl: ReplacementImplementation,
+    options?: ReplaceImplementationOptions,
+  ): MethodReplacement {
+    this.ensureNotDisposed();
+    this.checkHookLimit();
+
+    const replacement = monoMethod.replaceImplementation(impl, options);
+    const methodName = monoMethod.fullName;
+    const hookId = generateHookId();
+
+    replacement.onRevert(() => {
+      this.hooks.delete(hookId);
+      if (this.config.logOperations) {
+        traceLogger.debug(`Restored implementation: ${methodName}`);
+      }
+    });
+
+    this.hooks.set(hookId, {
+      id: hookId,
+      methodName,
+      type: "method",
+      createdAt: Date.now(),
+      detach: () => replacement.revert(),
+    });
+
+    if (this.config.logOperations) {
+      traceLogger.debug(`Replaced implementation: ${methodName}`);
+    }
+
+    return replacement;
+  }
+
   /**
    * Hook a method and provide a symbolized call-stack + duration.
    *
-   * Note: Symbolization and accurate backtraces may be expensive.
+   * Note: Symbolization and accurate backtraces may be expensive. With
+   * `options.symbolize`, managed frames are resolved through a shared
+   * source-location cache so repeated call sites are only looked up once.
    */
-  methodWithCallStack(monoMethod: MonoMethod, callbacks: MethodCallbacksTimed): () => void {
+  methodWithCallStack(
+    monoMethod: MonoMethod,
+    callbacks: MethodCallbacksTimed,
+    options: CallStackOptions = {},
+  ): () => void {
     this.ensureNotDisposed();
     this.checkHookLimit();
 
     const impl = monoMethod.compile();
     const methodName = monoMethod.fullName;
     const hookId = generateHookId();
+    const walker = options.symbolize === true ? this.getStackWalker() : null;
 
     const listener = Interceptor.attach(impl, {
       onEnter(args) {
         const backtrace = Thread.backtrace(this.context, Backtracer.ACCURATE);
-        const callStack = backtrace.map(addr => {
-          const symbol = DebugSymbol.fromAddress(addr);
-          return symbol ? `${symbol.moduleName}!${symbol.name}` : addr.toString();
-        });
+        const callStack = walker ? describeManagedBacktrace(walker, backtrace) : backtrace.map(describeNativeAddress);
 
         (this as any)._startTime = Date.now();
 
@@ -933,10 +1026,13 @@ export class Tracer {
   /**
    * Best-effort field access tracing.
    *
-   * Currently implemented by attempting to hook matching property accessors when possible.
+   * Hooks a matching property's accessors when one exists. Otherwise, when
+   * `options.watchStorage` is set, the field storage is watched with
+   * {@link watchField}: static fields always, instance fields when
+   * `options.instances` names the objects to watch.
    * Returns `null` when tracing cannot be installed.
    */
-  field(monoField: MonoField, callbacks: FieldAccessCallbacks): (() => void) | null {
+  field(monoField: MonoField, callbacks: FieldAccessCallbacks, options: FieldTraceOptions = {}): (() => void) | null {
     this.ensureNotDisposed();
 
     const klass = monoField.parent;
@@ -953,16 +1049,73 @@ export class Tracer {
       });
     }
 
-    if (monoField.isStatic) {
-      traceLogger.warn(`Static field tracing for ${klass.name}.${fieldName} not implemented`);
-    } else {
-      traceLogger.warn(`Cannot trace field ${klass.name}.${fieldName} - no accessor methods found`);
+    if (!options.watchStorage) {
+      traceLogger.debug(`Cannot trace field ${klass.name}.${fieldName} - no accessor methods found`);
+      return null;
+    }
+
+    if (!monoField.isStatic && !options.instances?.length) {
+      traceLogger.warn(
+        `Cannot trace field ${klass.name}.${fieldName} - no accessor methods found and no instances to watch`,
+      );
+      return null;
+    }
+
+    try {
+      const operations: readonly FieldAccessOperation[] =
+        options.operations ?? (callbacks.onRead ? ["read", "write"] : ["write"]);
+      return this.watchField(monoField, callbacks, { ...options, operations });
+    } catch (error) {
+      traceLogger.warn(`Cannot watch field ${klass.name}.${fieldName}: ${error}`);
+      return null;
     }
+  }
+
+  /**
+   * Watch a field's storage for accesses with `MemoryAccessMonitor`.
+   *
+   * Faulting instructions are attributed to managed methods and delivered in
+   * batches through `callbacks.onAccess`; `onRead`/`onWrite` are called per access.
+   *
+   * @returns A detach function.
+   * @throws {MonoError} If the field cannot be watched on this runtime or platform.
+   */
+  watchField(monoField: MonoField, callbacks: FieldWatchCallbacks, options: FieldWatchOptions = {}): () => void {
+    this.ensureNotDisposed();
+    this.checkHookLimit();
 
-    return null;
+    const memberName = `${monoField.parent.name}.${monoField.name}`;
+    const hookId = generateHookId();
+    const unwatch = this.getFieldWatcher().watch(monoField, callbacks, options);
+
+    const detach = () => {
+      unwatch();
+      this.hooks.delete(hookId);
+      if (this.config.logOperations) {
+        traceLogger.debug(`Removed watchpoint: ${memberName}`);
+      }
+    };
+
+    this.hooks.set(hookId, {
+      id: hookId,
+      methodName: memberName,
+      type: "field",
+      createdAt: Date.now(),
+      detach,
+    });
+
+    if (this.config.logOperations) {
+      traceLogger.debug(`Watching field: ${memberName}`);
+    }
+
+    return detach;
   }
 
-  /** Find fields by pattern and attempt to trace access. */
+  /**
+   * Find fields by pattern and trace the ones with property accessors.
+   *
+   * Storage watchpoints are never armed here; use {@link watchField} for those.
+   */
   fieldsByPattern(pattern: string, callbacks: FieldAccessCallbacks): () => void {
     this.ensureNotDisposed();
     const domain = MonoDomain.getRoot(this.api);
@@ -1120,16 +1273,27 @@ export class Tracer {
     return Array.from(this.hooks.values());
   }
 
-  /** Detach all hooks currently installed by this tracer. */
-  detachAll(): void {
-    for (const hook of this.hooks.values()) {
-      try {
-        hook.detach();
-      } catch {
-        // ignore
+  /**
+   * Detach all hooks currently installed by this tracer.
+   *
+   * Detaches and reverts are committed as one Interceptor transaction.
+   *
+   * @returns Number of hooks detached
+   */
+  detachAll(): number {
+    const count = this.hooks.size;
+    const detachHooks = () => {
+      for (const hook of this.hooks.values()) {
+        try {
+          hook.detach();
+        } catch {
+          // ignore
+        }
       }
-    }
+    };
+    batchInterceptorChanges(() => (this.fieldWatcher ? this.fieldWatcher.batch(detachHooks) : detachHooks()));
     this.hooks.clear();
+    return count;
   }
 
   /** Detach all hooks and permanently dispose this instance. */
@@ -1137,11 +1301,29 @@ export class Tracer {
     if (this.disposed) return;
 
     this.detachAll();
+    this.stackWalker?.dispose();
+    this.stackWalker = null;
+    this.fieldWatcher?.dispose();
+    this.fieldWatcher = null;
     this.disposed = true;
 
     traceLogger.debug("Tracer disposed");
   }
 
+  private getStackWalker(): StackWalker {
+    if (!this.stackWalker) {
+      this.stackWalker = new StackWalker(this.api);
+    }
+    return this.stackWalker;
+  }
+
+  private getFieldWatcher(): FieldWatchManager {
+    if (!this.fieldWatcher) {
+      this.fieldWatcher = new FieldWatchManager(this.api);
+    }
+    return this.fieldWatcher;
+  }
+
   private ensureNotDisposed(): void {
     if (this.disposed) {
       raise(
@@ -0,0 +1,146 @@
+/**
+ * Type-keyed maps.
+ *
+ * {@link TypeKeyedMap} keys entries by canonical type identity
+ * ({@link MonoType.identityHash} plus {@link MonoType.equals}) instead of
+ * pointer strings or names. Lookups need no string building, and distinct
+ * `MonoType*` pointers of the same type (inflated generic instances, types
+ * read from different signatures) share one entry.
+ *
+ * @module model/type-map
+ */
+
+import type { MonoType } from "./type";
+
+interface TypeKeyedEntry<V> {
+  type: MonoType;
+  value: V;
+}
+
+/**
+ * Map keyed by canonical type identity.
+ *
+ * Keys hold `MonoType*` pointers; clear the map when the images they belong
+ * to are unloaded.
+ *
+ * @example
+ * ```typescript
+ * const plans = new TypeKeyedMap<ArgumentPlan>();
+ * const plan = plans.getOrCreate(param.type, type => buildPlan(type));
+ * ```
+ */
+export class TypeKeyedMap<V> {
+  private readonly buckets = new Map<number, TypeKeyedEntry<V>[]>();
+  private count = 0;
+
+  /** Number of entries. */
+  get size(): number {
+    return this.count;
+  }
+
+  get(type: MonoType): V | undefined {
+    return this.find(type)?.value;
+  }
+
+  has(type: MonoType): boolean {
+    return this.find(type) !== undefined;
+  }
+
+  set(type: MonoType, value: V): this {
+    const entry = this.find(type);
+    if (entry) {
+      entry.value = value;
+      return this;
+    }
+    const hash = type.identityHash;
+    const bucket = this.buckets.get(hash);
+    if (bucket) {
+      bucket.push({ type, value });
+    } else {
+      this.buckets.set(hash, [{ type, value }]);
+    }
+    this.count++;
+    return this;
+  }
+
+  /**
+   * Get the value for `type`, creating it with `factory` on a miss.
+   */
+  getOrCreate(type: MonoType, factory: (type: MonoType) => V): V {
+    const entry = this.find(type);
+    if (entry) {
+      return entry.value;
+    }
+    const value = factory(type);
+    this.set(type, value);
+    return value;
+  }
+
+  delete(type: MonoType): boolean {
+    const hash = type.identityHash;
+    const bucket = this.buckets.get(hash);
+    if (!bucket) {
+      return false;
+    }
+    const index = bucket.findIndex(entry => entry.type === type || entry.type.equals(type));
+    if (index < 0) {
+      return false;
+    }
+    bucket.splice(index, 1);
+    if (bucket.length === 0) {
+      this.buckets.delete(hash);
+    }
+    this.count--;
+    return true;
+  }
+
+  clear(): void {
+    this.buckets.clear();
+    this.count = 0;
+  }
+
+  *entries(): IterableIterator<[MonoType, V]> {
+    for (const bucket of this.buckets.values()) {
+      for (const entry of bucket) {
+        yield [entry.type, entry.value];
+      }
+    }
+  }
+
+  *keys(): IterableIterator<MonoType> {
+    for (const [type] of this.entries()) {
+      yield type;
+    }
+  }
+
+  *values(): IterableIterator<V> {
+    for (const [, value] of this.entries()) {
+      yield value;
+    }
+  }
+
+  [Symbol.iterator](): IterableIterator<[MonoType, V]> {
+    return this.entries();
+  }
+
+  // ===== INTERNAL =====
+
+  private find(type: MonoType): TypeKeyedEntry<V> | undefined {
+    const bucket = this.buckets.get(type.identityHash);
+    if (!bucket) {
+      return undefined;
+    }
+    // Same wrapper or same pointer first; the native comparison only runs on hash collisions
+    for (const entry of bucket) {
+      if (entry.type === type || entry.type.pointer.equals(type.pointer)) {
+        return entry;
+      }
+    }
+    for (const entry of bucket) {
+      if (entry.type.equals(type)) {
+        return entry;
+      }
+    }
+    return undefined;
+  }
+}
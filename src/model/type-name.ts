@@ -0,0 +1,422 @@
+/**
+ * Type name parsing and resolution.
+ *
+ * Resolves CLR type names such as
+ * `System.Collections.Generic.List`1[[Game.Item, Assembly-CSharp]]`,
+ * `Game.Grid[,]` or `Outer+Inner&` to {@link MonoType} instances.
+ * Resolution goes through `mono_reflection_type_from_name` first and falls
+ * back to {@link parseTypeName} plus `tryClass` / `makeGenericType` / array and
+ * pointer construction when the runtime cannot resolve the name itself.
+ * Results (including misses) are kept in a per-runtime cache that is cleared
+ * whenever an assembly loads or an image is invalidated.
+ *
+ * @module model/type-name
+ */
+
+import type { MonoApi } from "../runtime/api";
+import { LruCache } from "../utils/cache";
+import { MonoErrorCodes, raise } from "../utils/errors";
+import { pointerIsNull } from "../utils/memory";
+import { MonoClass } from "./class";
+import type { MonoDomain } from "./domain";
+import { MonoType } from "./type";
+
+// =============================================================================
+// TYPE DEFINITIONS
+// =============================================================================
+
+/** Suffix applied to a type name, in source order. */
+export type TypeNameModifier = { kind: "array"; rank: number } | { kind: "pointer" } | { kind: "byref" };
+
+/**
+ * Structured form of a CLR type name.
+ */
+export interface ParsedTypeName {
+  /** Namespace-qualified name, with `+` for nesting and the generic arity suffix (e.g. "List`1") */
+  name: string;
+  /** Assembly display name, when the name was assembly-qualified */
+  assembly: string | null;
+  genericArguments: ParsedTypeName[];
+  modifiers: TypeNameModifier[];
+}
+
+/**
+ * Counters for a {@link TypeNameResolver}.
+ */
+export interface TypeNameResolverStats {
+  entries: number;
+  hits: number;
+  misses: number;
+  /** Names resolved by `mono_reflection_type_from_name` */
+  native: number;
+  /** Names resolved by the parser fallback */
+  parsed: number;
+}
+
+// =============================================================================
+// PARSER
+// =============================================================================
+
+/**
+ * Parse a CLR type name.
+ *
+ * Supports namespaces, nested types (`+`), generic arity and arguments in
+ * both `[[T, Assembly]]` and `[T]` forms, arrays (`[]`, `[,]`, `[*]`),
+ * pointers (`*`), by-ref (`&`), assembly qualification and `\` escapes.
+ *
+ * @throws {MonoError} INVALID_ARGUMENT on malformed names
+ *
+ * @example
+ * ```typescript
+ * parseTypeName("System.Collections.Generic.Dictionary`2[[System.String, mscorlib],[Game.Item, Game]]");
+ * // { name: "System.Collections.Generic.Dictionary`2", genericArguments: [...], modifiers: [], assembly: null }
+ * ```
+ */
+export function parseTypeName(text: string): ParsedTypeName {
+  const parser = new TypeNameParser(text);
+  const parsed = parser.parseType(true);
+  parser.expectEnd();
+  return parsed;
+}
+
+class TypeNameParser {
+  private index = 0;
+
+  constructor(private readonly text: string) {}
+
+  parseType(allowAssembly: boolean): ParsedTypeName {
+    const name = this.readName();
+    if (name.length === 0) {
+      this.fail("expected a type name");
+    }
+    const parsed: ParsedTypeName = { name, assembly: null, genericArguments: [], modifiers: [] };
+
+    if (name.includes("`") && this.peek() === "[" && this.isGenericArgumentList()) {
+      this.index++;
+      do {
+        this.skipSpaces();
+        if (this.peek() === "[") {
+          this.index++;
+          parsed.genericArguments.push(this.parseType(true));
+          this.expect("]");
+        } else {
+          parsed.genericArguments.push(this.parseType(false));
+        }
+        this.skipSpaces();
+      } while (this.consume(","));
+      this.expect("]");
+    }
+
+    for (;;) {
+      this.skipSpaces();
+      const c = this.peek();
+      if (c === "*") {
+        this.index++;
+        parsed.modifiers.push({ kind: "pointer" });
+      } else if (c === "&") {
+        this.index++;
+        parsed.modifiers.push({ kind: "byref" });
+      } else if (c === "[" && !this.isGenericArgumentList()) {
+        this.index++;
+        let rank = 1;
+        for (;;) {
+          this.skipSpaces();
+          if (this.consume(",")) {
+            rank++;
+          } else if (!this.consume("*")) {
+            break;
+          }
+        }
+        this.expect("]");
+        parsed.modifiers.push({ kind: "array", rank });
+      } else {
+        break;
+      }
+    }
+
+    this.skipSpaces();
+    if (allowAssembly && this.peek() === ",") {
+      this.index++;
+      parsed.assembly = this.readAssembly();
+    }
+    return parsed;
+  }
+
+  expectEnd(): void {
+    this.skipSpaces();
+    if (this.index < this.text.length) {
+      this.fail(`unexpected '${this.text[this.index]}'`);
+    }
+  }
+
+  private readName(): string {
+    this.skipSpaces();
+    let name = "";
+    while (this.index < this.text.length) {
+      const c = this.text[this.index];
+      if (c === "\\" && this.index + 1 < this.text.length) {
+        name += this.text[this.index + 1];
+        this.index += 2;
+        continue;
+      }
+      if (c === "[" || c === "]" || c === "," || c === "*" || c === "&") {
+        break;
+      }
+      name += c;
+      this.index++;
+    }
+    return name.trim();
+  }
+
+  /** Assembly display name runs to the closing bracket of the enclosing argument, or the end. */
+  private readAssembly(): string {
+    const start = this.index;
+    while (this.index < this.text.length && this.text[this.index] !== "]") {
+      this.index++;
+    }
+    const assembly = this.text.slice(start, this.index).trim();
+    if (assembly.length === 0) {
+      this.fail("expected an assembly name");
+    }
+    return assembly;
+  }
+
+  /** `[` opens generic arguments unless it starts an array rank specifier: `[]`, `[,]` or `[*]`. */
+  private isGenericArgumentList(): boolean {
+    let i = this.index + 1;
+    while (this.text[i] === " ") {
+      i++;
+    }
+    const c = this.text[i];
+    return c !== undefined && c !== "]" && c !== "," && c !== "*";
+  }
+
+  private peek(): string | undefined {
+    return this.text[this.index];
+  }
+
+  private consume(c: string): boolean {
+    if (this.text[this.index] === c) {
+      this.index++;
+      return true;
+    }
+    return false;
+  }
+
+  private expect(c: string): void {
+    this.skipSpaces();
+    if (!this.consume(c)) {
+      this.fail(`expected '${c}'`);
+    }
+  }
+
+  private skipSpaces(): void {
+    while (this.text[this.index] === " ") {
+      this.index++;
+    }
+  }
+
+  private fail(message: string): never {
+    raise(MonoErrorCodes.INVALID_ARGUMENT, `Invalid type name '${this.text}': ${message} at ${this.index}`);
+  }
+}
+
+// =============================================================================
+// RESOLVER
+// =============================================================================
+
+const resolvers = new WeakMap<MonoApi, TypeNameResolver>();
+
+/**
+ * Cached type name resolution for one runtime.
+ *
+ * @example
+ * ```typescript
+ * const types = TypeNameResolver.for(api).resolveMany(domain, configTypeNames);
+ * ```
+ */
+export class TypeNameResolver {
+  private readonly cache = new LruCache<string, MonoType | null>(TYPE_NAME_CACHE_CAPACITY);
+  private hits = 0;
+  private misses = 0;
+  private native = 0;
+  private parsed = 0;
+
+  /** Get the shared resolver of a runtime. */
+  static for(api: MonoApi): TypeNameResolver {
+    let resolver = resolvers.get(api);
+    if (!resolver) {
+      resolver = new TypeNameResolver(api);
+      resolvers.set(api, resolver);
+    }
+    return resolver;
+  }
+
+  constructor(private readonly api: MonoApi) {
+    // Misses may resolve after an assembly load, and hits may dangle after an unload
+    api.cacheScopes.onInvalidate(() => this.cache.clear());
+  }
+
+  /**
+   * Resolve one type name.
+   * @returns The type, or null when it cannot be resolved (malformed names included)
+   */
+  resolve(domain: MonoDomain, name: string): MonoType | null {
+    const key = name.trim();
+    const cached = this.cache.get(key);
+    if (cached !== undefined) {
+      this.hits++;
+      return cached;
+    }
+    this.misses++;
+
+    let parsed: ParsedTypeName | null = null;
+    try {
+      parsed = parseTypeName(key);
+    } catch {
+      // Leave malformed names to the runtime parser
+    }
+
+    let type = this.resolveNative(domain, key, parsed);
+    if (type) {
+      this.native++;
+    } else if (parsed) {
+      type = this.resolveParsed(domain, parsed);
+      if (type) {
+        this.parsed++;
+      }
+    }
+    this.cache.set(key, type);
+    return type;
+  }
+
+  /**
+   * Resolve many names in one attached context, e.g. all type names of a config file.
+   * Duplicates are resolved once.
+   */
+  resolveMany(domain: MonoDomain, names: Iterable<string>): Map<string, MonoType | null> {
+    const run = () => {
+      const results = new Map<string, MonoType | null>();
+      for (const name of names) {
+        if (!results.has(name)) {
+          results.set(name, this.resolve(domain, name));
+        }
+      }
+      return results;
+    };
+    const manager = this.api.getThreadManager();
+    return manager ? manager.runIfNeeded(run) : run();
+  }
+
+  /** Drop all cached resolutions. */
+  clear(): void {
+    this.cache.clear();
+  }
+
+  /** Get counters. */
+  getStats(): TypeNameResolverStats {
+    return {
+      entries: this.cache.size,
+      hits: this.hits,
+      misses: this.misses,
+      native: this.native,
+      parsed: this.parsed,
+    };
+  }
+
+  // ===== INTERNAL =====
+
+  private resolveNative(domain: MonoDomain, name: string, parsed: ParsedTypeName | null): MonoType | null {
+    if (!this.api.hasExport("mono_reflection_type_from_name")) {
+      return null;
+    }
+    let type = this.typeFromName(name, NULL);
+    if (!type && parsed && !parsed.assembly) {
+      // Without an image the runtime only searches corlib; retry in the definition's image
+      const definition = domain.tryClass(parsed.name.split("+")[0]);
+      if (definition) {
+        type = this.typeFromName(name, definition.image.pointer);
+      }
+    }
+    return type;
+  }
+
+  private typeFromName(name: string, image: NativePointer): MonoType | null {
+    try {
+      // Older runtimes parse the buffer in place, so it must not be a shared cached string
+      const typePtr = this.api.native.mono_reflection_type_from_name(Memory.allocUtf8String(name), image);
+      return pointerIsNull(typePtr) ? null : new MonoType(this.api, typePtr as NativePointer);
+    } catch {
+      return null;
+    }
+  }
+
+  private resolveParsed(domain: MonoDomain, parsed: ParsedTypeName): MonoType | null {
+    const [outer, ...nested] = parsed.name.split("+");
+    let klass = domain.tryClass(outer);
+    for (const name of nested) {
+      klass = klass?.tryNestedType(name) ?? null;
+    }
+    if (!klass) {
+      return null;
+    }
+
+    if (parsed.genericArguments.length > 0) {
+      const args: MonoClass[] = [];
+      for (const argument of parsed.genericArguments) {
+        const argClass = this.resolve(domain, formatTypeName(argument))?.class;
+        if (!argClass) {
+          return null;
+        }
+        args.push(argClass);
+      }
+      klass = klass.isGenericTypeDefinition ? klass.makeGenericType(args) : null;
+      if (!klass) {
+        return null;
+      }
+    }
+
+    let type = klass.type;
+    for (const modifier of parsed.modifiers) {
+      const current = type.class;
+      if (!current) {
+        return null;
+      }
+      const native = this.api.native;
+      let next: NativePointer;
+      if (modifier.kind === "array") {
+        next = native.mono_class_get_type(native.mono_array_class_get(current.pointer, modifier.rank));
+      } else if (modifier.kind === "pointer") {
+        next = native.mono_class_get_type(native.mono_ptr_class_get(type.pointer));
+      } else {
+        next = native.mono_class_get_byref_type(current.pointer);
+      }
+      if (pointerIsNull(next)) {
+        return null;
+      }
+      type = new MonoType(this.api, next);
+    }
+    return type;
+  }
+}
+
+/**
+ * Format a parsed name back to CLR syntax, assembly-qualifying generic arguments.
+ */
+export function formatTypeName(parsed: ParsedTypeName): string {
+  let text = parsed.name.replace(/[\\[\],*&]/g, c => `\\${c}`);
+  if (parsed.genericArguments.length > 0) {
+    const args = parsed.genericArguments.map(argument => `[${formatTypeName(argument)}]`);
+    text += `[${args.join(",")}]`;
+  }
+  for (const modifier of parsed.modifiers) {
+    if (modifier.kind === "array") {
+      text += modifier.rank === 1 ? "[]" : `[${",".repeat(modifier.rank - 1)}]`;
+    } else {
+      text += modifier.kind === "pointer" ? "*" : "&";
+    }
+  }
+  return parsed.assembly ? `${text}, ${parsed.assembly}` : text;
+}
+
+const TYPE_NAME_CACHE_CAPACITY = 2048;
@@ -1,7 +1,7 @@
 import { MonoEnums } from "../runtime/enums";
 import { lazy } from "../utils/cache";
 import { pointerIsNull } from "../utils/memory";
-import { readUtf8String } from "../utils/string";
+import { hashString, readUtf8String } from "../utils/string";
 import { MonoClass } from "./class";
 import { MonoHandle } from "./handle";
 
@@ -882,7 +882,27 @@ export class MonoType extends MonoHandle {
   }
 
   /**
-   * Check if types are equal (by comparing names).
+   * Hash of the type's canonical identity, consistent with {@link equals}.
+   *
+   * @remarks
+   * Uses `mono_metadata_type_hash`, so distinct `MonoType*` pointers for the
+   * same type (e.g. inflated generic instances) hash alike. Falls back to a
+   * hash of {@link fullName} when the export is missing.
+   */
+  @lazy
+  get identityHash(): number {
+    if (this.api.hasExport("mono_metadata_type_hash")) {
+      return (this.native.mono_metadata_type_hash(this.pointer) as number) >>> 0;
+    }
+    return hashString(this.fullName);
+  }
+
+  /**
+   * Check if types are equal.
+   *
+   * @remarks
+   * Compares with `mono_metadata_type_equal` (by-ref-ness included), falling
+   * back to {@link fullName} comparison when the export is missing.
    *
    * @param other Another type to compare
    * @returns true if types are equal
@@ -895,6 +915,12 @@ export class MonoType extends MonoHandle {
    * ```
    */
   equals(other: MonoType): boolean {
+    if (this.pointer.equals(other.pointer)) {
+      return true;
+    }
+    if (this.api.hasExport("mono_metadata_type_equal")) {
+      return (this.native.mono_metadata_type_equal(this.pointer, other.pointer) as number) !== 0;
+    }
     return this.fullName === other.fullName;
   }
 
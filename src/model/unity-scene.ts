@@ -0,0 +1,660 @@
+/**
+ * Unity scene-graph snapshots.
+ *
+ * Walking a scene through `MonoMethod.invoke` costs several lookups,
+ * allocations and thread-attachment checks per object. The
+ * {@link UnitySceneSnapshotter} resolves the UnityEngine methods it needs
+ * once, invokes them through reusable argument vectors inside a single
+ * attached context, and stores the result as flat, index-addressed columns.
+ *
+ * Refreshes re-walk the hierarchy (child identities, names, components and
+ * active flags) and use `Transform.hasChanged` only to reuse the pose of
+ * transforms that did not move: `hasChanged` tracks position, rotation and
+ * scale, not reparenting, renames or component changes.
+ *
+ * @module model/unity-scene
+ */
+
+import type { MonoApi } from "../runtime/api";
+import { MonoErrorCodes, MonoManagedExceptionError, raise } from "../utils/errors";
+import { Logger } from "../utils/log";
+import { pointerIsNull } from "../utils/memory";
+import { MonoArray } from "./array";
+import { MonoClass } from "./class";
+import { MonoDomain } from "./domain";
+import type { MonoMethod } from "./method";
+import { MonoObject } from "./object";
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+/** Coordinate space for snapshot positions and rotations. */
+export type SceneSpace = "world" | "local";
+
+/** Options for {@link UnitySceneSnapshotter.snapshot}. */
+export interface SceneSnapshotOptions {
+  /** GameObjects or Transforms to start from. Default: root objects of the active scene */
+  roots?: ReadonlyArray<MonoObject | NativePointer>;
+  /** Record component classes per object. Default: true */
+  components?: boolean;
+  /** Record positions and rotations. Default: true */
+  transforms?: boolean;
+  /** Coordinate space for positions and rotations. Default: "world" */
+  space?: SceneSpace;
+  /** Stop after this many objects. Default: 100000 */
+  maxObjects?: number;
+  /**
+   * Clear `Transform.hasChanged` on every visited transform so a later
+   * {@link UnitySceneSnapshotter.refresh} can reuse the pose of unmoved transforms.
+   * Game code that reads `hasChanged` itself will observe the reset.
+   * Default: false (refreshes inherit the previous snapshot's setting)
+   */
+  trackChanges?: boolean;
+}
+
+type ResolvedSnapshotOptions = Required<Omit<SceneSnapshotOptions, "roots">>;
+
+/** Resolved UnityEngine entry points. */
+interface SceneBindings {
+  gameObjectClass: MonoClass;
+  getTransform: NativePointer;
+  getGameObject: NativePointer;
+  getName: NativePointer;
+  getActiveSelf: NativePointer;
+  getChildCount: NativePointer;
+  getChild: NativePointer;
+  getComponents: NativePointer | null;
+  componentType: NativePointer;
+  world: PoseAccessors;
+  local: PoseAccessors;
+  getHasChanged: NativePointer | null;
+  setHasChanged: NativePointer | null;
+  getActiveScene: NativePointer | null;
+  getRootGameObjects: NativePointer | null;
+  findObjectsOfType: NativePointer | null;
+  transformType: NativePointer;
+  getParent: NativePointer | null;
+}
+
+/** Either a combined out-parameter getter or a position/rotation getter pair. */
+interface PoseAccessors {
+  combined: NativePointer | null;
+  position: NativePointer;
+  rotation: NativePointer;
+}
+
+const sceneLogger = Logger.withTag("UnityScene");
+
+// =============================================================================
+// SNAPSHOT
+// =============================================================================
+
+/**
+ * Columnar scene-graph snapshot.
+ *
+ * Row `i` describes one GameObject; rows are in depth-first pre-order, so a
+ * parent always precedes its children.
+ */
+export class SceneSnapshot {
+  constructor(
+    /** GameObject instance per row */
+    readonly gameObjects: NativePointer[],
+    /** Transform instance per row */
+    readonly transforms: NativePointer[],
+    /** Row of the parent, or -1 for roots */
+    readonly parents: Int32Array,
+    readonly names: string[],
+    /** `GameObject.activeSelf` per row (0/1) */
+    readonly active: Uint8Array,
+    readonly childCounts: Int32Array,
+    /** Components of row `i` are `componentClassIds[componentStart[i] .. componentStart[i + 1])` */
+    readonly componentStart: Uint32Array,
+    readonly componentClassIds: Uint32Array,
+    /** Component classes indexed by class id; shared by all snapshots of one snapshotter */
+    readonly componentClasses: readonly MonoClass[],
+    /** x, y, z per row (empty when transforms were not captured) */
+    readonly positions: Float32Array,
+    /** x, y, z, w per row (empty when transforms were not captured) */
+    readonly rotations: Float32Array,
+    /** Rows whose pose was read from the runtime rather than reused from a previous snapshot */
+    readonly revisited: number,
+    readonly options: Readonly<ResolvedSnapshotOptions>,
+    readonly timestamp: number,
+  ) {}
+
+  /** Number of rows. */
+  get count(): number {
+    return this.gameObjects.length;
+  }
+
+  /**
+   * Row of a GameObject or Transform.
+   * @returns Row index, or -1 when not part of the snapshot
+   */
+  indexOf(instance: MonoObject | NativePointer): number {
+    const pointer = instance instanceof MonoObject ? instance.pointer : instance;
+    for (let i = 0; i < this.gameObjects.length; i++) {
+      if (this.gameObjects[i].equals(pointer) || this.transforms[i].equals(pointer)) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  /** Component classes attached to a row. */
+  componentsOf(index: number): MonoClass[] {
+    const result: MonoClass[] = [];
+    for (let i = this.componentStart[index]; i < this.componentStart[index + 1]; i++) {
+      result.push(this.componentClasses[this.componentClassIds[i]]);
+    }
+    return result;
+  }
+
+  /** Rows of the direct children of a row, in sibling order. */
+  childrenOf(index: number): number[] {
+    const result: number[] = [];
+    for (let i = index + 1; i < this.parents.length && result.length < this.childCounts[index]; i++) {
+      if (this.parents[i] === index) {
+        result.push(i);
+      }
+    }
+    return result;
+  }
+}
+
+/** Row buffers filled during a traversal. */
+class SnapshotBuilder {
+  readonly gameObjects: NativePointer[] = [];
+  readonly transforms: NativePointer[] = [];
+  readonly parents: number[] = [];
+  readonly names: string[] = [];
+  readonly active: number[] = [];
+  readonly childCounts: number[] = [];
+  readonly componentStart: number[] = [0];
+  readonly componentClassIds: number[] = [];
+  readonly positions: number[] = [];
+  readonly rotations: number[] = [];
+  revisited = 0;
+
+  get count(): number {
+    return this.gameObjects.length;
+  }
+
+  build(classes: readonly MonoClass[], options: ResolvedSnapshotOptions): SceneSnapshot {
+    return new SceneSnapshot(
+      this.gameObjects,
+      this.transforms,
+      Int32Array.from(this.parents),
+      this.names,
+      Uint8Array.from(this.active),
+      Int32Array.from(this.childCounts),
+      Uint32Array.from(this.componentStart),
+      Uint32Array.from(this.componentClassIds),
+      classes,
+      Float32Array.from(this.positions),
+      Float32Array.from(this.rotations),
+      this.revisited,
+      options,
+      Date.now(),
+    );
+  }
+}
+
+/** Pending traversal entry: a transform and the row of its parent. */
+interface VisitEntry {
+  transform: NativePointer;
+  parent: number;
+  /** Row in the previous snapshot, when known */
+  previous: number;
+}
+
+// =============================================================================
+// SNAPSHOTTER
+// =============================================================================
+
+/**
+ * Batched scene-graph reader.
+ *
+ * @example
+ * ```typescript
+ * const snapshotter = new UnitySceneSnapshotter(api);
+ * let scene = snapshotter.snapshot({ trackChanges: true });
+ * console.log(`${scene.count} objects`);
+ * // Later: poses of unmoved transforms are reused
+ * scene = snapshotter.refresh(scene);
+ * ```
+ */
+export class UnitySceneSnapshotter {
+  private bindings: SceneBindings | null | undefined = undefined;
+  private readonly classIds = new Map<string, number>();
+  private readonly classes: MonoClass[] = [];
+  private readonly argv: NativePointer;
+  private readonly intSlot: NativePointer;
+  private readonly boolSlot: NativePointer;
+  private readonly poseBuffer: NativePointer;
+
+  constructor(private readonly api: MonoApi) {
+    this.argv = Memory.alloc(Process.pointerSize * 2);
+    this.intSlot = Memory.alloc(4);
+    this.boolSlot = Memory.alloc(4);
+    // Vector3 + Quaternion out-parameters
+    this.poseBuffer = Memory.alloc(POSE_FLOATS * 4);
+  }
+
+  /** Whether the UnityEngine types needed for snapshots are loaded. */
+  get isAvailable(): boolean {
+    return this.resolve() !== null;
+  }
+
+  /**
+   * Capture the scene graph below `options.roots` (default: active scene roots).
+   * @throws {MonoError} NOT_SUPPORTED when UnityEngine is not loaded
+   */
+  snapshot(options: SceneSnapshotOptions = {}): SceneSnapshot {
+    const bindings = this.requireBindings();
+    const resolved = resolveOptions(options);
+    return this.runAttached(() => {
+      const roots = this.resolveRoots(bindings, options.roots);
+      return this.traverse(bindings, roots, resolved, null);
+    });
+  }
+
+  /**
+   * Re-capture a scene, reusing the position and rotation of rows in
+   * `previous` whose transform did not move (`Transform.hasChanged` is false).
+   *
+   * The hierarchy is walked again through `GetChild`, and names, components
+   * and active flags are re-read for every row, because `hasChanged` does not
+   * report reparenting, replaced children, renames or component changes.
+   * Pass a snapshot taken with `trackChanges: true` (or an earlier refresh of
+   * one) so that unmoved transforms are recognized; without it `hasChanged` is
+   * left untouched and only transforms that never moved are reused.
+   */
+  refresh(previous: SceneSnapshot, options: SceneSnapshotOptions = {}): SceneSnapshot {
+    const bindings = this.requireBindings();
+    const resolved = resolveOptions({ ...previous.options, ...options });
+    return this.runAttached(() => {
+      const roots = options.roots ? this.resolveRoots(bindings, options.roots) : previousRoots(previous);
+      return this.traverse(bindings, roots, resolved, canReuse(previous.options, resolved) ? previous : null);
+    });
+  }
+
+  /** Forget resolved methods and interned component classes. */
+  clearCache(): void {
+    this.bindings = undefined;
+    this.classIds.clear();
+    this.classes.length = 0;
+  }
+
+  // ===== TRAVERSAL =====
+
+  private traverse(
+    bindings: SceneBindings,
+    roots: NativePointer[],
+    options: ResolvedSnapshotOptions,
+    previous: SceneSnapshot | null,
+  ): SceneSnapshot {
+    const builder = new SnapshotBuilder();
+    const previousRows = previous ? indexTransforms(previous) : null;
+    const stack: VisitEntry[] = [];
+    for (let i = roots.length - 1; i >= 0; i--) {
+      stack.push({ transform: roots[i], parent: -1, previous: lookupRow(previousRows, roots[i]) });
+    }
+
+    // Engine objects keep their managed wrappers alive, so pending pointers survive a safepoint
+    const safepoints = this.api.getThreadManager()?.safepoints.scope();
+    try {
+      while (stack.length > 0 && builder.count < options.maxObjects) {
+        safepoints?.poll();
+        const entry = stack.pop()!;
+        try {
+          const children = this.visit(bindings, builder, entry, options, previous);
+          const row = builder.count - 1;
+          for (let i = children.length - 1; i >= 0; i--) {
+            stack.push({ transform: children[i], parent: row, previous: lookupRow(previousRows, children[i]) });
+          }
+        } catch (error) {
+          // Destroyed objects throw MissingReferenceException; skip the subtree
+          if (error instanceof MonoManagedExceptionError) {
+            error.release();
+            sceneLogger.debug(`Skipping ${entry.transform}: ${error.message}`);
+            continue;
+          }
+          throw error;
+        }
+      }
+    } finally {
+      safepoints?.end();
+    }
+
+    if (stack.length > 0) {
+      sceneLogger.warn(`Scene snapshot truncated at ${options.maxObjects} objects`);
+    }
+    return builder.build(this.classes, options);
+  }
+
+  /** Append one row and return the row's child transforms. */
+  private visit(
+    bindings: SceneBindings,
+    builder: SnapshotBuilder,
+    entry: VisitEntry,
+    options: ResolvedSnapshotOptions,
+    previous: SceneSnapshot | null,
+  ): NativePointer[] {
+    const transform = entry.transform;
+    const changed = !bindings.getHasChanged || this.readBool(bindings.getHasChanged, transform);
+    const childCount = this.readInt(bindings.getChildCount, transform);
+    const gameObject = this.invoke(bindings.getGameObject, transform);
+    // A matching GameObject guards against a destroyed transform's address being reused
+    const reusePose =
+      options.transforms &&
+      previous !== null &&
+      entry.previous >= 0 &&
+      !changed &&
+      previous.gameObjects[entry.previous].equals(gameObject);
+
+    builder.gameObjects.push(gameObject);
+    builder.transforms.push(transform);
+    builder.parents.push(entry.parent);
+    builder.childCounts.push(childCount);
+    builder.active.push(this.readBool(bindings.getActiveSelf, gameObject) ? 1 : 0);
+    builder.names.push(this.readName(bindings, gameObject));
+    if (options.components) {
+      this.readComponents(bindings, builder, gameObject);
+    }
+    builder.componentStart.push(builder.componentClassIds.length);
+
+    if (reusePose && previous) {
+      copyPose(builder, previous, entry.previous);
+    } else {
+      builder.revisited++;
+      if (options.transforms) {
+        this.readPose(options.space === "world" ? bindings.world : bindings.local, builder, transform);
+      }
+    }
+
+    if (options.trackChanges && changed && bindings.setHasChanged) {
+      this.boolSlot.writeU8(0);
+      this.argv.writePointer(this.boolSlot);
+      this.api.runtimeInvokeArgv(bindings.setHasChanged, transform, this.argv);
+    }
+
+    const children = new Array<NativePointer>(childCount);
+    for (let i = 0; i < childCount; i++) {
+      this.intSlot.writeS32(i);
+      this.argv.writePointer(this.intSlot);
+      children[i] = this.api.runtimeInvokeArgv(bindings.getChild, transform, this.argv);
+    }
+    return children;
+  }
+
+  private readName(bindings: SceneBindings, gameObject: NativePointer): string {
+    const name = this.invoke(bindings.getName, gameObject);
+    return pointerIsNull(name) ? "" : this.api.readMonoString(name, true);
+  }
+
+  private readComponents(bindings: SceneBindings, builder: SnapshotBuilder, gameObject: NativePointer): void {
+    if (!bindings.getComponents) {
+      return;
+    }
+    this.argv.writePointer(bindings.componentType);
+    const arrayPtr = this.api.runtimeInvokeArgv(bindings.getComponents, gameObject, this.argv);
+    if (pointerIsNull(arrayPtr)) {
+      return;
+    }
+    const array = new MonoArray(this.api, arrayPtr);
+    const length = array.length;
+    if (length === 0) {
+      return;
+    }
+    const base = array.getElementAddress(0);
+    for (let i = 0; i < length; i++) {
+      const component = base.add(i * Process.pointerSize).readPointer();
+      if (!pointerIsNull(component)) {
+        builder.componentClassIds.push(this.internClass(this.api.native.mono_object_get_class(component)));
+      }
+    }
+  }
+
+  private readPose(accessors: PoseAccessors, builder: SnapshotBuilder, transform: NativePointer): void {
+    const buffer = this.poseBuffer;
+    if (accessors.combined) {
+      this.argv.writePointer(buffer);
+      this.argv.add(Process.pointerSize).writePointer(buffer.add(12));
+      this.api.runtimeInvokeArgv(accessors.combined, transform, this.argv);
+    } else {
+      copyUnboxed(this.api, this.invoke(accessors.position, transform), buffer, 12);
+      copyUnboxed(this.api, this.invoke(accessors.rotation, transform), buffer.add(12), 16);
+    }
+    const pose = new Float32Array(buffer.readByteArray(POSE_FLOATS * 4)!);
+    builder.positions.push(pose[0], pose[1], pose[2]);
+    builder.rotations.push(pose[3], pose[4], pose[5], pose[6]);
+  }
+
+  // ===== ROOTS =====
+
+  private resolveRoots(bindings: SceneBindings, roots?: ReadonlyArray<MonoObject | NativePointer>): NativePointer[] {
+    if (roots) {
+      return roots.map(root => {
+        const pointer = root instanceof MonoObject ? root.pointer : root;
+        const isGameObject = !pointerIsNull(
+          this.api.native.mono_object_isinst(pointer, bindings.gameObjectClass.pointer) as NativePointer,
+        );
+        return isGameObject ? this.invoke(bindings.getTransform, pointer) : pointer;
+      });
+    }
+
+    if (bindings.getActiveScene && bindings.getRootGameObjects) {
+      const boxedScene = this.invoke(bindings.getActiveScene, NULL);
+      const scene = this.api.native.mono_object_unbox(boxedScene) as NativePointer;
+      const gameObjects = this.invoke(bindings.getRootGameObjects, scene);
+      return this.readObjectArray(gameObjects).map(go => this.invoke(bindings.getTransform, go));
+    }
+
+    if (bindings.findObjectsOfType && bindings.getParent) {
+      this.argv.writePointer(bindings.transformType);
+      const transforms = this.api.runtimeInvokeArgv(bindings.findObjectsOfType, NULL, this.argv);
+      const getParent = bindings.getParent;
+      return this.readObjectArray(transforms).filter(t => pointerIsNull(this.invoke(getParent, t)));
+    }
+
+    raise(
+      MonoErrorCodes.NOT_SUPPORTED,
+      "Cannot enumerate scene roots in this Unity version",
+      "Pass options.roots explicitly",
+    );
+  }
+
+  private readObjectArray(arrayPtr: NativePointer): NativePointer[] {
+    if (pointerIsNull(arrayPtr)) {
+      return [];
+    }
+    const array = new MonoArray(this.api, arrayPtr);
+    const length = array.length;
+    const result: NativePointer[] = [];
+    if (length === 0) {
+      return result;
+    }
+    const base = array.getElementAddress(0);
+    for (let i = 0; i < length; i++) {
+      const element = base.add(i * Process.pointerSize).readPointer();
+      if (!pointerIsNull(element)) {
+        result.push(element);
+      }
+    }
+    return result;
+  }
+
+  // ===== INVOCATION =====
+
+  private invoke(method: NativePointer, instance: NativePointer): NativePointer {
+    return this.api.runtimeInvokeArgv(method, instance, NULL);
+  }
+
+  private readInt(method: NativePointer, instance: NativePointer): number {
+    const boxed = this.invoke(method, instance);
+    return (this.api.native.mono_object_unbox(boxed) as NativePointer).readS32();
+  }
+
+  private readBool(method: NativePointer, instance: NativePointer): boolean {
+    const boxed = this.invoke(method, instance);
+    return (this.api.native.mono_object_unbox(boxed) as NativePointer).readU8() !== 0;
+  }
+
+  private internClass(classPtr: NativePointer): number {
+    const key = classPtr.toString();
+    let id = this.classIds.get(key);
+    if (id === undefined) {
+      id = this.classes.length;
+      this.classes.push(new MonoClass(this.api, classPtr));
+      this.classIds.set(key, id);
+    }
+    return id;
+  }
+
+  private runAttached<T>(fn: () => T): T {
+    const manager = this.api.getThreadManager();
+    return manager ? manager.runIfNeeded(fn) : fn();
+  }
+
+  // ===== BINDINGS =====
+
+  private requireBindings(): SceneBindings {
+    const bindings = this.resolve();
+    if (!bindings) {
+      raise(
+        MonoErrorCodes.NOT_SUPPORTED,
+        "UnityEngine scene types are not available",
+        "Scene snapshots require a Unity player with UnityEngine.CoreModule loaded",
+      );
+    }
+    return bindings;
+  }
+
+  private resolve(): SceneBindings | null {
+    if (this.bindings === undefined) {
+      try {
+        this.bindings = this.runAttached(() => this.resolveBindings());
+      } catch (error) {
+        sceneLogger.debug(`Unity scene bindings unavailable: ${error}`);
+        this.bindings = null;
+      }
+    }
+    return this.bindings;
+  }
+
+  private resolveBindings(): SceneBindings | null {
+    const domain = MonoDomain.getRoot(this.api);
+    const gameObjectClass = domain.tryClass("UnityEngine.GameObject");
+    const transformClass = domain.tryClass("UnityEngine.Transform");
+    const componentClass = domain.tryClass("UnityEngine.Component");
+    const objectClass = domain.tryClass("UnityEngine.Object");
+    if (!gameObjectClass || !transformClass || !componentClass || !objectClass) {
+      return null;
+    }
+
+    const sceneManager = domain.tryClass("UnityEngine.SceneManagement.SceneManager");
+    const sceneStruct = domain.tryClass("UnityEngine.SceneManagement.Scene");
+    const getComponents = gameObjectClass.methods.find(
+      m => m.name === "GetComponents" && m.parameterCount === 1 && m.parameterTypes[0].name === "System.Type",
+    );
+    const findObjectsOfType = objectClass.methods.find(
+      m => m.name === "FindObjectsOfType" && m.parameterCount === 1 && m.parameterTypes[0].name === "System.Type",
+    );
+    const rootDomain = this.api.getRootDomain();
+
+    return {
+      gameObjectClass,
+      getTransform: gameObjectClass.method("get_transform", 0).pointer,
+      getGameObject: componentClass.method("get_gameObject", 0).pointer,
+      getName: objectClass.method("get_name", 0).pointer,
+      getActiveSelf: gameObjectClass.method("get_activeSelf", 0).pointer,
+      getChildCount: transformClass.method("get_childCount", 0).pointer,
+      getChild: transformClass.method("GetChild", 1).pointer,
+      getComponents: getComponents ? getComponents.pointer : null,
+      componentType: this.typeObject(rootDomain, componentClass),
+      world: resolvePose(transformClass, "GetPositionAndRotation", "get_position", "get_rotation"),
+      local: resolvePose(transformClass, "GetLocalPositionAndRotation", "get_localPosition", "get_localRotation"),
+      getHasChanged: pointerOf(transformClass.tryMethod("get_hasChanged", 0)),
+      setHasChanged: pointerOf(transformClass.tryMethod("set_hasChanged", 1)),
+      getActiveScene: pointerOf(sceneManager?.tryMethod("GetActiveScene", 0) ?? null),
+      getRootGameObjects: pointerOf(sceneStruct?.tryMethod("GetRootGameObjects", 0) ?? null),
+      findObjectsOfType: findObjectsOfType ? findObjectsOfType.pointer : null,
+      transformType: this.typeObject(rootDomain, transformClass),
+      getParent: pointerOf(transformClass.tryMethod("get_parent", 0)),
+    };
+  }
+
+  /** `typeof(T)` for a class; reflection type objects are cached by the runtime and never collected. */
+  private typeObject(domain: NativePointer, klass: MonoClass): NativePointer {
+    return this.api.native.mono_type_get_object(domain, klass.type.pointer) as NativePointer;
+  }
+}
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+function resolveOptions(options: SceneSnapshotOptions): ResolvedSnapshotOptions {
+  return {
+    components: options.components ?? true,
+    transforms: options.transforms ?? true,
+    space: options.space ?? "world",
+    maxObjects: options.maxObjects ?? DEFAULT_MAX_OBJECTS,
+    trackChanges: options.trackChanges ?? false,
+  };
+}
+
+function resolvePose(transformClass: MonoClass, combined: string, position: string, rotation: string): PoseAccessors {
+  return {
+    combined: pointerOf(transformClass.tryMethod(combined, 2)),
+    position: transformClass.method(position, 0).pointer,
+    rotation: transformClass.method(rotation, 0).pointer,
+  };
+}
+
+/** Rows can only be reused when they hold every column the new snapshot needs. */
+function canReuse(previous: ResolvedSnapshotOptions, next: ResolvedSnapshotOptions): boolean {
+  return previous.transforms && next.transforms && previous.space === next.space;
+}
+
+function copyPose(builder: SnapshotBuilder, previous: SceneSnapshot, row: number): void {
+  builder.positions.push(...previous.positions.subarray(row * 3, row * 3 + 3));
+  builder.rotations.push(...previous.rotations.subarray(row * 4, row * 4 + 4));
+}
+
+function pointerOf(method: MonoMethod | null): NativePointer | null {
+  return method ? method.pointer : null;
+}
+
+function copyUnboxed(api: MonoApi, boxed: NativePointer, target: NativePointer, size: number): void {
+  Memory.copy(target, api.native.mono_object_unbox(boxed) as NativePointer, size);
+}
+
+function previousRoots(snapshot: SceneSnapshot): NativePointer[] {
+  const roots: NativePointer[] = [];
+  for (let i = 0; i < snapshot.parents.length; i++) {
+    if (snapshot.parents[i] === -1) {
+      roots.push(snapshot.transforms[i]);
+    }
+  }
+  return roots;
+}
+
+function indexTransforms(snapshot: SceneSnapshot): Map<string, number> {
+  const rows = new Map<string, number>();
+  for (let i = 0; i < snapshot.transforms.length; i++) {
+    rows.set(snapshot.transforms[i].toString(), i);
+  }
+  return rows;
+}
+
+function lookupRow(rows: Map<string, number> | null, transform: NativePointer): number {
+  return rows?.get(transform.toString()) ?? -1;
+}
+
+/** Vector3 position followed by a Quaternion rotation. */
+const POSE_FLOATS = 7;
+
+const DEFAULT_MAX_OBJECTS = 100_000;
@@ -0,0 +1,266 @@
+/**
+ * Unity value-type readers.
+ *
+ * The common UnityEngine math structs are plain sequences of 32-bit floats,
+ * so they can be decoded straight into `Float32Array`s instead of going
+ * through `unboxValue` and per-field JS objects. {@link UnityTransformReader}
+ * builds on that to read positions or rotations of many transforms into one
+ * packed array per call.
+ *
+ * @module model/unity-values
+ */
+
+import type { MonoApi } from "../runtime/api";
+import { MonoErrorCodes, MonoManagedExceptionError, raise } from "../utils/errors";
+import { pointerIsNull } from "../utils/memory";
+import type { MonoArray } from "./array";
+import type { MonoClass } from "./class";
+import { MonoDomain } from "./domain";
+import { MonoObject } from "./object";
+import type { SceneSpace } from "./unity-scene";
+
+// =============================================================================
+// STRUCT LAYOUTS
+// =============================================================================
+
+/** UnityEngine structs with a known all-float layout. */
+export const UnityStruct = Object.freeze({
+  Vector2: "Vector2",
+  Vector3: "Vector3",
+  Vector4: "Vector4",
+  Quaternion: "Quaternion",
+  Color: "Color",
+  Matrix4x4: "Matrix4x4",
+  Rect: "Rect",
+} as const);
+
+export type UnityStruct = (typeof UnityStruct)[keyof typeof UnityStruct];
+
+/**
+ * Float count per struct, in field order:
+ * Vector2..4 (x, y[, z[, w]]), Quaternion (x, y, z, w), Color (r, g, b, a),
+ * Matrix4x4 (m00, m10, m20, m30, m01, ... column-major), Rect (x, y, width, height).
+ */
+export const UNITY_STRUCT_FLOATS: Readonly<Record<UnityStruct, number>> = Object.freeze({
+  Vector2: 2,
+  Vector3: 3,
+  Vector4: 4,
+  Quaternion: 4,
+  Color: 4,
+  Matrix4x4: 16,
+  Rect: 4,
+});
+
+/**
+ * Identify a supported UnityEngine struct.
+ * @returns The struct kind, or null for any other class
+ */
+export function unityStructOf(klass: MonoClass): UnityStruct | null {
+  if (klass.namespace !== "UnityEngine") {
+    return null;
+  }
+  const name = klass.name as UnityStruct;
+  return Object.prototype.hasOwnProperty.call(UNITY_STRUCT_FLOATS, name) ? name : null;
+}
+
+/**
+ * Decode one struct from unboxed storage.
+ *
+ * @param address Start of the struct data (e.g. `mono_object_unbox` result or a field address)
+ * @param struct Struct kind
+ * @param target Destination array; a new one is allocated when omitted
+ * @param index Element index within `target` (in structs, not floats)
+ * @returns `target`
+ */
+export function readUnityStruct(
+  address: NativePointer,
+  struct: UnityStruct,
+  target?: Float32Array,
+  index = 0,
+): Float32Array {
+  const floats = UNITY_STRUCT_FLOATS[struct];
+  const out = target ?? new Float32Array(floats);
+  out.set(new Float32Array(address.readByteArray(floats * 4)!), index * floats);
+  return out;
+}
+
+/**
+ * Decode a managed array of structs (e.g. `Vector3[]`) with one bulk copy.
+ * @returns Packed floats, `length * UNITY_STRUCT_FLOATS[struct]` long
+ * @throws {MonoError} TYPE_MISMATCH when the element type is not a supported struct
+ */
+export function readUnityStructArray(array: MonoArray, struct?: UnityStruct): Float32Array {
+  const kind = struct ?? unityStructOf(array.elementClass);
+  if (!kind) {
+    raise(
+      MonoErrorCodes.TYPE_MISMATCH,
+      `Array element type ${array.elementClass.fullName} is not a supported Unity struct`,
+      `Supported: ${Object.keys(UNITY_STRUCT_FLOATS).join(", ")}`,
+    );
+  }
+  const floats = UNITY_STRUCT_FLOATS[kind];
+  if (array.elementSize !== floats * 4) {
+    raise(
+      MonoErrorCodes.TYPE_MISMATCH,
+      `Array element size ${array.elementSize} does not match ${kind} (${floats * 4} bytes)`,
+    );
+  }
+  const length = array.length;
+  if (length === 0) {
+    return new Float32Array(0);
+  }
+  return new Float32Array(array.getElementAddress(0).readByteArray(length * floats * 4)!);
+}
+
+// =============================================================================
+// TRANSFORM READER
+// =============================================================================
+
+/** A resolved getter: out-parameter form (writes into the caller's buffer) or boxed return. */
+interface StructGetter {
+  method: NativePointer;
+  outParameter: boolean;
+}
+
+type TransformProperty = "position" | "rotation";
+
+/**
+ * Batched transform position/rotation reader.
+ *
+ * Prefers the `*_Injected(out T)` getters Unity generates for its bindings,
+ * which write straight into a native buffer shared by the whole batch; falls
+ * back to the public property getters and copies out of the returned box.
+ * Rows whose transform throws (typically destroyed objects) are filled with NaN.
+ *
+ * @example
+ * ```typescript
+ * const reader = new UnityTransformReader(api);
+ * const xyz = reader.positions(transforms); // Float32Array, 3 floats per transform
+ * ```
+ */
+export class UnityTransformReader {
+  private readonly getters = new Map<string, StructGetter>();
+  private readonly argv: NativePointer;
+  private scratch: NativePointer = NULL;
+  private scratchSize = 0;
+  private transformClass: MonoClass | null | undefined = undefined;
+
+  constructor(private readonly api: MonoApi) {
+    this.argv = Memory.alloc(Process.pointerSize);
+  }
+
+  /** Whether `UnityEngine.Transform` is loaded. */
+  get isAvailable(): boolean {
+    return this.resolveTransformClass() !== null;
+  }
+
+  /**
+   * Read positions of many transforms.
+   * @returns x, y, z per transform
+   */
+  positions(transforms: ReadonlyArray<MonoObject | NativePointer>, space: SceneSpace = "world"): Float32Array {
+    return this.read(transforms, "position", space, UnityStruct.Vector3);
+  }
+
+  /**
+   * Read rotations of many transforms.
+   * @returns x, y, z, w per transform
+   */
+  rotations(transforms: ReadonlyArray<MonoObject | NativePointer>, space: SceneSpace = "world"): Float32Array {
+    return this.read(transforms, "rotation", space, UnityStruct.Quaternion);
+  }
+
+  /** Forget resolved getters and release the scratch buffer. */
+  clearCache(): void {
+    this.getters.clear();
+    this.transformClass = undefined;
+    this.scratch = NULL;
+    this.scratchSize = 0;
+  }
+
+  // ===== INTERNAL =====
+
+  private read(
+    transforms: ReadonlyArray<MonoObject | NativePointer>,
+    property: TransformProperty,
+    space: SceneSpace,
+    struct: UnityStruct,
+  ): Float32Array {
+    const count = transforms.length;
+    const stride = UNITY_STRUCT_FLOATS[struct] * 4;
+    if (count === 0) {
+      return new Float32Array(0);
+    }
+
+    const getter = this.resolveGetter(property, space);
+    const buffer = this.ensureScratch(count * stride);
+    const run = () => {
+      const safepoints = this.api.getThreadManager()?.safepoints.scope();
+      try {
+        for (let i = 0; i < count; i++) {
+          safepoints?.poll();
+          const transform = transforms[i];
+          const pointer = transform instanceof MonoObject ? transform.pointer : transform;
+          const slot = buffer.add(i * stride);
+          try {
+            if (getter.outParameter) {
+              this.argv.writePointer(slot);
+              this.api.runtimeInvokeArgv(getter.method, pointer, this.argv);
+            } else {
+              const boxed = this.api.runtimeInvokeArgv(getter.method, pointer, NULL);
+              Memory.copy(slot, this.api.native.mono_object_unbox(boxed) as NativePointer, stride);
+            }
+          } catch (error) {
+            if (!(error instanceof MonoManagedExceptionError)) {
+              throw error;
+            }
+            error.release();
+            for (let offset = 0; offset < stride; offset += 4) {
+              slot.add(offset).writeFloat(NaN);
+            }
+          }
+        }
+      } finally {
+        safepoints?.end();
+      }
+      return new Float32Array(buffer.readByteArray(count * stride)!);
+    };
+
+    const manager = this.api.getThreadManager();
+    return manager ? manager.runIfNeeded(run) : run();
+  }
+
+  private resolveGetter(property: TransformProperty, space: SceneSpace): StructGetter {
+    const name = space === "local" ? `local${property[0].toUpperCase()}${property.slice(1)}` : property;
+    let getter = this.getters.get(name);
+    if (!getter) {
+      const klass = this.resolveTransformClass();
+      if (!klass) {
+        raise(MonoErrorCodes.NOT_SUPPORTED, "UnityEngine.Transform is not available");
+      }
+      const injected = klass.tryMethod(`get_${name}_Injected`, 1);
+      getter = injected
+        ? { method: injected.pointer, outParameter: true }
+        : { method: klass.method(`get_${name}`, 0).pointer, outParameter: false };
+      this.getters.set(name, getter);
+    }
+    return getter;
+  }
+
+  private resolveTransformClass(): MonoClass | null {
+    if (this.transformClass === undefined) {
+      this.transformClass = MonoDomain.getRoot(this.api).tryClass("UnityEngine.Transform");
+    }
+    return this.transformClass;
+  }
+
+  private ensureScratch(size: number): NativePointer {
+    if (size > this.scratchSize || pointerIsNull(this.scratch)) {
+      this.scratchSize = Math.max(size, this.scratchSize * 2, MIN_SCRATCH_BYTES);
+      this.scratch = Memory.alloc(this.scratchSize);
+    }
+    return this.scratch;
+  }
+}
+
+const MIN_SCRATCH_BYTES = 4096;
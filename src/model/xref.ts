@@ -0,0 +1,728 @@
+/**
+ * IL cross-reference index (static call graph and field access queries).
+ *
+ * Scans the IL body of every method defined in an image via `mono_method_get_header` /
+ * `mono_method_header_get_code` and records the operand tokens of call-like and field
+ * access instructions. Edges are kept in flat typed arrays (CSR layout by caller plus a
+ * permutation sorted by target token), so "who calls X" is a binary search once built.
+ *
+ * The index only stores image-local metadata tokens, which makes it serializable with
+ * {@link ILXrefIndex.toBuffer} and reloadable as long as the image GUID matches.
+ *
+ * @module model/xref
+ */
+
+import { MethodAttribute, MethodImplAttribute } from "../runtime/metadata";
+import { MonoErrorCodes, raise } from "../utils/errors";
+import { Logger } from "../utils/log";
+import { pointerIsNull } from "../utils/memory";
+import { hashString, readUtf8String } from "../utils/string";
+import { MonoField } from "./field";
+import type { MonoImage } from "./image";
+import { MonoMethod } from "./method";
+
+const xrefLogger = Logger.withTag("ILXref");
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+/**
+ * Kind of IL instruction that produced a cross-reference.
+ */
+export const ILXrefKind = Object.freeze({
+  /** `call` */
+  Call: 0,
+  /** `callvirt` */
+  CallVirt: 1,
+  /** `newobj` */
+  NewObj: 2,
+  /** `ldftn` / `ldvirtftn` (delegate creation) */
+  LoadFunction: 3,
+  /** `ldfld` / `ldsfld` */
+  LoadField: 4,
+  /** `ldflda` / `ldsflda` */
+  LoadFieldAddress: 5,
+  /** `stfld` / `stsfld` */
+  StoreField: 6,
+} as const);
+
+export type ILXrefKind = (typeof ILXrefKind)[keyof typeof ILXrefKind];
+
+/**
+ * A single cross-reference edge.
+ */
+export interface ILXref {
+  /** MethodDef token of the method containing the instruction */
+  callerToken: number;
+  /** Operand token (MethodDef, MemberRef, MethodSpec or FieldDef) */
+  targetToken: number;
+  /** Instruction kind */
+  kind: ILXrefKind;
+  /** IL offset of the instruction within the caller body */
+  ilOffset: number;
+}
+
+/**
+ * Statistics collected while building an index.
+ */
+export interface ILXrefStats {
+  /** Number of MethodDef rows in the image */
+  methodCount: number;
+  /** Number of methods that had an IL body */
+  methodsWithBody: number;
+  /** Total number of recorded edges */
+  edgeCount: number;
+  /** Total IL bytes decoded */
+  ilBytes: number;
+  /** Build (or load) time in milliseconds */
+  buildTimeMs: number;
+}
+
+// ============================================================================
+// IL OPCODE TABLE
+// ============================================================================
+
+/** Operand size marker for the variable-length `switch` opcode. */
+const OPERAND_SWITCH = 0xfe;
+/** Operand size marker for unassigned opcodes (decoding stops). */
+const OPERAND_INVALID = 0xff;
+
+/**
+ * Operand byte sizes for single-byte opcodes (ECMA-335 Partition III).
+ */
+const ONE_BYTE_OPERANDS = buildOperandTable([
+  [0x0e, 0x13, 1], // ldarg.s .. stloc.s
+  [0x1f, 0x1f, 1], // ldc.i4.s
+  [0x20, 0x20, 4], // ldc.i4
+  [0x21, 0x21, 8], // ldc.i8
+  [0x22, 0x22, 4], // ldc.r4
+  [0x23, 0x23, 8], // ldc.r8
+  [0x24, 0x24, OPERAND_INVALID],
+  [0x27, 0x29, 4], // jmp, call, calli
+  [0x2b, 0x37, 1], // short branches
+  [0x38, 0x44, 4], // long branches
+  [0x45, 0x45, OPERAND_SWITCH],
+  [0x6f, 0x75, 4], // callvirt, cpobj, ldobj, ldstr, newobj, castclass, isinst
+  [0x77, 0x78, OPERAND_INVALID],
+  [0x79, 0x79, 4], // unbox
+  [0x7b, 0x81, 4], // ldfld .. stobj
+  [0x8c, 0x8d, 4], // box, newarr
+  [0x8f, 0x8f, 4], // ldelema
+  [0xa3, 0xa5, 4], // ldelem, stelem, unbox.any
+  [0xa6, 0xb2, OPERAND_INVALID],
+  [0xbb, 0xc1, OPERAND_INVALID],
+  [0xc2, 0xc2, 4], // refanyval
+  [0xc4, 0xc5, OPERAND_INVALID],
+  [0xc6, 0xc6, 4], // mkrefany
+  [0xc7, 0xcf, OPERAND_INVALID],
+  [0xd0, 0xd0, 4], // ldtoken
+  [0xdd, 0xdd, 4], // leave
+  [0xde, 0xde, 1], // leave.s
+  [0xe1, 0xff, OPERAND_INVALID],
+]);
+
+/**
+ * Operand byte sizes for `0xFE`-prefixed opcodes.
+ */
+const TWO_BYTE_OPERANDS = buildOperandTable([
+  [0x06, 0x07, 4], // ldftn, ldvirtftn
+  [0x08, 0x08, OPERAND_INVALID],
+  [0x09, 0x0e, 2], // ldarg .. stloc
+  [0x10, 0x10, OPERAND_INVALID],
+  [0x12, 0x12, 1], // unaligned.
+  [0x15, 0x16, 4], // initobj, constrained.
+  [0x19, 0x19, 1], // no.
+  [0x1b, 0x1b, OPERAND_INVALID],
+  [0x1c, 0x1c, 4], // sizeof
+  [0x1f, 0xff, OPERAND_INVALID],
+]);
+
+/** Single-byte opcodes that produce an xref edge. */
+const ONE_BYTE_XREF_KINDS: Readonly<Record<number, ILXrefKind>> = Object.freeze({
+  0x28: ILXrefKind.Call,
+  0x6f: ILXrefKind.CallVirt,
+  0x73: ILXrefKind.NewObj,
+  0x7b: ILXrefKind.LoadField,
+  0x7c: ILXrefKind.LoadFieldAddress,
+  0x7d: ILXrefKind.StoreField,
+  0x7e: ILXrefKind.LoadField,
+  0x7f: ILXrefKind.LoadFieldAddress,
+  0x80: ILXrefKind.StoreField,
+});
+
+/** `0xFE`-prefixed opcodes that produce an xref edge. */
+const TWO_BYTE_XREF_KINDS: Readonly<Record<number, ILXrefKind>> = Object.freeze({
+  0x06: ILXrefKind.LoadFunction,
+  0x07: ILXrefKind.LoadFunction,
+});
+
+function buildOperandTable(ranges: Array<[number, number, number]>): Uint8Array {
+  const table = new Uint8Array(256);
+  for (const [from, to, size] of ranges) {
+    table.fill(size, from, to + 1);
+  }
+  return table;
+}
+
+function isFieldKind(kind: number): boolean {
+  return kind >= ILXrefKind.LoadField;
+}
+
+function isMethodRefToken(token: number): boolean {
+  const table = token >>> 24;
+  return table === TOKEN_TABLE_MEMBERREF || table === TOKEN_TABLE_METHODSPEC;
+}
+
+// ============================================================================
+// SCANNER
+// ============================================================================
+
+/** Growable edge buffer used while scanning. */
+interface EdgeSink {
+  targets: number[];
+  kinds: number[];
+  offsets: number[];
+}
+
+/**
+ * Decode one IL body and append its xref edges.
+ *
+ * Decoding stops at the first unknown opcode; everything recorded until then is kept.
+ */
+function scanILBody(code: Uint8Array, sink: EdgeSink): void {
+  const length = code.length;
+  let pc = 0;
+
+  while (pc < length) {
+    const start = pc;
+    let opcode = code[pc++];
+    let kind: ILXrefKind | undefined;
+    let operandSize: number;
+
+    if (opcode === 0xfe) {
+      if (pc >= length) return;
+      opcode = code[pc++];
+      operandSize = TWO_BYTE_OPERANDS[opcode];
+      kind = TWO_BYTE_XREF_KINDS[opcode];
+    } else {
+      operandSize = ONE_BYTE_OPERANDS[opcode];
+      kind = ONE_BYTE_XREF_KINDS[opcode];
+    }
+
+    if (operandSize === OPERAND_INVALID) {
+      return;
+    }
+
+    if (operandSize === OPERAND_SWITCH) {
+      if (pc + 4 > length) return;
+      const count = code[pc] | (code[pc + 1] << 8) | (code[pc + 2] << 16) | (code[pc + 3] << 24);
+      pc += 4 + (count >>> 0) * 4;
+      continue;
+    }
+
+    if (kind !== undefined && pc + 4 <= length) {
+      const token = (code[pc] | (code[pc + 1] << 8) | (code[pc + 2] << 16) | (code[pc + 3] << 24)) >>> 0;
+      sink.targets.push(token);
+      sink.kinds.push(kind);
+      sink.offsets.push(start);
+    }
+
+    pc += operandSize;
+  }
+}
+
+// ============================================================================
+// INDEX
+// ============================================================================
+
+/**
+ * Static cross-reference index over the IL of one image.
+ *
+ * Methods are identified by their MethodDef row, so edges for the method with token
+ * `0x06000000 | (row + 1)` live in `[edgeStart[row], edgeStart[row + 1])`.
+ *
+ * @example
+ * ```typescript
+ * const xrefs = image.xrefs;
+ * const takeDamage = playerClass.method("TakeDamage");
+ * for (const caller of xrefs.callersOf(takeDamage)) {
+ *   console.log(caller.fullName);
+ * }
+ *
+ * // Persist and reload next session
+ * File.writeAllBytes(path, xrefs.toBuffer());
+ * const restored = ILXrefIndex.tryFromBuffer(image, File.readAllBytes(path));
+ * ```
+ */
+export class ILXrefIndex {
+  /** Caller MethodDef row for each edge */
+  readonly #sources: Uint32Array;
+  /** Edge indices sorted by target token */
+  readonly #byTarget: Uint32Array;
+  /** Lazily resolved MemberRef/MethodSpec/FieldDef tokens -> runtime pointer ("" when unresolvable) */
+  readonly #resolved = new Map<number, string>();
+  #methodRefTokens: Uint32Array | null = null;
+  #fieldRefTokens: Uint32Array | null = null;
+
+  private constructor(
+    private readonly image: MonoImage,
+    private readonly edgeStart: Uint32Array,
+    private readonly targets: Uint32Array,
+    private readonly kinds: Uint8Array,
+    private readonly offsets: Uint32Array,
+    private readonly stats: ILXrefStats,
+  ) {
+    const edgeCount = targets.length;
+    const sources = new Uint32Array(edgeCount);
+    for (let row = 0; row + 1 < edgeStart.length; row++) {
+      sources.fill(row, edgeStart[row], edgeStart[row + 1]);
+    }
+    this.#sources = sources;
+
+    const order = new Uint32Array(edgeCount);
+    for (let i = 0; i < edgeCount; i++) order[i] = i;
+    order.sort((a, b) => targets[a] - targets[b] || a - b);
+    this.#byTarget = order;
+  }
+
+  // ===== CONSTRUCTION =====
+
+  /**
+   * Scan every method body of an image and build an index.
+   *
+   * @param image Image to scan
+   * @returns The built index
+   */
+  static build(image: MonoImage): ILXrefIndex {
+    const startTime = Date.now();
+    const api = image.api;
+    const native = api.native;
+
+    const methodCount = native.mono_image_get_table_rows(image.pointer, TABLE_METHOD) as number;
+    const edgeStart = new Uint32Array(methodCount + 1);
+    const sink: EdgeSink = { targets: [], kinds: [], offsets: [] };
+    const canFreeHeader = api.hasExport("mono_metadata_free_mh");
+
+    const implFlagsSlot = Memory.alloc(4);
+    const codeSizeSlot = Memory.alloc(4);
+    const maxStackSlot = Memory.alloc(4);
+    let methodsWithBody = 0;
+    let ilBytes = 0;
+
+    // Method bodies are metadata, so the GC may run between rows
+    const safepoints = api.getThreadManager()?.safepoints.scope();
+    try {
+      for (let row = 0; row < methodCount; row++) {
+        safepoints?.poll();
+        edgeStart[row] = sink.targets.length;
+
+        const token = TOKEN_METHODDEF | (row + 1);
+        try {
+          const method = native.mono_get_method(image.pointer, token, NULL);
+          if (pointerIsNull(method)) continue;
+
+          implFlagsSlot.writeU32(0);
+          const flags = native.mono_method_get_flags(method, implFlagsSlot) as number;
+          if (flags & (MethodAttribute.Abstract | MethodAttribute.PInvokeImpl)) continue;
+          if (implFlagsSlot.readU32() & (MethodImplAttribute.CodeTypeMask | MethodImplAttribute.InternalCall)) continue;
+
+          const header = native.mono_method_get_header(method);
+          if (pointerIsNull(header)) continue;
+
+          try {
+            codeSizeSlot.writeU32(0);
+            const code = native.mono_method_header_get_code(header, codeSizeSlot, maxStackSlot);
+            const codeSize = codeSizeSlot.readU32();
+            if (pointerIsNull(code) || codeSize === 0) continue;
+
+            const bytes = code.readByteArray(codeSize);
+            if (!bytes) continue;
+
+            scanILBody(new Uint8Array(bytes), sink);
+            methodsWithBody++;
+            ilBytes += codeSize;
+          } finally {
+            if (canFreeHeader) {
+              native.mono_metadata_free_mh(header);
+            }
+          }
+        } catch (error) {
+          xrefLogger.debug(`Skipping method 0x${token.toString(16)}: ${error}`);
+        }
+      }
+    } finally {
+      safepoints?.end();
+    }
+    edgeStart[methodCount] = sink.targets.length;
+
+    const index = new ILXrefIndex(
+      image,
+      edgeStart,
+      Uint32Array.from(sink.targets),
+      Uint8Array.from(sink.kinds),
+      Uint32Array.from(sink.offsets),
+      {
+        methodCount,
+        methodsWithBody,
+        edgeCount: sink.targets.length,
+        ilBytes,
+        buildTimeMs: Date.now() - startTime,
+      },
+    );
+
+    xrefLogger.debug(
+      `Indexed ${image.name}: ${methodsWithBody}/${methodCount} bodies, ${sink.targets.length} edges ` +
+        `in ${index.stats.buildTimeMs}ms`,
+    );
+    return index;
+  }
+
+  /**
+   * Restore an index previously produced by {@link toBuffer}.
+   *
+   * @param image Image the index was built from
+   * @param buffer Serialized index
+   * @throws {MonoError} if the buffer is malformed or belongs to a different image build
+   */
+  static fromBuffer(image: MonoImage, buffer: ArrayBuffer): ILXrefIndex {
+    const startTime = Date.now();
+    if (buffer.byteLength < HEADER_WORDS * 4) {
+      raise(MonoErrorCodes.INVALID_ARGUMENT, "Xref buffer is too small", "Rebuild the index with ILXrefIndex.build()");
+    }
+
+    const header = new Uint32Array(buffer, 0, HEADER_WORDS);
+    const [magic, version, guidHash, methodCount, edgeCount] = header;
+    if (magic !== SERIAL_MAGIC || version !== SERIAL_VERSION) {
+      raise(
+        MonoErrorCodes.INVALID_ARGUMENT,
+        "Xref buffer has an unknown format",
+        "Rebuild the index with ILXrefIndex.build()",
+        { magic, version },
+      );
+    }
+
+    const expectedHash = hashString(getImageGuid(image));
+    if (guidHash !== expectedHash) {
+      raise(
+        MonoErrorCodes.INVALID_ARGUMENT,
+        `Xref buffer was built for a different version of image '${image.name}'`,
+        "Rebuild the index with ILXrefIndex.build()",
+        { imageName: image.name },
+      );
+    }
+
+    const expectedSize = (HEADER_WORDS + methodCount + 1 + edgeCount * 2) * 4 + edgeCount;
+    if (buffer.byteLength < expectedSize) {
+      raise(MonoErrorCodes.INVALID_ARGUMENT, "Xref buffer is truncated", "Rebuild the index with ILXrefIndex.build()", {
+        expectedSize,
+        actualSize: buffer.byteLength,
+      });
+    }
+
+    let offset = HEADER_WORDS * 4;
+    const edgeStart = new Uint32Array(buffer.slice(offset, offset + (methodCount + 1) * 4));
+    offset += (methodCount + 1) * 4;
+    const targets = new Uint32Array(buffer.slice(offset, offset + edgeCount * 4));
+    offset += edgeCount * 4;
+    const offsets = new Uint32Array(buffer.slice(offset, offset + edgeCount * 4));
+    offset += edgeCount * 4;
+    const kinds = new Uint8Array(buffer.slice(offset, offset + edgeCount));
+
+    return new ILXrefIndex(image, edgeStart, targets, kinds, offsets, {
+      methodCount,
+      methodsWithBody: 0,
+      edgeCount,
+      ilBytes: 0,
+      buildTimeMs: Date.now() - startTime,
+    });
+  }
+
+  /**
+   * Like {@link fromBuffer} but returns `null` for stale or malformed buffers.
+   */
+  static tryFromBuffer(image: MonoImage, buffer: ArrayBuffer | null | undefined): ILXrefIndex | null {
+    if (!buffer) return null;
+    try {
+      return ILXrefIndex.fromBuffer(image, buffer);
+    } catch (error) {
+      xrefLogger.debug(`Discarding xref buffer for ${image.name}: ${error}`);
+      return null;
+    }
+  }
+
+  /**
+   * Serialize the index.
+   *
+   * The buffer is tagged with a hash of the image GUID so stale data is rejected on load.
+   */
+  toBuffer(): ArrayBuffer {
+    const methodCount = this.edgeStart.length - 1;
+    const edgeCount = this.targets.length;
+    const size = (HEADER_WORDS + methodCount + 1 + edgeCount * 2) * 4 + edgeCount;
+    const buffer = new ArrayBuffer(size);
+
+    new Uint32Array(buffer, 0, HEADER_WORDS).set([
+      SERIAL_MAGIC,
+      SERIAL_VERSION,
+      hashString(getImageGuid(this.image)),
+      methodCount,
+      edgeCount,
+    ]);
+
+    let offset = HEADER_WORDS * 4;
+    new Uint32Array(buffer, offset, methodCount + 1).set(this.edgeStart);
+    offset += (methodCount + 1) * 4;
+    new Uint32Array(buffer, offset, edgeCount).set(this.targets);
+    offset += edgeCount * 4;
+    new Uint32Array(buffer, offset, edgeCount).set(this.offsets);
+    offset += edgeCount * 4;
+    new Uint8Array(buffer, offset, edgeCount).set(this.kinds);
+
+    return buffer;
+  }
+
+  // ===== PROPERTIES =====
+
+  /** Number of recorded edges. */
+  get edgeCount(): number {
+    return this.targets.length;
+  }
+
+  /** Number of MethodDef rows covered by the index. */
+  get methodCount(): number {
+    return this.edgeStart.length - 1;
+  }
+
+  /** Build statistics. */
+  getStats(): ILXrefStats {
+    return { ...this.stats };
+  }
+
+  // ===== RAW QUERIES (tokens only, no runtime calls) =====
+
+  /**
+   * Get the outgoing edges of a method by MethodDef token.
+   *
+   * @param callerToken MethodDef token of a method in this image
+   */
+  edgesFrom(callerToken: number): ILXref[] {
+    const row = (callerToken & 0x00ffffff) - 1;
+    if (callerToken >>> 24 !== TOKEN_TABLE_METHODDEF || row < 0 || row >= this.methodCount) {
+      return [];
+    }
+    const result: ILXref[] = [];
+    for (let i = this.edgeStart[row]; i < this.edgeStart[row + 1]; i++) {
+      result.push(this.edgeAt(i));
+    }
+    return result;
+  }
+
+  /**
+   * Get all edges whose operand is the given token.
+   *
+   * @param targetToken MethodDef, MemberRef, MethodSpec or FieldDef token of this image
+   */
+  edgesTo(targetToken: number): ILXref[] {
+    const result: ILXref[] = [];
+    const byTarget = this.#byTarget;
+    for (let i = this.lowerBound(targetToken >>> 0); i < byTarget.length; i++) {
+      const edge = byTarget[i];
+      if (this.targets[edge] !== targetToken >>> 0) break;
+      result.push(this.edgeAt(edge));
+    }
+    return result;
+  }
+
+  // ===== RESOLVED QUERIES =====
+
+  /**
+   * Get methods in this image that call, construct or take the address of a method.
+   *
+   * @param method Target method (may be defined in another image)
+   * @returns Unique callers
+   *
+   * @example
+   * ```typescript
+   * const callers = image.xrefs.callersOf(takeDamage);
+   * ```
+   */
+  callersOf(method: MonoMethod): MonoMethod[] {
+    const defToken = this.isLocal(method.declaringClass.image.pointer) ? method.token : 0;
+    return this.uniqueCallers(this.tokensFor(method.pointer, defToken, false), () => true);
+  }
+
+  /**
+   * Get the methods and fields referenced from a method body.
+   *
+   * @param method Method defined in this image
+   * @returns Resolved targets with the edge they came from; unresolvable tokens are skipped
+   */
+  calleesOf(method: MonoMethod): Array<{ edge: ILXref; target: MonoMethod | MonoField }> {
+    const api = this.image.api;
+    const result: Array<{ edge: ILXref; target: MonoMethod | MonoField }> = [];
+    for (const edge of this.edgesFrom(method.token)) {
+      const isField = isFieldKind(edge.kind);
+      const pointer = this.resolveToken(edge.targetToken, isField);
+      if (pointer === null) continue;
+      result.push({ edge, target: isField ? new MonoField(api, pointer) : new MonoMethod(api, pointer) });
+    }
+    return result;
+  }
+
+  /**
+   * Get methods in this image that read a field (`ldfld`, `ldsfld`, and address-taking loads).
+   *
+   * @param field Target field (may be defined in another image)
+   */
+  fieldReaders(field: MonoField): MonoMethod[] {
+    return this.uniqueCallers(
+      this.fieldTokens(field),
+      kind => kind === ILXrefKind.LoadField || kind === ILXrefKind.LoadFieldAddress,
+    );
+  }
+
+  /**
+   * Get methods in this image that write a field (`stfld`, `stsfld`, and address-taking loads).
+   *
+   * @param field Target field (may be defined in another image)
+   */
+  fieldWriters(field: MonoField): MonoMethod[] {
+    return this.uniqueCallers(
+      this.fieldTokens(field),
+      kind => kind === ILXrefKind.StoreField || kind === ILXrefKind.LoadFieldAddress,
+    );
+  }
+
+  // ===== INTERNAL =====
+
+  private edgeAt(edge: number): ILXref {
+    return {
+      callerToken: TOKEN_METHODDEF | (this.#sources[edge] + 1),
+      targetToken: this.targets[edge],
+      kind: this.kinds[edge] as ILXrefKind,
+      ilOffset: this.offsets[edge],
+    };
+  }
+
+  private lowerBound(token: number): number {
+    const byTarget = this.#byTarget;
+    let lo = 0;
+    let hi = byTarget.length;
+    while (lo < hi) {
+      const mid = (lo + hi) >>> 1;
+      if (this.targets[byTarget[mid]] < token) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+  private uniqueCallers(tokens: number[], accept: (kind: number) => boolean): MonoMethod[] {
+    const rows = new Set<number>();
+    const byTarget = this.#byTarget;
+    for (const token of tokens) {
+      for (let i = this.lowerBound(token); i < byTarget.length; i++) {
+        const edge = byTarget[i];
+        if (this.targets[edge] !== token) break;
+        if (accept(this.kinds[edge])) {
+          rows.add(this.#sources[edge]);
+        }
+      }
+    }
+
+    const api = this.image.api;
+    const result: MonoMethod[] = [];
+    for (const row of rows) {
+      const pointer = api.native.mono_get_method(this.image.pointer, TOKEN_METHODDEF | (row + 1), NULL);
+      if (!pointerIsNull(pointer)) {
+        result.push(new MonoMethod(api, pointer));
+      }
+    }
+    return result;
+  }
+
+  private fieldTokens(field: MonoField): number[] {
+    const defToken = this.isLocal(field.parent.image.pointer) ? field.token : 0;
+    return this.tokensFor(field.pointer, defToken, true);
+  }
+
+  private isLocal(imagePointer: NativePointer): boolean {
+    return imagePointer.equals(this.image.pointer);
+  }
+
+  /**
+   * Collect the tokens of this image that denote the given runtime member: its own definition
+   * token when local, plus any MemberRef/MethodSpec whose resolution yields the same pointer.
+   */
+  private tokensFor(pointer: NativePointer, defToken: number, isField: boolean): number[] {
+    const tokens: number[] = [];
+    if (defToken !== 0) {
+      tokens.push(defToken >>> 0);
+    }
+    const key = pointer.toString();
+    for (const token of this.refTokens(isField)) {
+      if (this.resolveToken(token, isField)?.toString() === key) {
+        tokens.push(token);
+      }
+    }
+    return tokens;
+  }
+
+  private refTokens(isField: boolean): Uint32Array {
+    const cached = isField ? this.#fieldRefTokens : this.#methodRefTokens;
+    if (cached) return cached;
+
+    const unique = new Set<number>();
+    for (let i = 0; i < this.targets.length; i++) {
+      const token = this.targets[i];
+      if (isFieldKind(this.kinds[i]) === isField && isMethodRefToken(token)) {
+        unique.add(token);
+      }
+    }
+    const tokens = Uint32Array.from(unique);
+    if (isField) {
+      this.#fieldRefTokens = tokens;
+    } else {
+      this.#methodRefTokens = tokens;
+    }
+    return tokens;
+  }
+
+  private resolveToken(token: number, isField: boolean): NativePointer | null {
+    let cached = this.#resolved.get(token);
+    if (cached === undefined) {
+      cached = "";
+      try {
+        const native = this.image.api.native;
+        const pointer = isField
+          ? native.mono_field_from_token(this.image.pointer, token, Memory.alloc(Process.pointerSize), NULL)
+          : native.mono_get_method(this.image.pointer, token, NULL);
+        if (!pointerIsNull(pointer)) {
+          cached = pointer.toString();
+        }
+      } catch (error) {
+        xrefLogger.debug(`Failed to resolve token 0x${token.toString(16)}: ${error}`);
+      }
+      this.#resolved.set(token, cached);
+    }
+    return cached ? ptr(cached) : null;
+  }
+}
+
+function getImageGuid(image: MonoImage): string {
+  const guidPtr = image.api.native.mono_image_get_guid(image.pointer);
+  return pointerIsNull(guidPtr) ? image.name : readUtf8String(guidPtr);
+}
+
+const TABLE_METHOD = 0x06;
+const TOKEN_TABLE_METHODDEF = 0x06;
+const TOKEN_TABLE_MEMBERREF = 0x0a;
+const TOKEN_TABLE_METHODSPEC = 0x2b;
+const TOKEN_METHODDEF = 0x06000000;
+
+const SERIAL_MAGIC = 0x4652584d; // "MXRF"
+const SERIAL_VERSION = 1;
+const HEADER_WORDS = 5;
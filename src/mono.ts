@@ -39,20 +39,56 @@ import { MonoString } from "./model/string";
 import { MonoType } from "./model/type";
 import type { MonoApi } from "./runtime/api";
 import { createMonoApi } from "./runtime/api";
-import { MonoModuleInfo, waitForMonoModule } from "./runtime/module";
+import {
+  findAllMonoModules,
+  importModuleDiscoveryCache,
+  MonoModuleInfo,
+  waitForMonoModuleDiscovery,
+} from "./runtime/module";
+import {
+  loadSessionSnapshot,
+  saveSessionSnapshot,
+  type SessionRestoreResult,
+  type SessionStorage,
+} from "./runtime/session-state";
 import { ThreadManager } from "./runtime/thread";
 import { MonoRuntimeVersion } from "./runtime/version";
-import { handleMonoError, MonoErrorCodes, raise, raiseFrom } from "./utils/errors";
-
-import { buildGCSubsystem, buildICallSubsystem, buildMemorySubsystem, buildTraceSubsystem } from "./subsystems";
+import { handleMonoError, MonoErrorCodes, MonoManagedExceptionError, raise, raiseFrom } from "./utils/errors";
+
+import {
+  buildCollectionsSubsystem,
+  buildGCSubsystem,
+  buildICallSubsystem,
+  buildMemorySubsystem,
+  buildStackSubsystem,
+  buildTraceSubsystem,
+  buildUnitySubsystem,
+} from "./subsystems";
 
 // Import domain objects from model
 import { GarbageCollector } from "./model/gc";
+import { ManagedCollectionReader } from "./model/managed-collections";
+import { ObjectWatch } from "./model/object-watch";
+import { StackWalker } from "./model/stack";
 import { Tracer } from "./model/trace";
+import { UnitySceneSnapshotter } from "./model/unity-scene";
+import { UnityTransformReader } from "./model/unity-values";
 
 // Import internal call registrar
 import { createInternalCallRegistrar, type InternalCallRegistrar } from "./model/internal-call";
 
+/**
+ * What {@link MonoNamespace.dispose} released and how long it took.
+ */
+export interface MonoTeardownStats {
+  /** Tracer hooks detached (one Interceptor transaction) */
+  hooksDetached: number;
+  /** GC handles released by `Mono.gc` (one native loop) */
+  handlesReleased: number;
+  /** Wall time of the whole teardown, including additional runtimes */
+  durationMs: number;
+}
+
 /**
  * Primary entry point for all Mono runtime interactions.
  *
@@ -104,11 +140,36 @@ export class MonoNamespace {
   // Subsystem caches
   private _gc: GarbageCollector | null = null;
   private _tracer: Tracer | null = null;
+  private _stackWalker: StackWalker | null = null;
+  private _collectionReader: ManagedCollectionReader | null = null;
+  private _sceneSnapshotter: UnitySceneSnapshotter | null = null;
+  private _transformReader: UnityTransformReader | null = null;
   private _icallRegistrar: InternalCallRegistrar | null = null;
   private _memory: MonoNamespace.Memory | null = null;
   private _traceSubsystem: MonoNamespace.Trace | null = null;
+  private _stackSubsystem: MonoNamespace.Stack | null = null;
+  private _collections: MonoNamespace.Collections | null = null;
+  private _unity: MonoNamespace.Unity | null = null;
   private _gcSubsystem: MonoNamespace.GC | null = null;
   private _icall: MonoNamespace.ICall | null = null;
+  private readonly _objectWatches = new Set<ObjectWatch>();
+
+  // Session persistence
+  private _sessionRestore: SessionRestoreResult | null = null;
+
+  // Multi-runtime state
+  private readonly _boundModule: MonoModuleInfo | null;
+  private _runtimes: MonoNamespace[] | null = null;
+  /** Process modules enumerated while discovering this runtime; reused by `runtimes` */
+  private _loadedModules: Module[] | null = null;
+
+  /**
+   * @param module Runtime module to bind to, skipping discovery.
+   *   Used for the additional runtimes listed by `Mono.runtimes`; the `Mono` singleton discovers its module.
+   */
+  constructor(module?: MonoModuleInfo) {
+    this._boundModule = module ?? null;
+  }
 
   // ============================================================================
   // FACADE HELPERS
@@ -135,6 +196,15 @@ export class MonoNamespace {
       return MonoArray.new(this.api, elementClass, length);
     },
 
+    /** Create a multi-dimensional managed array such as `int[,]` */
+    newMultiDimensional: <T = unknown>(
+      elementClass: MonoClass,
+      lengths: readonly number[],
+      lowerBounds?: readonly number[],
+    ): MonoArray<T> => {
+      return MonoArray.newMultiDimensional(this.api, elementClass, lengths, lowerBounds);
+    },
+
     /** Wrap an existing array pointer */
     wrap: <T = unknown>(ptr: NativePointer): MonoArray<T> => {
       return new MonoArray<T>(this.api, ptr);
@@ -436,6 +506,12 @@ export class MonoNamespace {
 
     /** Capacity of the pinned UTF-8 string cache. */
     pinnedStringCacheCapacity: 512,
+
+    /** Safepoint chunking for long loops; coop-suspend runtimes only. */
+    safepoints: { mode: "auto", chunkSize: 512, maxChunkMs: 4 },
+
+    /** Hook assembly load/close and domain unload to invalidate scoped caches. */
+    trackCacheScopes: true,
   };
 
   // ============================================================================
@@ -505,6 +581,10 @@ export class MonoNamespace {
       });
       return result;
     } catch (error: any) {
+      // Decode managed exception details now; "free" mode detaches the thread below
+      if (error instanceof MonoManagedExceptionError) {
+        void error.exceptionType;
+      }
       // Rethrow on next tick to preserve visibility in Frida.
       Script.nextTick(_ => {
         raiseFrom(_, MonoErrorCodes.UNKNOWN, "Unhandled error in Mono.perform callback");
@@ -548,11 +628,21 @@ export class MonoNamespace {
     }
 
     this._initializing = (async () => {
-      const moduleInfo = await waitForMonoModule({
-        moduleName: this.config.moduleName,
-        timeoutMs: this.config.initializeTimeoutMs,
-        warnAfterMs: this.config.warnAfterMs,
-      });
+      const snapshot = this.config.session ? loadSessionSnapshot(this.config.session) : null;
+      if (snapshot) {
+        importModuleDiscoveryCache(snapshot.discovery);
+      }
+
+      let moduleInfo = this._boundModule;
+      if (!moduleInfo) {
+        const discovery = await waitForMonoModuleDiscovery({
+          moduleName: this.config.moduleName,
+          timeoutMs: this.config.initializeTimeoutMs,
+          warnAfterMs: this.config.warnAfterMs,
+        });
+        moduleInfo = discovery.module;
+        this._loadedModules = discovery.loadedModules;
+      }
 
       this._module = moduleInfo;
       this._api = createMonoApi(this._module, {
@@ -561,7 +651,26 @@ export class MonoNamespace {
       });
 
       // Initialize thread manager
-      this._api.setThreadManager(new ThreadManager(this._api));
+      const threadManager = new ThreadManager(this._api);
+      if (this.config.safepoints) {
+        threadManager.safepoints.configure(this.config.safepoints);
+      }
+      this._api.setThreadManager(threadManager);
+
+      // Restore before probing exports so the strategies resolve through the seeded offsets
+      if (this.config.session) {
+        const session = this._api.enableSession();
+        if (snapshot) {
+          this._sessionRestore = session.restore(snapshot, moduleInfo);
+        }
+      }
+
+      // Probe exports once so hot paths run on pre-bound implementations
+      void this._api.strategies;
+
+      if (this.config.trackCacheScopes ?? true) {
+        this._api.cacheScopes.install();
+      }
 
       // Wait for runtime readiness (root domain available).
       // NOTE: Thread attachment is NOT done here - that's perform()'s responsibility.
@@ -577,6 +686,10 @@ export class MonoNamespace {
         this._version = null;
         this._gc = null;
         this._tracer = null;
+        this._stackWalker = null;
+        this._collectionReader = null;
+        this._sceneSnapshotter = null;
+        this._transformReader = null;
         this._initialized = false;
         const message =
           error instanceof Error
@@ -643,6 +756,47 @@ export class MonoNamespace {
     return this._module!;
   }
 
+  /**
+   * All Mono runtimes loaded in the process, this one first.
+   *
+   * Each entry is an independent context with its own `MonoApi`, caches,
+   * thread manager and tracer; additional runtimes inherit this instance's
+   * config (without global installation) and must be initialized on their own,
+   * typically through their `perform()`. The module list enumerated during
+   * initialization is reused, so runtimes loaded afterwards are not listed;
+   * disposing this instance disposes the additional runtimes.
+   *
+   * @example
+   * ```typescript
+   * for (const runtime of Mono.runtimes) {
+   *   await runtime.perform(() => console.log(runtime.module.name, runtime.domain.assemblies.length));
+   * }
+   * ```
+   */
+  get runtimes(): readonly MonoNamespace[] {
+    this.ensureInitializedSync();
+
+    if (!this._runtimes) {
+      const primary = this._module!.base;
+      const runtimes: MonoNamespace[] = [this];
+      // Bound runtimes skipped discovery and have no list of their own
+      const loaded = this._loadedModules ?? undefined;
+      for (const { module } of findAllMonoModules(this.config.moduleName, loaded)) {
+        if (!module.base.equals(primary)) {
+          const runtime = new MonoNamespace(module);
+          Object.assign(runtime.config, this.config, {
+            moduleName: undefined,
+            installGlobal: false,
+            session: undefined,
+          });
+          runtimes.push(runtime);
+        }
+      }
+      this._runtimes = runtimes;
+    }
+    return this._runtimes;
+  }
+
   /**
    * Memory utilities for reading/writing managed objects.
    * Provides boxing/unboxing, string/array creation, and direct memory access.
@@ -714,6 +868,57 @@ export class MonoNamespace {
     return this._traceSubsystem;
   }
 
+  /**
+   * Managed stack walking for the current thread or other threads
+   */
+  get stack(): MonoNamespace.Stack {
+    this.ensureInitializedSync();
+
+    if (!this._stackSubsystem) {
+      if (!this._stackWalker) {
+        this._stackWalker = new StackWalker(this._api!);
+      }
+      this._stackSubsystem = buildStackSubsystem(this._stackWalker);
+    }
+
+    return this._stackSubsystem;
+  }
+
+  /**
+   * Direct-memory readers for List<T>, Dictionary<TKey, TValue> and HashSet<T>
+   */
+  get collections(): MonoNamespace.Collections {
+    this.ensureInitializedSync();
+
+    if (!this._collections) {
+      if (!this._collectionReader) {
+        this._collectionReader = new ManagedCollectionReader(this._api!);
+      }
+      this._collections = buildCollectionsSubsystem(this._collectionReader);
+    }
+
+    return this._collections;
+  }
+
+  /**
+   * Unity scene-graph snapshots and bulk transform/struct readers
+   */
+  get unity(): MonoNamespace.Unity {
+    this.ensureInitializedSync();
+
+    if (!this._unity) {
+      if (!this._sceneSnapshotter) {
+        this._sceneSnapshotter = new UnitySceneSnapshotter(this._api!);
+      }
+      if (!this._transformReader) {
+        this._transformReader = new UnityTransformReader(this._api!);
+      }
+      this._unity = buildUnitySubsystem(this._sceneSnapshotter, this._transformReader);
+    }
+
+    return this._unity;
+  }
+
   /**
    * Internal call registration utilities.
    * Register native functions callable from managed code.
@@ -731,6 +936,71 @@ export class MonoNamespace {
     return this._icall;
   }
 
+  // ============================================================================
+  // PUBLIC API - SESSION PERSISTENCE
+  // ============================================================================
+
+  /**
+   * Outcome of restoring the session snapshot during initialization,
+   * or null when `config.session` is unset or no snapshot was stored.
+   */
+  get sessionRestore(): SessionRestoreResult | null {
+    return this._sessionRestore;
+  }
+
+  /**
+   * Save the warm state so the next script load can skip discovery and lookups.
+   * Enables session recording if it was not enabled through `config.session`.
+   *
+   * @param storage Where to store the snapshot (default: `config.session`, else "process")
+   * @returns Whether the snapshot was written
+   *
+   * @example
+   * ```typescript
+   * Mono.config.session = "process"; // restore on the next load
+   * await Mono.perform(() => { ... });
+   * Mono.saveSession();
+   * ```
+   */
+  saveSession(storage: SessionStorage = this.config.session ?? "process"): boolean {
+    this.ensureInitializedSync();
+    const session = this._api!.enableSession();
+    return saveSessionSnapshot(session.capture(this._module!), storage);
+  }
+
+  // ============================================================================
+  // PUBLIC API - CHANGE DETECTION
+  // ============================================================================
+
+  /**
+   * Watch instance fields of many objects for changes.
+   *
+   * Keeps a native shadow copy of each object's field range and diffs it on
+   * `poll()`, reporting only the fields that changed. Watches are disposed
+   * with `Mono.dispose()` / `Mono.reset()`.
+   *
+   * @param objects Instances of one class (the first object's class is used)
+   * @param fields Field names or MonoField instances
+   *
+   * @example
+   * ```typescript
+   * const watch = Mono.watch(players, ["health", "score"]);
+   * const deltas = watch.poll(); // [{ index, object, field, value }, ...]
+   * ```
+   */
+  watch(objects: ReadonlyArray<MonoObject | NativePointer>, fields: ReadonlyArray<MonoField | string>): ObjectWatch {
+    this.ensureInitializedSync();
+
+    for (const existing of this._objectWatches) {
+      if (existing.isDisposed) {
+        this._objectWatches.delete(existing);
+      }
+    }
+    const watch = new ObjectWatch(this._api!, objects, fields);
+    this._objectWatches.add(watch);
+    return watch;
+  }
+
   // ============================================================================
   // PRIVATE HELPERS
   // ============================================================================
@@ -773,6 +1043,13 @@ export class MonoNamespace {
     await this.initialize();
   }
 
+  private disposeObjectWatches(): void {
+    for (const watch of this._objectWatches) {
+      watch.dispose();
+    }
+    this._objectWatches.clear();
+  }
+
   /**
    * Build the memory subsystem with unified read/write/box/unbox/string/array support.
    * All memory operations delegate to type.ts for consistency.
@@ -820,13 +1097,42 @@ export class MonoNamespace {
    * - Internal call registrar is cleared
    * - The instance cannot be reused without re-initialization
    *
+   * Hooks are detached in one Interceptor transaction, GC handles are freed
+   * in one native loop and caches are dropped by reference, so the cost stays
+   * low even with thousands of hooks or handles.
+   *
+   * @returns Counts of released hooks and handles plus the total duration
+   *
    * @example
    * ```typescript
    * // When done with Mono
-   * Mono.dispose();
+   * const { durationMs } = Mono.dispose();
    * ```
    */
-  dispose(): void {
+  dispose(): MonoTeardownStats {
+    const startTime = Date.now();
+    let hooksDetached = this._tracer?.activeHookCount ?? 0;
+    let handlesReleased = 0;
+
+    // Persist warm state before caches are dropped
+    if (this._initialized && this.config.session && this._api?.session) {
+      saveSessionSnapshot(this._api.session.capture(this._module!), this.config.session);
+    }
+
+    this.disposeObjectWatches();
+
+    // Dispose additional runtimes discovered through `runtimes`
+    if (this._runtimes) {
+      for (const runtime of this._runtimes) {
+        if (runtime !== this) {
+          const stats = runtime.dispose();
+          hooksDetached += stats.hooksDetached;
+          handlesReleased += stats.handlesReleased;
+        }
+      }
+      this._runtimes = null;
+    }
+
     // Dispose tracer (detaches all hooks)
     if (this._tracer) {
       this._tracer.dispose();
@@ -834,7 +1140,12 @@ export class MonoNamespace {
 
     // Dispose GC (releases all handles)
     if (this._gc) {
-      this._gc.dispose();
+      handlesReleased += this._gc.dispose();
+    }
+
+    // Dispose stack walker (drops interned frames)
+    if (this._stackWalker) {
+      this._stackWalker.dispose();
     }
 
     // Clear internal call registrar tracking
@@ -853,6 +1164,8 @@ export class MonoNamespace {
     this._unloadHookInstalled = false;
 
     // Clear core state
+    this._sessionRestore = null;
+    this._loadedModules = null;
     this._module = null;
     this._api = null;
     this._domain = null;
@@ -861,11 +1174,20 @@ export class MonoNamespace {
     // Clear subsystem caches
     this._gc = null;
     this._tracer = null;
+    this._stackWalker = null;
+    this._collectionReader = null;
+    this._sceneSnapshotter = null;
+    this._transformReader = null;
     this._icallRegistrar = null;
     this._memory = null;
     this._traceSubsystem = null;
+    this._stackSubsystem = null;
+    this._collections = null;
+    this._unity = null;
     this._gcSubsystem = null;
     this._icall = null;
+
+    return { hooksDetached, handlesReleased, durationMs: Date.now() - startTime };
   }
 
   /**
@@ -901,14 +1223,38 @@ export class MonoNamespace {
       this._tracer.detachAll();
     }
 
+    // Unpin watched objects
+    this.disposeObjectWatches();
+
     // Release all GC handles
     if (this._gc) {
       this._gc.releaseAllHandles();
     }
 
+    // Drop interned stack frames
+    if (this._stackWalker) {
+      this._stackWalker.clearCaches();
+    }
+
+    // Drop resolved collection layouts
+    if (this._collectionReader) {
+      this._collectionReader.clearCache();
+    }
+
+    // Drop resolved UnityEngine methods
+    if (this._sceneSnapshotter) {
+      this._sceneSnapshotter.clearCache();
+    }
+    if (this._transformReader) {
+      this._transformReader.clearCache();
+    }
+
     // Clear all subsystem caches (will be rebuilt on next access)
     this._memory = null;
     this._traceSubsystem = null;
+    this._stackSubsystem = null;
+    this._collections = null;
+    this._unity = null;
     this._gcSubsystem = null;
     this._icall = null;
   }
@@ -970,6 +1316,9 @@ export namespace MonoNamespace {
   export type TypedReadOptions = import("./types").TypedReadOptions;
   export type Memory = import("./types").MemorySubsystem;
   export type Trace = import("./types").Trace;
+  export type Stack = import("./types").Stack;
+  export type Collections = import("./types").Collections;
+  export type Unity = import("./types").Unity;
   export type ICall = import("./types").ICall;
 }
 
@@ -1017,6 +1366,15 @@ export namespace Mono {
   /** See `MonoNamespace.Trace`. */
   export type Trace = MonoNamespace.Trace;
 
+  /** See `MonoNamespace.Stack`. */
+  export type Stack = MonoNamespace.Stack;
+
+  /** See `MonoNamespace.Collections`. */
+  export type Collections = MonoNamespace.Collections;
+
+  /** See `MonoNamespace.Unity`. */
+  export type Unity = MonoNamespace.Unity;
+
   /** See `MonoNamespace.ICall`. */
   export type ICall = MonoNamespace.ICall;
 }
@@ -12,11 +12,17 @@
  */
 
 import { LruCache } from "../utils/cache";
-import { MonoErrorCodes, raise } from "../utils/errors";
+import { MonoErrorCodes, MonoManagedExceptionError, raise } from "../utils/errors";
 import { allocPointerArray, pointerIsNull } from "../utils/memory";
 import { readUtf8String } from "../utils/string";
+import { CacheScopeRegistry } from "./cache-scope";
 import { ALL_MONO_EXPORTS, MonoApiName, MonoExportSignature, getSignature, tryGetSignature } from "./exports";
+import { GCHandle, GCHandlePool } from "./gchandle";
 import { MonoModuleInfo } from "./module";
+import { FLAVOR_NATIVE_STUBS, NativeStubContext, SHARED_NATIVE_STUBS } from "./native-stubs";
+import { SessionState } from "./session-state";
+import { RuntimeStrategies } from "./strategies";
+import { ManagedStringCache } from "./string-cache";
 import type { ThreadManager } from "./thread";
 
 // ============================================================================
@@ -74,6 +80,8 @@ export interface MonoExceptionDetails {
   type?: string;
   /** Exception message */
   message?: string;
+  /** Managed stack trace */
+  stackTrace?: string;
 }
 
 // ============================================================================
@@ -94,6 +102,8 @@ const CACHE_LIMITS = {
   UTF8_STRING_CACHE: 256,
   /** Maximum number of pinned UTF-8 string pointers */
   PINNED_STRING_CACHE: 512,
+  /** Maximum number of managed exceptions kept pinned for lazy detail decoding */
+  PINNED_EXCEPTIONS: 64,
 } as const;
 
 /**
@@ -148,6 +158,9 @@ export class MonoApi {
   /** LRU cache for export addresses */
   private readonly addressCache = new LruCache<MonoApiName, NativePointer>(CACHE_LIMITS.ADDRESS_CACHE);
 
+  /** Exports known to be absent from the module; module exports never change once loaded */
+  private readonly missingExports = new Set<MonoApiName>();
+
   /** LRU cache for delegate thunk information */
   private readonly delegateThunkCache = new LruCache<string, DelegateThunkInfo>(CACHE_LIMITS.DELEGATE_THUNK_CACHE);
 
@@ -165,6 +178,33 @@ export class MonoApi {
    */
   private exceptionSlot: NativePointer | null = null;
 
+  /** GC handle pool pinning exceptions carried by thrown MonoManagedExceptionError instances */
+  private exceptionHandlePool: GCHandlePool | null = null;
+
+  /**
+   * Pinned exception handles, oldest released first.
+   * Bounds how many undecoded exceptions stay alive when callers never release their errors.
+   */
+  private readonly pinnedExceptions = new LruCache<GCHandle, true>({
+    capacity: CACHE_LIMITS.PINNED_EXCEPTIONS,
+    onEvict: handle => this.exceptionHandlePool?.release(handle),
+  });
+
+  /** Interned, pinned MonoStrings for short invocation arguments (created on first use) */
+  private managedStrings: ManagedStringCache | null = null;
+
+  /** Per-domain/image cache generations (created on first use) */
+  private scopes: CacheScopeRegistry | null = null;
+
+  /** Capability-resolved implementations (built once, on first use) */
+  private resolvedStrategies: RuntimeStrategies | null = null;
+
+  /** Recorded class/method tokens for session persistence (created by enableSession) */
+  private sessionState: SessionState | null = null;
+
+  /** Image of each delegate class in `delegateThunkCache`, for scoped invalidation */
+  private readonly delegateThunkImages = new Map<string, string>();
+
   /** Cached root domain pointer */
   private rootDomain: NativePointer | null = null;
 
@@ -439,34 +479,204 @@ export class MonoApi {
   }
 
   /**
-   * Invoke a managed method with exception handling and detail extraction.
-   * Automatically attaches exception slot and extracts exception type/message on error.
+   * Shared cache of interned MonoStrings keyed by JS string.
+   *
+   * Used for short string invocation arguments so hot call paths do not
+   * allocate a new managed string per call. Returned strings are shared and
+   * must not be mutated in place.
+   */
+  get stringCache(): ManagedStringCache {
+    this.ensureNotDisposed();
+    if (!this.managedStrings) {
+      this.managedStrings = new ManagedStringCache(this);
+    }
+    return this.managedStrings;
+  }
+
+  /**
+   * Generation counters for domain- and image-scoped caches.
+   *
+   * Runtime hooks are installed separately by {@link CacheScopeRegistry.install};
+   * until then only manual invalidation moves the counters.
+   */
+  get cacheScopes(): CacheScopeRegistry {
+    this.ensureNotDisposed();
+    if (!this.scopes) {
+      this.scopes = new CacheScopeRegistry(this);
+      this.scopes.onInvalidate(event => {
+        if (event.kind === "image") {
+          this.purgeDelegateThunks(event.scope.toString());
+        }
+      });
+    }
+    return this.scopes;
+  }
+
+  /**
+   * Operations bound to the best implementation this runtime supports.
+   *
+   * Exports are probed once; hot paths call the bound functions instead of
+   * checking `hasExport()`. See {@link RuntimeStrategies}.
+   */
+  get strategies(): RuntimeStrategies {
+    if (!this.resolvedStrategies) {
+      this.resolvedStrategies = RuntimeStrategies.select(this);
+    }
+    return this.resolvedStrategies;
+  }
+
+  /**
+   * Session state recording resolved classes and methods, or null when session
+   * persistence is not enabled.
+   */
+  get session(): SessionState | null {
+    return this.sessionState;
+  }
+
+  /**
+   * Start recording resolved classes and methods so they can be persisted.
+   * @returns The (possibly existing) session state
+   */
+  enableSession(): SessionState {
+    this.ensureNotDisposed();
+    if (!this.sessionState) {
+      this.sessionState = new SessionState(this);
+    }
+    return this.sessionState;
+  }
+
+  /**
+   * Create MonoStrings for many JavaScript strings in one attached context.
+   *
+   * Duplicates within the batch share one MonoString. Uses
+   * `mono_string_new_utf16` when exported, which also keeps embedded NULs
+   * and avoids churning the UTF-8 lookup cache with one-off payloads.
+   *
+   * The returned strings are not rooted: pass them to managed code or pin
+   * them (e.g. with a {@link GCHandlePool}) before the next managed
+   * allocation, which may collect them.
+   *
+   * @param texts Strings to convert
+   * @returns One MonoString pointer per input, in order
+   *
+   * @example
+   * ```typescript
+   * const [a, b] = api.stringNewMany(["alpha", "beta"]);
+   * ```
+   */
+  stringNewMany(texts: readonly string[]): NativePointer[] {
+    this.ensureNotDisposed();
+    const run = () => {
+      const domain = this.getRootDomain();
+      const utf16 = this.hasExport("mono_string_new_utf16");
+      const created = new Map<string, NativePointer>();
+      const results: NativePointer[] = new Array(texts.length);
+      for (let i = 0; i < texts.length; i++) {
+        const text = texts[i];
+        let pointer = created.get(text);
+        if (!pointer) {
+          pointer = utf16
+            ? this.native.mono_string_new_utf16(domain, Memory.allocUtf16String(text), text.length)
+            : this.native.mono_string_new(domain, Memory.allocUtf8String(text));
+          created.set(text, pointer);
+        }
+        results[i] = pointer;
+      }
+      return results;
+    };
+    return this.threadManager ? this.threadManager.runIfNeeded(run) : run();
+  }
+
+  /**
+   * Invoke a managed method with exception handling.
+   *
+   * On a managed exception the thrown error only carries the exception pointer (kept alive by
+   * a GC handle); type, message and stack trace are decoded on first access.
    *
    * @param method Pointer to MonoMethod
    * @param instance Instance pointer (NULL for static methods)
    * @param args Array of argument pointers
    * @returns Result pointer from the invocation
-   * @throws {MonoManagedExceptionError} with extracted exception details
+   * @throws {MonoManagedExceptionError} with lazily decoded exception details
    */
   runtimeInvoke(method: NativePointer, instance: NativePointer | null, args: NativePointer[]): NativePointer {
+    return this.runtimeInvokeArgv(method, instance, allocPointerArray(args));
+  }
+
+  /**
+   * Invoke a managed method with a caller-owned `void**` argument vector.
+   *
+   * Lets hot paths reuse one argument buffer across calls instead of allocating per call.
+   * Exception handling matches {@link runtimeInvoke}.
+   *
+   * @param method Pointer to MonoMethod
+   * @param instance Instance pointer (NULL for static methods)
+   * @param argv Pointer to the argument pointer array (NULL when the method takes no arguments)
+   * @returns Result pointer from the invocation
+   * @throws {MonoManagedExceptionError} with lazily decoded exception details
+   */
+  runtimeInvokeArgv(method: NativePointer, instance: NativePointer | null, argv: NativePointer): NativePointer {
     const invoke = this.native.mono_runtime_invoke;
     const exceptionSlot = this.getExceptionSlot();
     exceptionSlot.writePointer(NULL);
-    const argv = allocPointerArray(args);
     const result = invoke(method, instance ?? NULL, argv, exceptionSlot);
     const exception = exceptionSlot.readPointer();
     if (!pointerIsNull(exception)) {
-      const details = this.extractExceptionDetails(exception);
-      const message = details.message || `Managed exception thrown: ${details.type || "Unknown"}`;
-      raise(MonoErrorCodes.MANAGED_EXCEPTION, message, "Inspect exception details in `error.details`", {
-        exception,
-        exceptionType: details.type,
-        exceptionMessage: details.message,
-      });
+      // Thrown directly: raise() would copy `details` and force decoding.
+      throw this.createManagedExceptionError(exception);
     }
     return result;
   }
 
+  /**
+   * Build a lazily decoded error for a managed exception, pinning the exception object
+   * so it survives until the details are read or the error is released.
+   *
+   * Decoding invokes managed code, so it re-enters the attach scope: the details may be
+   * read after the thread that caught the exception left `Mono.perform`.
+   */
+  private createManagedExceptionError(exception: NativePointer): MonoManagedExceptionError {
+    const handle = this.tryPinException(exception);
+
+    const decode = () => {
+      if (handle && !handle.isValid) {
+        return { evicted: true };
+      }
+      const details = this.extractExceptionDetails(exception);
+      return { exceptionType: details.type, exceptionMessage: details.message, stackTrace: details.stackTrace };
+    };
+    const resolve = () => {
+      const manager = this.getThreadManager();
+      return manager ? manager.runIfNeeded(decode) : decode();
+    };
+    const release = handle ? () => this.pinnedExceptions.delete(handle) : undefined;
+
+    return MonoManagedExceptionError.deferred(
+      exception,
+      resolve,
+      release,
+      "Inspect exception details in `error.details`",
+    );
+  }
+
+  /**
+   * Pin a managed exception with a GC handle tracked by the bounded pinned-exception LRU.
+   *
+   * @returns The handle, or null when GC handles are unavailable
+   */
+  private tryPinException(exception: NativePointer): GCHandle | null {
+    try {
+      if (!this.exceptionHandlePool) {
+        this.exceptionHandlePool = new GCHandlePool(this);
+      }
+      const handle = this.exceptionHandlePool.create(exception, true);
+      this.pinnedExceptions.set(handle, true);
+      return handle;
+    } catch (_) {
+      return null;
+    }
+  }
+
   /**
    * Attempts to extract type and message from a managed exception object.
    * Falls back gracefully if extraction fails.
@@ -483,6 +693,7 @@ export class MonoApi {
 
       const typeNamePtr = this.native.mono_class_get_name(klass);
       const type = readUtf8String(typeNamePtr);
+      const stackTrace = this.tryReadExceptionStackTrace(exception, klass);
 
       // Try to extract message using mono_object_to_string if available
       if (this.hasExport("mono_object_to_string")) {
@@ -492,7 +703,7 @@ export class MonoApi {
 
         if (!pointerIsNull(msgObj) && pointerIsNull(excSlot.readPointer())) {
           const message = this.readMonoString(msgObj, true);
-          return { type, message };
+          return { type, message, stackTrace };
         }
       }
 
@@ -510,23 +721,52 @@ export class MonoApi {
 
           if (!pointerIsNull(strPtr) && pointerIsNull(excSlot.readPointer())) {
             const message = this.readMonoString(strPtr, true);
-            return { type, message };
+            return { type, message, stackTrace };
           }
         }
       } catch (_) {
         // Fallback failed, just return type
       }
 
-      return { type };
+      return { type, stackTrace };
     } catch (_error) {
       // Best effort - return empty if extraction fails
       return {};
     }
   }
 
+  /**
+   * Invokes the `StackTrace` getter (declared on System.Exception) on a managed exception.
+   *
+   * @returns Stack trace text, or undefined when unavailable
+   */
+  private tryReadExceptionStackTrace(exception: NativePointer, klass: NativePointer): string | undefined {
+    try {
+      const getterName = this.allocUtf8StringCached("get_StackTrace");
+      let current = klass;
+      while (!pointerIsNull(current)) {
+        const getter = this.native.mono_class_get_method_from_name(current, getterName, 0);
+        if (!pointerIsNull(getter)) {
+          const excSlot = Memory.alloc(Process.pointerSize);
+          excSlot.writePointer(NULL);
+          const strPtr = this.native.mono_runtime_invoke(getter, exception, NULL, excSlot);
+          if (pointerIsNull(strPtr) || !pointerIsNull(excSlot.readPointer())) {
+            return undefined;
+          }
+          return this.readMonoString(strPtr, true) || undefined;
+        }
+        current = this.native.mono_class_get_parent(current);
+      }
+    } catch (_) {
+      // Best effort
+    }
+    return undefined;
+  }
+
   /**
    * Read a MonoString pointer to JavaScript string using Mono API.
-   * Tries mono_string_to_utf8 first, then falls back to UTF-16 methods.
+   * Tries mono_string_to_utf8 first, then falls back to UTF-16 methods; the
+   * chain is resolved once by {@link RuntimeStrategies}.
    *
    * Memory management:
    * - mono_string_to_utf8: returns heap-allocated buffer, MUST be freed
@@ -538,48 +778,8 @@ export class MonoApi {
    * @returns JavaScript string or empty string if failed
    */
   readMonoString(strPtr: NativePointer, fallbackToChars = true): string {
-    if (pointerIsNull(strPtr)) return "";
-
-    // Try mono_string_to_utf8 first (most common)
-    // Note: mono_string_to_utf8 allocates memory that must be freed
-    if (this.hasExport("mono_string_to_utf8")) {
-      const utf8Ptr = this.native.mono_string_to_utf8(strPtr);
-      if (!pointerIsNull(utf8Ptr)) {
-        try {
-          return utf8Ptr.readUtf8String() || "";
-        } finally {
-          this.tryFree(utf8Ptr);
-        }
-      }
-    }
-
-    if (!fallbackToChars) return "";
-
-    // Fallback: Try mono_string_to_utf16
-    // Note: mono_string_to_utf16 allocates memory that must be freed
-    if (this.hasExport("mono_string_to_utf16")) {
-      const utf16Ptr = this.native.mono_string_to_utf16(strPtr);
-      if (!pointerIsNull(utf16Ptr)) {
-        try {
-          return utf16Ptr.readUtf16String() || "";
-        } finally {
-          this.tryFree(utf16Ptr);
-        }
-      }
-    }
-
-    // Last resort: Try mono_string_chars + mono_string_length
-    // Note: mono_string_chars returns a pointer INTO the managed string object
-    // This is NOT heap-allocated, do NOT free it
-    if (this.hasExport("mono_string_chars") && this.hasExport("mono_string_length")) {
-      const chars = this.native.mono_string_chars(strPtr);
-      const length = this.native.mono_string_length(strPtr) as number;
-      if (!pointerIsNull(chars) && length > 0) {
-        return chars.readUtf16String(length) || "";
-      }
-    }
-
-    return "";
+    const strategies = this.strategies;
+    return fallbackToChars ? strategies.readString(strPtr) : strategies.readStringUtf8(strPtr);
   }
 
   /**
@@ -601,7 +801,7 @@ export class MonoApi {
       return arg;
     }
     if (typeof arg === "string") {
-      return this.stringNew(arg);
+      return this.stringCache.get(arg);
     }
     if (typeof arg === "number" || typeof arg === "boolean" || typeof arg === "bigint") {
       raise(
@@ -633,15 +833,9 @@ export class MonoApi {
   getDelegateThunk(delegateClass: NativePointer): DelegateThunkInfo {
     this.ensureNotDisposed();
 
-    // NOTE: mono_method_get_unmanaged_thunk is only available in mono-2.0-bdwgc.dll
-    if (!this.hasExport("mono_method_get_unmanaged_thunk")) {
-      raise(
-        MonoErrorCodes.NOT_SUPPORTED,
-        "mono_method_get_unmanaged_thunk is not available on this Mono runtime (only in mono-2.0-bdwgc.dll)",
-        "Consider using runtime_invoke for delegate invocation instead",
-      );
-    }
-
+    // NOTE: mono_method_get_unmanaged_thunk is only available in mono-2.0-bdwgc.dll;
+    // elsewhere the bound strategy raises NOT_SUPPORTED
+    const createThunk = this.strategies.unmanagedThunk;
     const key = delegateClass.toString();
     return this.delegateThunkCache.getOrCreate(key, () => {
       const invoke = this.native.mono_get_delegate_invoke(delegateClass);
@@ -652,7 +846,7 @@ export class MonoApi {
           "Ensure the class is a valid delegate type",
         );
       }
-      const thunk = this.native.mono_method_get_unmanaged_thunk(invoke);
+      const thunk = createThunk(invoke);
       if (pointerIsNull(thunk)) {
         raise(
           MonoErrorCodes.NOT_SUPPORTED,
@@ -660,6 +854,8 @@ export class MonoApi {
           "This Mono build may not support unmanaged thunks",
         );
       }
+      const image = this.native.mono_class_get_image(delegateClass) as NativePointer;
+      this.delegateThunkImages.set(key, image.toString());
       return { invoke, thunk };
     });
   }
@@ -702,6 +898,7 @@ export class MonoApi {
    * - Native function cache
    * - Export address cache
    * - Delegate thunk cache
+   * - Managed string cache
    *
    * Cached items will be re-created on next access.
    */
@@ -709,8 +906,12 @@ export class MonoApi {
     this.ensureNotDisposed();
     this.functionCache.clear();
     this.addressCache.clear();
+    this.missingExports.clear();
     this.delegateThunkCache.clear();
+    this.delegateThunkImages.clear();
     this.utf8StringCache.clear();
+    this.managedStrings?.clear();
+    this.scopes?.invalidateAll();
   }
 
   /**
@@ -731,9 +932,21 @@ export class MonoApi {
     // Clear all caches
     this.functionCache.clear();
     this.addressCache.clear();
+    this.missingExports.clear();
     this.delegateThunkCache.clear();
     this.utf8StringCache.clear();
     this.pinnedUtf8Strings.clear();
+    this.managedStrings?.dispose();
+    this.managedStrings = null;
+    this.sessionState?.dispose();
+    this.sessionState = null;
+    this.scopes?.dispose();
+    this.scopes = null;
+    this.delegateThunkImages.clear();
+    // The pool frees every pinned exception in one batch; skip per-entry releases
+    this.pinnedExceptions.discard();
+    this.exceptionHandlePool?.dispose();
+    this.exceptionHandlePool = null;
 
     // Note on Memory.alloc cleanup:
     // Frida's Memory.alloc() pointers are managed by Frida's GC and do not require
@@ -770,6 +983,18 @@ export class MonoApi {
     }
   }
 
+  /**
+   * Drop delegate thunks whose class belongs to an invalidated image.
+   */
+  private purgeDelegateThunks(image: string): void {
+    for (const [key, owner] of this.delegateThunkImages) {
+      if (owner === image || !this.delegateThunkCache.has(key)) {
+        this.delegateThunkCache.delete(key);
+        this.delegateThunkImages.delete(key);
+      }
+    }
+  }
+
   /**
    * Track an allocated resource for cleanup
    */
@@ -906,43 +1131,14 @@ export class MonoApi {
    * 2. mono_unity_g_free (Unity Mono builds)
    * 3. g_free (fallback for older builds)
    *
+   * The function is picked once, see {@link RuntimeStrategies.free}.
    * If none are available, logs a warning on first occurrence.
    * This is acceptable for short-lived scripts but may leak in long sessions.
    */
   tryFree(ptr: NativePointer): void {
-    if (pointerIsNull(ptr)) return;
-
-    // Try mono_free first (standard Mono)
-    if (this.hasExport("mono_free")) {
-      this.native.mono_free(ptr);
-      return;
-    }
-
-    // Try mono_unity_g_free (Unity Mono builds)
-    if (this.hasExport("mono_unity_g_free")) {
-      this.native.mono_unity_g_free(ptr);
-      return;
-    }
-
-    // Fallback to g_free
-    if (this.hasExport("g_free")) {
-      this.native.g_free(ptr);
-      return;
-    }
-
-    // No free function available - log warning once
-    if (!this._warnedAboutMissingFree) {
-      this._warnedAboutMissingFree = true;
-      console.warn(
-        "[frida-mono-bridge] No free function available (mono_free, mono_unity_g_free, g_free). " +
-          "Memory allocated by Mono APIs will leak. This may be acceptable for short-lived scripts.",
-      );
-    }
+    this.strategies.free(ptr);
   }
 
-  /** Track whether we've warned about missing free function */
-  private _warnedAboutMissingFree = false;
-
   // ============================================================================
   // EXPORT RESOLUTION AND MODULE ACCESS
   // ============================================================================
@@ -1026,6 +1222,9 @@ export class MonoApi {
     if (cached) {
       return cached;
     }
+    if (this.missingExports.has(name)) {
+      return null;
+    }
 
     const moduleHandle = this.tryGetModuleHandle();
     if (!moduleHandle) {
@@ -1041,9 +1240,50 @@ export class MonoApi {
       }
     }
 
+    this.missingExports.add(name);
     return null;
   }
 
+  /**
+   * Resolved exports as offsets from the module base, for persisting across script reloads.
+   * Exports known to be missing are reported as -1.
+   */
+  getExportOffsets(): Record<string, number> {
+    const offsets: Record<string, number> = {};
+    const base = this.module.base;
+    for (const [name, address] of this.addressCache.entries()) {
+      offsets[name] = address.sub(base).toUInt32();
+    }
+    for (const name of this.missingExports) {
+      offsets[name] = -1;
+    }
+    return offsets;
+  }
+
+  /**
+   * Seed the export caches from {@link getExportOffsets} output of an earlier session.
+   * The caller must have verified that the module is the same binary.
+   *
+   * @returns Number of seeded exports
+   */
+  seedExportOffsets(offsets: Readonly<Record<string, number>>): number {
+    this.ensureNotDisposed();
+    let seeded = 0;
+    for (const name of Object.keys(offsets)) {
+      const offset = offsets[name];
+      if (!tryGetSignature(name) || !Number.isInteger(offset) || offset >= this.module.size) {
+        continue;
+      }
+      if (offset < 0) {
+        this.missingExports.add(name as MonoApiName);
+      } else {
+        this.addressCache.set(name as MonoApiName, this.module.base.add(offset));
+      }
+      seeded++;
+    }
+    return seeded;
+  }
+
   /**
    * Resolve an export address, throwing if not found.
    * @throws {MonoExportNotFoundError} if export not found
@@ -1117,25 +1357,22 @@ export class MonoApi {
   private createNativeBindings(): MonoNativeBindings {
     const bindings: Partial<MonoNativeBindings> = {};
     const target = bindings as Record<MonoApiName, (...args: MonoArg[]) => any>;
+    // Generated stubs keep hot exports on fixed-arity call sites; the rest use the generic wrapper
+    const stubContext: NativeStubContext = {
+      direct: () => {
+        const manager = this.threadManager;
+        return !manager || manager.isInAttachedContext();
+      },
+      run: fn => (this.threadManager ? this.threadManager.run(fn) : fn()),
+    };
     for (const name of ALL_MONO_EXPORTS) {
       Object.defineProperty(target, name, {
         configurable: true,
         enumerable: true,
         get: () => {
           const nativeFn = this.getNativeFunction(name);
-          const wrapper = (...args: MonoArg[]) => {
-            const invoke = () => nativeFn(...args.map(normalizeArg));
-            const manager = this.threadManager;
-
-            if (manager) {
-              if (manager.isInAttachedContext()) {
-                return invoke();
-              }
-              return manager.run(invoke);
-            }
-
-            return invoke();
-          };
+          const stub = SHARED_NATIVE_STUBS[name] ?? FLAVOR_NATIVE_STUBS[name];
+          const wrapper = stub ? stub(nativeFn, stubContext) : this.createGenericBinding(nativeFn);
           Object.defineProperty(target, name, {
             configurable: false,
             enumerable: true,
@@ -1149,6 +1386,24 @@ export class MonoApi {
     return target as MonoNativeBindings;
   }
 
+  private createGenericBinding(
+    nativeFn: NativeFunction<NativeFunctionReturnValue, NativeFunctionArgumentValue[]>,
+  ): MonoNativeFunction {
+    return (...args: MonoArg[]) => {
+      const invoke = () => nativeFn(...args.map(normalizeArg));
+      const manager = this.threadManager;
+
+      if (manager) {
+        if (manager.isInAttachedContext()) {
+          return invoke();
+        }
+        return manager.run(invoke);
+      }
+
+      return invoke();
+    };
+  }
+
   private getExceptionSlot(): NativePointer {
     this.ensureNotDisposed();
 
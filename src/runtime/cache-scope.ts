@@ -0,0 +1,326 @@
+/**
+ * Cache Scopes - Invalidate caches per AppDomain and image instead of globally.
+ *
+ * Model caches (domain assembly lists, image class lists, class method lookups)
+ * and pointer-keyed API caches stay valid only while the domain or image they
+ * were built from is unchanged. {@link CacheScopeRegistry} keeps a generation
+ * counter per domain and image pointer; scoped caches record the generation
+ * they were filled at and rebuild when it moves. Once {@link CacheScopeRegistry.install}
+ * has run (during `Mono` initialization unless `trackCacheScopes` is false),
+ * generations are bumped by:
+ * - `mono_install_assembly_load_hook`: a new assembly changes its domain's assembly list
+ * - `mono_assembly_close`: the assembly's image (and the domains it was loaded into)
+ * - `mono_domain_unload`: the domain and every image loaded into it
+ *
+ * Other domains and images keep their warm caches. Counters never hold model
+ * objects, so short-lived wrappers are not kept alive by the registry.
+ *
+ * Counters are keyed by the low 32 bits of the scope address, which keeps
+ * {@link CacheScopeRegistry.generation} free of string conversions. Two scopes
+ * sharing a key are simply invalidated together.
+ *
+ * @module runtime/cache-scope
+ */
+
+import { Logger } from "../utils/log";
+import { pointerIsNull } from "../utils/memory";
+import type { MonoApi } from "./api";
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+/** Kind of cache scope; `"all"` is sent by {@link CacheScopeRegistry.invalidateAll}. */
+export type CacheScopeKind = "domain" | "image" | "all";
+
+/** Why a scope was invalidated. */
+export type CacheScopeReason = "assembly-load" | "assembly-close" | "domain-unload" | "manual";
+
+/**
+ * Notification sent to {@link CacheScopeRegistry.onInvalidate} listeners.
+ */
+export interface CacheScopeEvent {
+  kind: CacheScopeKind;
+  /** Invalidated domain or image; NULL for `"all"` */
+  scope: NativePointer;
+  reason: CacheScopeReason;
+}
+
+/**
+ * Counters for a {@link CacheScopeRegistry}.
+ */
+export interface CacheScopeStats {
+  /** Whether runtime hooks drive invalidation */
+  tracking: boolean;
+  /** Scopes invalidated at least once */
+  scopes: number;
+  /** Images known per domain, summed over domains */
+  images: number;
+  invalidations: number;
+}
+
+export type CacheScopeListener = (event: CacheScopeEvent) => void;
+
+const scopeLogger = Logger.withTag("CacheScope");
+
+/** Images recorded for one domain, keyed like the generation counters. */
+interface DomainImages {
+  domain: NativePointer;
+  images: Map<number, NativePointer>;
+}
+
+/**
+ * Assembly load callbacks cannot be uninstalled, so they stay referenced for
+ * the lifetime of the script; disposed registries simply stop reacting.
+ */
+const retainedLoadHooks: NativeCallback<"void", ["pointer", "pointer"]>[] = [];
+
+// ============================================================================
+// CACHE SCOPE REGISTRY
+// ============================================================================
+
+/**
+ * Generation counters for domain and image scoped caches.
+ *
+ * @example
+ * ```typescript
+ * const scopes = api.cacheScopes;
+ * scopes.install();
+ * const before = scopes.generation(domain.pointer);
+ * // ... an assembly loads ...
+ * scopes.generation(domain.pointer) !== before; // domain caches rebuild
+ * ```
+ */
+export class CacheScopeRegistry {
+  private readonly generations = new Map<number, number>();
+  private readonly domainImages = new Map<number, DomainImages>();
+  private readonly listeners = new Set<CacheScopeListener>();
+  private readonly interceptors: InvocationListener[] = [];
+  private epoch = 0;
+  private invalidations = 0;
+  private hooked = false;
+  private tracking = false;
+  private disposed = false;
+
+  constructor(private readonly api: MonoApi) {}
+
+  /** Whether runtime hooks were installed and drive invalidation. */
+  get isTracking(): boolean {
+    return this.tracking;
+  }
+
+  /**
+   * Current generation of a domain or image scope.
+   * Changes whenever the scope, or all scopes, are invalidated.
+   */
+  generation(scope: NativePointer): number {
+    if (this.generations.size === 0) {
+      return this.epoch;
+    }
+    return this.epoch + (this.generations.get(scope.toUInt32()) ?? 0);
+  }
+
+  /**
+   * Install the runtime hooks that drive invalidation. Idempotent.
+   *
+   * The assembly load hook cannot be removed again, so this runs once during
+   * initialization rather than on the first cache lookup.
+   *
+   * @returns Whether at least one hook is active
+   */
+  install(): boolean {
+    if (!this.hooked && !this.disposed) {
+      this.hooked = true;
+      this.installHooks();
+    }
+    return this.tracking;
+  }
+
+  /**
+   * Invalidate caches built from one domain.
+   * @param cascade Also invalidate images known to be loaded into the domain
+   */
+  invalidateDomain(domain: NativePointer, reason: CacheScopeReason = "manual", cascade = false): void {
+    const key = domain.toUInt32();
+    this.bump(key, "domain", domain, reason);
+    if (cascade) {
+      const entry = this.domainImages.get(key);
+      if (entry) {
+        for (const [image, pointer] of entry.images) {
+          this.bump(image, "image", pointer, reason);
+        }
+      }
+      this.domainImages.delete(key);
+    }
+  }
+
+  /**
+   * Invalidate caches built from one image, and the assembly lists of domains it was loaded into.
+   * @returns Whether the image was known to belong to any domain
+   */
+  invalidateImage(image: NativePointer, reason: CacheScopeReason = "manual"): boolean {
+    const key = image.toUInt32();
+    let known = false;
+    this.bump(key, "image", image, reason);
+    for (const [domain, entry] of this.domainImages) {
+      if (entry.images.delete(key)) {
+        known = true;
+        this.bump(domain, "domain", entry.domain, reason);
+      }
+    }
+    return known;
+  }
+
+  /**
+   * Invalidate every scope at once, e.g. on `Mono.reset()`.
+   */
+  invalidateAll(): void {
+    this.epoch++;
+    this.invalidations++;
+    this.notify({ kind: "all", scope: NULL, reason: "manual" });
+  }
+
+  /**
+   * Record that `image` belongs to `domain`, so unloading the domain invalidates it.
+   */
+  noteImage(domain: NativePointer, image: NativePointer): void {
+    if (pointerIsNull(domain) || pointerIsNull(image)) {
+      return;
+    }
+    const key = domain.toUInt32();
+    let entry = this.domainImages.get(key);
+    if (!entry) {
+      entry = { domain, images: new Map() };
+      this.domainImages.set(key, entry);
+    }
+    entry.images.set(image.toUInt32(), image);
+  }
+
+  /**
+   * Subscribe to invalidations, e.g. to purge pointer-keyed entries.
+   * @returns Function removing the listener
+   */
+  onInvalidate(listener: CacheScopeListener): () => void {
+    this.listeners.add(listener);
+    return () => this.listeners.delete(listener);
+  }
+
+  /** Get counters. */
+  getStats(): CacheScopeStats {
+    let images = 0;
+    for (const entry of this.domainImages.values()) {
+      images += entry.images.size;
+    }
+    return {
+      tracking: this.tracking,
+      scopes: this.generations.size,
+      images,
+      invalidations: this.invalidations,
+    };
+  }
+
+  /** Detach interceptors and stop reacting to runtime hooks. */
+  dispose(): void {
+    this.disposed = true;
+    for (const interceptor of this.interceptors) {
+      interceptor.detach();
+    }
+    this.interceptors.length = 0;
+    this.listeners.clear();
+    this.generations.clear();
+    this.domainImages.clear();
+  }
+
+  // ===== INTERNAL =====
+
+  private bump(key: number, kind: CacheScopeKind, scope: NativePointer, reason: CacheScopeReason): void {
+    this.generations.set(key, (this.generations.get(key) ?? 0) + 1);
+    this.invalidations++;
+    this.notify({ kind, scope, reason });
+  }
+
+  private notify(event: CacheScopeEvent): void {
+    for (const listener of this.listeners) {
+      try {
+        listener(event);
+      } catch (error) {
+        scopeLogger.debug(`Invalidation listener failed: ${error}`);
+      }
+    }
+  }
+
+  private installHooks(): void {
+    const api = this.api;
+    let installed = 0;
+
+    if (api.hasExport("mono_install_assembly_load_hook")) {
+      try {
+        const hook = new NativeCallback(
+          (assembly: NativePointer) => {
+            if (!this.disposed) {
+              this.onAssemblyLoad(assembly);
+            }
+          },
+          "void",
+          ["pointer", "pointer"],
+        );
+        retainedLoadHooks.push(hook);
+        api.native.mono_install_assembly_load_hook(hook, NULL);
+        installed++;
+      } catch (error) {
+        scopeLogger.debug(`Assembly load hook unavailable: ${error}`);
+      }
+    }
+
+    const close = api.tryResolveAddress("mono_assembly_close");
+    if (close) {
+      this.attach(close, args => this.onAssemblyClose(args[0]));
+      installed++;
+    }
+
+    const unload = api.tryResolveAddress("mono_domain_unload");
+    if (unload) {
+      this.attach(unload, args => this.invalidateDomain(args[0], "domain-unload", true));
+      installed++;
+    }
+
+    this.tracking = installed > 0;
+  }
+
+  private attach(target: NativePointer, onEnter: (args: InvocationArguments) => void): void {
+    try {
+      this.interceptors.push(Interceptor.attach(target, { onEnter }));
+    } catch (error) {
+      scopeLogger.debug(`Failed to hook ${target}: ${error}`);
+    }
+  }
+
+  private onAssemblyLoad(assembly: NativePointer): void {
+    try {
+      const domain = this.api.native.mono_domain_get() as NativePointer;
+      if (pointerIsNull(domain)) {
+        return;
+      }
+      this.noteImage(domain, this.api.native.mono_assembly_get_image(assembly) as NativePointer);
+      this.invalidateDomain(domain, "assembly-load");
+    } catch (error) {
+      scopeLogger.debug(`Assembly load tracking failed: ${error}`);
+    }
+  }
+
+  private onAssemblyClose(assembly: NativePointer): void {
+    try {
+      const image = this.api.native.mono_assembly_get_image(assembly) as NativePointer;
+      if (pointerIsNull(image) || this.invalidateImage(image, "assembly-close")) {
+        return;
+      }
+      // Loaded before tracking started: the closing domain is the current one
+      const domain = this.api.native.mono_domain_get() as NativePointer;
+      if (!pointerIsNull(domain)) {
+        this.invalidateDomain(domain, "assembly-close");
+      }
+    } catch (error) {
+      scopeLogger.debug(`Assembly close tracking failed: ${error}`);
+    }
+  }
+}
@@ -18,16 +18,20 @@ import { MonoApi } from "./api";
 // Logger for GC handle operations
 const gcHandleLogger = Logger.withTag("GCHandle");
 
-type GCHandleToken = number | bigint;
+export type GCHandleToken = number | bigint;
 
-type GCHandleAbiKind = "v1" | "v2";
+/** GC handle ABI flavour: v1 uses guint32 handle ids, v2 pointer-sized handles. */
+export type GCHandleAbiKind = "v1" | "v2";
 
-interface GCHandleAbi {
+/** GC handle operations bound to one ABI. */
+export interface GCHandleAbi {
   kind: GCHandleAbiKind;
   create(object: NativePointer, pinned: boolean): GCHandleToken;
   createWeak(object: NativePointer, trackResurrection: boolean): GCHandleToken;
   getTarget(handle: GCHandleToken): NativePointer;
   free(handle: GCHandleToken): void;
+  /** Free many handles in one native loop when a CModule is available */
+  freeMany(handles: GCHandleToken[]): void;
 }
 
 function pointerToToken(value: NativePointer): bigint {
@@ -51,7 +55,11 @@ function zeroToken(kind: GCHandleAbiKind): GCHandleToken {
   return kind === "v2" ? 0n : 0;
 }
 
-function selectGCHandleAbi(api: MonoApi): GCHandleAbi {
+/**
+ * Probe the runtime for the v2 handle exports and bind the matching ABI.
+ * Resolved once per runtime through `api.strategies.gcHandles`.
+ */
+export function selectGCHandleAbi(api: MonoApi): GCHandleAbi {
   const hasV2 =
     api.hasExport("mono_gchandle_new_v2") &&
     api.hasExport("mono_gchandle_new_weakref_v2") &&
@@ -75,6 +83,9 @@ function selectGCHandleAbi(api: MonoApi): GCHandleAbi {
       free(handle) {
         api.native.mono_gchandle_free_v2(tokenToPointer(handle));
       },
+      freeMany(handles) {
+        freeHandles(api, this, "mono_gchandle_free_v2", handles);
+      },
     };
   }
 
@@ -107,9 +118,82 @@ function selectGCHandleAbi(api: MonoApi): GCHandleAbi {
       }
       api.native.mono_gchandle_free(handle);
     },
+    freeMany(handles) {
+      freeHandles(api, this, "mono_gchandle_free", handles);
+    },
   };
 }
 
+/**
+ * Free `handles` with one call into a CModule loop instead of one
+ * NativeFunction call per handle; falls back to per-handle frees.
+ */
+function freeHandles(
+  api: MonoApi,
+  abi: GCHandleAbi,
+  exportName: "mono_gchandle_free" | "mono_gchandle_free_v2",
+  handles: GCHandleToken[],
+): void {
+  if (handles.length === 0) {
+    return;
+  }
+  const kernel = getFreeKernel(abi.kind);
+  const freeFn = kernel ? api.tryResolveAddress(exportName) : null;
+  if (!kernel || !freeFn) {
+    for (const handle of handles) {
+      try {
+        abi.free(handle);
+      } catch (error) {
+        gcHandleLogger.debug(`Error freeing handle ${handle}: ${error}`);
+      }
+    }
+    return;
+  }
+
+  // v1 ids are guint32; v2 handles are pointer-sized
+  let words: ArrayBuffer;
+  if (abi.kind === "v1") {
+    words = Uint32Array.from(handles, Number).buffer;
+  } else if (Process.pointerSize === 8) {
+    words = BigUint64Array.from(handles, BigInt).buffer;
+  } else {
+    words = Uint32Array.from(handles, Number).buffer;
+  }
+  const buffer = Memory.alloc(words.byteLength);
+  buffer.writeByteArray(words);
+
+  const run = () => kernel(freeFn, buffer, handles.length);
+  const manager = api.getThreadManager();
+  try {
+    if (manager) {
+      manager.runIfNeeded(run);
+    } else {
+      run();
+    }
+  } catch (error) {
+    gcHandleLogger.debug(`Batched free of ${handles.length} handles failed: ${error}`);
+  }
+}
+
+type FreeKernel = NativeFunction<void, [NativePointer, NativePointer, number]>;
+
+let freeModule: CModule | null | undefined;
+const freeKernels: Partial<Record<GCHandleAbiKind, FreeKernel>> = {};
+
+function getFreeKernel(kind: GCHandleAbiKind): FreeKernel | null {
+  if (freeModule === undefined) {
+    try {
+      freeModule = new CModule(FREE_KERNEL_SOURCE);
+      freeKernels.v1 = new NativeFunction(freeModule.free_handles_v1, "void", ["pointer", "pointer", "uint"]);
+      freeKernels.v2 = new NativeFunction(freeModule.free_handles_v2, "void", ["pointer", "pointer", "uint"]);
+    } catch (error) {
+      gcHandleLogger.debug(`CModule unavailable, freeing handles one by one: ${error}`);
+      freeModule = null;
+    }
+  }
+  return freeKernels[kind] ?? null;
+}
+
 // ============================================================================
 // TYPE DEFINITIONS
 // ============================================================================
@@ -284,6 +368,21 @@ export class GCHandle {
     this.#freed = true;
   }
 
+  /**
+   * Mark this handle freed without calling the runtime and return its token,
+   * so a pool can free many handles in one batch. Returns null if already freed.
+   * @internal
+   */
+  takeToken(): GCHandleToken | null {
+    if (this.#freed || isZeroToken(this.#handle)) {
+      return null;
+    }
+    const token = this.#handle;
+    this.#handle = zeroToken(this.abi.kind);
+    this.#freed = true;
+    return token;
+  }
+
   /**
    * Ensure this handle is valid, throwing if freed.
    * @throws {MonoError} if handle has been freed
@@ -343,7 +442,7 @@ export class GCHandlePool {
   private readonly abi: GCHandleAbi;
 
   constructor(private readonly api: MonoApi) {
-    this.abi = selectGCHandleAbi(api);
+    this.abi = api.strategies.gcHandles;
     gcHandleLogger.debug(`Using GCHandle ABI: ${this.abi.kind}`);
   }
 
@@ -489,20 +588,26 @@ export class GCHandlePool {
   /**
    * Release all handles in this pool.
    *
-   * Frees all handles and clears the pool. Does not dispose
-   * the pool - new handles can still be created.
+   * Frees all handles through one native loop and clears the pool.
+   * Does not dispose the pool - new handles can still be created.
+   *
+   * @returns Number of handles freed by this call; handles already freed directly are not counted
    */
-  releaseAll(): void {
+  releaseAll(): number {
+    if (this.handles.size === 0) {
+      return 0;
+    }
+    const tokens: GCHandleToken[] = [];
     for (const handle of this.handles) {
-      try {
-        handle.free();
-      } catch (error) {
-        // Silently handle errors during handle release
-        gcHandleLogger.debug(`Error releasing handle ${handle.handle}: ${error}`);
+      const token = handle.takeToken();
+      if (token !== null) {
+        tokens.push(token);
       }
-      this.totalReleased++;
     }
     this.handles.clear();
+    this.totalReleased += tokens.length;
+    this.abi.freeMany(tokens);
+    return tokens.length;
   }
 
   /**
@@ -601,3 +706,28 @@ export class GCHandlePool {
     }
   }
 }
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+/** Call the runtime's free function once per handle id. */
+const FREE_KERNEL_SOURCE = `
+void
+free_handles_v1 (void (* free_fn) (unsigned int), const unsigned int * handles, unsigned int count)
+{
+  unsigned int i;
+
+  for (i = 0; i != count; i++)
+    free_fn (handles[i]);
+}
+
+void
+free_handles_v2 (void (* free_fn) (void *), void * const * handles, unsigned int count)
+{
+  unsigned int i;
+
+  for (i = 0; i != count; i++)
+    free_fn (handles[i]);
+}
+`;
@@ -19,6 +19,7 @@ export * from "./api";
 // ===== THREAD MANAGEMENT =====
 // Thread attachment and execution context management
 export * from "./thread";
+export * from "./safepoint";
 
 // ===== MODULE DISCOVERY =====
 // Mono module finding and loading
@@ -28,10 +29,22 @@ export * from "./module";
 // Garbage collection handle management
 export * from "./gchandle";
 
+// ===== CACHE SCOPES =====
+// Per-domain/image cache invalidation
+export * from "./cache-scope";
+
+// ===== SESSION STATE =====
+// Warm state persistence across script reloads
+export * from "./session-state";
+
 // ===== RUNTIME INFO =====
 // Version detection and feature flags
 export * from "./version";
 
+// ===== STRATEGIES =====
+// Capability-resolved implementations selected once per runtime
+export * from "./strategies";
+
 // ===== METADATA =====
 // Attribute flags and utilities
 export * from "./metadata";
@@ -3,7 +3,7 @@
  *
  * Provides utilities for discovering the Mono runtime in a process:
  * - Automatic detection by common module names
- * - Export-based heuristic detection
+ * - Export-based heuristic detection (sentinel probes, cached per module file)
  * - Async waiting for delayed module loading
  * - Manual module name specification
  *
@@ -57,6 +57,25 @@ export interface ModuleDiscoveryResult {
   confidence?: number;
 }
 
+/**
+ * A discovered Mono module and the process module list it was found in.
+ */
+export interface MonoModuleDiscovery {
+  module: MonoModuleInfo;
+  /** Modules enumerated by the successful poll; pass to {@link findAllMonoModules} to avoid enumerating again */
+  loadedModules: Module[];
+}
+
+/**
+ * Cached heuristic verdict for one module file, keyed by path and size.
+ * `hits` is the number of known Mono exports, or 0 for modules that failed the sentinel probe.
+ */
+export interface ModuleDiscoveryCacheEntry {
+  path: string;
+  size: number;
+  hits: number;
+}
+
 // ============================================================================
 // CONSTANTS
 // ============================================================================
@@ -83,9 +102,16 @@ const COMMON_MODULE_NAMES = [
 
 /**
  * Key exports used for heuristic module detection.
+ * Probed in order; a module missing any of them is not scored further.
  */
 const PROBE_EXPORT_NAMES = ["mono_runtime_invoke", "mono_thread_attach", "mono_get_root_domain"] as const;
 
+/** Heuristic verdicts by `path|size`; survives repeated discovery and `Mono.reset()`. */
+const discoveryCache = new Map<string, number>();
+
+/** All known Mono export names and aliases, built on first heuristic scan. */
+let knownExportNames: Set<string> | null = null;
+
 // ============================================================================
 // MODULE DISCOVERY
 // ============================================================================
@@ -119,11 +145,13 @@ export function tryFindMonoModule(moduleName?: string | string[]): MonoModuleInf
  * Try to find the Mono module with additional discovery details.
  *
  * @param moduleName Optional specific module name(s) to search for
+ * @param modules Process modules to search (default: enumerate now)
  * @returns Discovery result with module and detection method, or null
  */
-export function tryFindMonoModuleWithDetails(moduleName?: string | string[]): ModuleDiscoveryResult | null {
-  const modules = Process.enumerateModules();
-
+export function tryFindMonoModuleWithDetails(
+  moduleName?: string | string[],
+  modules: Module[] = Process.enumerateModules(),
+): ModuleDiscoveryResult | null {
   // Strategy 1: Explicit module name(s)
   const candidates = normalizeCandidates(moduleName);
   if (candidates.length > 0) {
@@ -158,6 +186,72 @@ export function tryFindMonoModuleWithDetails(moduleName?: string | string[]): Mo
   return null;
 }
 
+/**
+ * Find every Mono runtime module loaded in the process.
+ *
+ * Processes sometimes embed more than one runtime (e.g. a game plus a plugin
+ * host, or a legacy `mono.dll` next to `mono-2.0-bdwgc.dll`). Modules are
+ * enumerated once and matched with the same strategies as
+ * {@link tryFindMonoModuleWithDetails}; results are ordered by strategy
+ * (explicit, common name, heuristic score) and deduplicated by base address,
+ * so the first entry is the module `tryFindMonoModule` would pick.
+ *
+ * @param moduleName Optional specific module name(s) to rank first
+ * @param modules Process modules to search (default: enumerate now)
+ * @returns All discovered runtimes, possibly empty
+ *
+ * @example
+ * ```typescript
+ * for (const { module, method } of findAllMonoModules()) {
+ *   console.log(`${module.name} @ ${module.base} (${method})`);
+ * }
+ * ```
+ */
+export function findAllMonoModules(
+  moduleName?: string | string[],
+  modules: Module[] = Process.enumerateModules(),
+): ModuleDiscoveryResult[] {
+  const results: ModuleDiscoveryResult[] = [];
+  const seen = new Set<string>();
+  const add = (mod: Module, method: ModuleDiscoveryResult["method"], confidence?: number) => {
+    const key = mod.base.toString();
+    if (!seen.has(key)) {
+      seen.add(key);
+      const result: ModuleDiscoveryResult = { module: normalizeModuleInfo(mod), method };
+      if (confidence !== undefined) {
+        result.confidence = confidence;
+      }
+      results.push(result);
+    }
+  };
+
+  for (const candidate of normalizeCandidates(moduleName)) {
+    for (const mod of modules) {
+      if (matchesModuleName(mod, candidate)) {
+        add(mod, "explicit");
+      }
+    }
+  }
+
+  for (const candidate of COMMON_MODULE_NAMES) {
+    for (const mod of modules) {
+      if (matchesModuleName(mod, candidate)) {
+        add(mod, "common-name");
+      }
+    }
+  }
+
+  const scored = modules
+    .map(mod => ({ mod, hits: getModuleScore(mod) }))
+    .filter(entry => entry.hits > 0)
+    .sort((a, b) => b.hits - a.hits);
+  for (const { mod, hits } of scored) {
+    add(mod, "export-heuristic", Math.min(1, hits / PROBE_EXPORT_NAMES.length));
+  }
+
+  return results;
+}
+
 /**
  * Try to wait for the Mono module to load without throwing.
  *
@@ -176,15 +270,20 @@ export function tryFindMonoModuleWithDetails(moduleName?: string | string[]): Mo
  * ```
  */
 export async function tryWaitForMonoModule(options: MonoModuleWaitOptions): Promise<MonoModuleInfo | null> {
+  return (await pollForMonoModule(options))?.module ?? null;
+}
+
+async function pollForMonoModule(options: MonoModuleWaitOptions): Promise<MonoModuleDiscovery | null> {
   const pollIntervalMs = options.pollIntervalMs ?? 50;
   const deadline = Date.now() + options.timeoutMs;
   const warnAt = Date.now() + options.warnAfterMs;
   let didWarn = false;
 
   while (Date.now() < deadline) {
-    const moduleInfo = tryFindMonoModule(options.moduleName);
-    if (moduleInfo) {
-      return moduleInfo;
+    const loadedModules = Process.enumerateModules();
+    const result = tryFindMonoModuleWithDetails(options.moduleName, loadedModules);
+    if (result) {
+      return { module: result.module, loadedModules };
     }
 
     if (!didWarn && Date.now() >= warnAt) {
@@ -221,9 +320,21 @@ export async function tryWaitForMonoModule(options: MonoModuleWaitOptions): Prom
  * ```
  */
 export async function waitForMonoModule(options: MonoModuleWaitOptions): Promise<MonoModuleInfo> {
-  const moduleInfo = await tryWaitForMonoModule(options);
-  if (moduleInfo) {
-    return moduleInfo;
+  return (await waitForMonoModuleDiscovery(options)).module;
+}
+
+/**
+ * Wait for the Mono module like {@link waitForMonoModule}, also returning the
+ * module list it was found in so multi-runtime discovery can reuse it.
+ *
+ * @param options Wait options
+ * @returns Module info and the enumerated process modules
+ * @throws {MonoModuleNotFoundError} if module not found within timeout
+ */
+export async function waitForMonoModuleDiscovery(options: MonoModuleWaitOptions): Promise<MonoModuleDiscovery> {
+  const discovery = await pollForMonoModule(options);
+  if (discovery) {
+    return discovery;
   }
 
   const candidates = normalizeCandidates(options.moduleName);
@@ -284,16 +395,50 @@ export function isMonoModule(moduleName: string): boolean {
       return false;
     }
 
-    const exports = mod.enumerateExports();
-    const exportSet = new Set(exports.map(e => e.name));
-
-    // Check for key Mono exports
-    return PROBE_EXPORT_NAMES.some(name => exportSet.has(name));
+    return PROBE_EXPORT_NAMES.some(name => mod.findExportByName(name) !== null);
   } catch {
     return false;
   }
 }
 
+/**
+ * Snapshot the export-heuristic cache, e.g. to persist it across script reloads.
+ *
+ * @example
+ * ```typescript
+ * File.writeAllText(path, JSON.stringify(exportModuleDiscoveryCache()));
+ * // next load
+ * importModuleDiscoveryCache(JSON.parse(File.readAllText(path)));
+ * ```
+ */
+export function exportModuleDiscoveryCache(): ModuleDiscoveryCacheEntry[] {
+  const entries: ModuleDiscoveryCacheEntry[] = [];
+  for (const [key, hits] of discoveryCache) {
+    const separator = key.lastIndexOf("|");
+    entries.push({ path: key.slice(0, separator), size: Number(key.slice(separator + 1)), hits });
+  }
+  return entries;
+}
+
+/**
+ * Seed the export-heuristic cache with previously exported entries.
+ * Entries only apply to modules whose path and size still match.
+ */
+export function importModuleDiscoveryCache(entries: ReadonlyArray<ModuleDiscoveryCacheEntry>): void {
+  for (const entry of entries) {
+    if (typeof entry.path === "string" && Number.isFinite(entry.size) && Number.isFinite(entry.hits)) {
+      discoveryCache.set(cacheKey(entry), entry.hits);
+    }
+  }
+}
+
+/**
+ * Forget all cached export-heuristic verdicts.
+ */
+export function clearModuleDiscoveryCache(): void {
+  discoveryCache.clear();
+}
+
 /**
  * Get all common Mono module names.
  * Useful for debugging or manual discovery.
@@ -307,35 +452,30 @@ export function getCommonModuleNames(): readonly string[] {
 // ============================================================================
 
 function findModuleByName(modules: Module[], name: string): Module | undefined {
-  return modules.find(m => m.name === name || m.path.endsWith(`/${name}`) || m.path.endsWith(`\\${name}`));
+  return modules.find(m => matchesModuleName(m, name));
 }
 
-function findByExportHeuristic(modules: Module[]): ModuleDiscoveryResult | null {
-  // Build complete set of known Mono export names
-  const exportNames = new Set<string>(PROBE_EXPORT_NAMES);
-  for (const name of Object.keys(MONO_EXPORTS) as MonoApiName[]) {
-    exportNames.add(name);
-    const signature = MONO_EXPORTS[name] as MonoExportSignature;
-    if (signature.aliases) {
-      for (const alias of signature.aliases) {
-        exportNames.add(alias);
-      }
-    }
-  }
+function matchesModuleName(mod: Module, name: string): boolean {
+  return mod.name === name || mod.path.endsWith(`/${name}`) || mod.path.endsWith(`\\${name}`);
+}
 
+/**
+ * Score modules by their Mono exports.
+ *
+ * Each module is first probed for the sentinel exports by name, stopping at
+ * the first miss, so the hundreds of unrelated libraries in a typical process
+ * cost a single lookup each. Only survivors have their exports enumerated and
+ * counted. Verdicts are cached per module path and size.
+ */
+function findByExportHeuristic(modules: Module[]): ModuleDiscoveryResult | null {
   let bestMatch: MonoModuleInfo | null = null;
   let bestHits = 0;
 
   for (const mod of modules) {
-    try {
-      const exports = mod.enumerateExports();
-      const hits = exports.reduce((count, item) => count + (exportNames.has(item.name) ? 1 : 0), 0);
-      if (hits > bestHits) {
-        bestHits = hits;
-        bestMatch = normalizeModuleInfo(mod);
-      }
-    } catch (_error) {
-      // Some system modules cannot be enumerated; ignore
+    const hits = getModuleScore(mod);
+    if (hits > bestHits) {
+      bestHits = hits;
+      bestMatch = normalizeModuleInfo(mod);
     }
   }
 
@@ -350,6 +490,51 @@ function findByExportHeuristic(modules: Module[]): ModuleDiscoveryResult | null
   return null;
 }
 
+function getModuleScore(mod: Module): number {
+  const key = cacheKey(mod);
+  let hits = discoveryCache.get(key);
+  if (hits === undefined) {
+    hits = scoreModule(mod);
+    discoveryCache.set(key, hits);
+  }
+  return hits;
+}
+
+function scoreModule(mod: Module): number {
+  try {
+    for (const name of PROBE_EXPORT_NAMES) {
+      if (mod.findExportByName(name) === null) {
+        return 0;
+      }
+    }
+    const exportNames = getKnownExportNames();
+    return mod.enumerateExports().reduce((count, item) => count + (exportNames.has(item.name) ? 1 : 0), 0);
+  } catch (_error) {
+    // Some system modules cannot be enumerated; ignore
+    return 0;
+  }
+}
+
+function getKnownExportNames(): Set<string> {
+  if (!knownExportNames) {
+    knownExportNames = new Set<string>(PROBE_EXPORT_NAMES);
+    for (const name of Object.keys(MONO_EXPORTS) as MonoApiName[]) {
+      knownExportNames.add(name);
+      const signature = MONO_EXPORTS[name] as MonoExportSignature;
+      if (signature.aliases) {
+        for (const alias of signature.aliases) {
+          knownExportNames.add(alias);
+        }
+      }
+    }
+  }
+  return knownExportNames;
+}
+
+function cacheKey(mod: { path: string; size: number }): string {
+  return `${mod.path}|${mod.size}`;
+}
+
 function normalizeCandidates(moduleName?: string | string[]): string[] {
   if (!moduleName) {
     return [];
@@ -0,0 +1,1226 @@
+// Auto-generated by scripts/generate-mono-signatures.ts; do not edit by hand.
+// Run: npm run generate:signatures -- --stubs-only
+//
+// Arity-specific binding stubs for hot exports of signatures.ts. Each stub
+// normalizes its arguments according to the declared native types and calls
+// the NativeFunction directly, so MonoApi.native call sites stay monomorphic
+// instead of going through a generic rest-argument wrapper.
+
+import type { MonoArg, MonoNativeFunction } from "./api";
+
+// ============================================================================
+// Type Definitions
+// ============================================================================
+
+/** How a stub reaches the runtime thread. */
+export interface NativeStubContext {
+  /** Whether the call can be made on the current thread as is */
+  direct(): boolean;
+  /** Run `fn` attached to the runtime */
+  run<T>(fn: () => T): T;
+}
+
+export type NativeStubFactory = (
+  f: NativeFunction<NativeFunctionReturnValue, NativeFunctionArgumentValue[]>,
+  c: NativeStubContext,
+) => MonoNativeFunction;
+
+// ============================================================================
+// Argument Normalizers
+// ============================================================================
+
+/** Pointer argument: null and undefined become NULL. */
+function p(arg: MonoArg): NativeFunctionArgumentValue {
+  return arg === null || arg === undefined ? NULL : (arg as NativeFunctionArgumentValue);
+}
+
+/** Integer argument: booleans become 0/1, null and undefined become 0. */
+function n(arg: MonoArg): NativeFunctionArgumentValue {
+  if (typeof arg === "boolean") {
+    return arg ? 1 : 0;
+  }
+  return arg === null || arg === undefined ? 0 : (arg as NativeFunctionArgumentValue);
+}
+
+// ============================================================================
+// Stubs
+// ============================================================================
+
+/** Exports shared by legacy mono and MonoBleedingEdge builds. */
+export const SHARED_NATIVE_STUBS: Readonly<Record<string, NativeStubFactory>> = {
+  mono_add_internal_call: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      f(p(a0), p(a1));
+    } else {
+      c.run(() => f(p(a0), p(a1)));
+    }
+  },
+  mono_array_addr_with_size: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1), n(a2));
+    }
+    return c.run(() => f(p(a0), n(a1), n(a2)));
+  },
+  mono_array_class_get: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_array_element_size: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_array_new: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1), n(a2));
+    }
+    return c.run(() => f(p(a0), p(a1), n(a2)));
+  },
+  mono_array_new_full: (f, c) => (a0, a1, a2, a3) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1), p(a2), p(a3));
+    }
+    return c.run(() => f(p(a0), p(a1), p(a2), p(a3)));
+  },
+  mono_assembly_close: (f, c) => a0 => {
+    if (c.direct()) {
+      f(p(a0));
+    } else {
+      c.run(() => f(p(a0)));
+    }
+  },
+  mono_assembly_foreach: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      f(p(a0), p(a1));
+    } else {
+      c.run(() => f(p(a0), p(a1)));
+    }
+  },
+  mono_assembly_get_assemblyref: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      f(p(a0), n(a1), p(a2));
+    } else {
+      c.run(() => f(p(a0), n(a1), p(a2)));
+    }
+  },
+  mono_assembly_get_image: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_array_element_size: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_enum_basetype: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_from_mono_type: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_from_name: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1), p(a2));
+    }
+    return c.run(() => f(p(a0), p(a1), p(a2)));
+  },
+  mono_class_get: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_class_get_byref_type: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_get_element_class: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_get_field_from_name: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_class_get_field_token: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_get_fields: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_class_get_flags: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_get_image: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_get_interfaces: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_class_get_method_from_name: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1), n(a2));
+    }
+    return c.run(() => f(p(a0), p(a1), n(a2)));
+  },
+  mono_class_get_methods: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_class_get_name: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_get_namespace: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_get_nested_types: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_class_get_parent: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_get_properties: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_class_get_property_from_name: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_class_get_rank: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_get_type: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_get_type_token: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_inflate_generic_method: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_class_init: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_instance_size: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_is_assignable_from: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_class_is_enum: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_is_generic: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_is_subclass_of: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1), n(a2));
+    }
+    return c.run(() => f(p(a0), p(a1), n(a2)));
+  },
+  mono_class_is_valuetype: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_class_value_size: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_class_vtable: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_compile_method: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_custom_attrs_free: (f, c) => a0 => {
+    if (c.direct()) {
+      f(p(a0));
+    } else {
+      c.run(() => f(p(a0)));
+    }
+  },
+  mono_custom_attrs_from_assembly: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_custom_attrs_from_class: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_custom_attrs_from_field: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_custom_attrs_from_method: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_custom_attrs_from_property: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_debug_free_source_location: (f, c) => a0 => {
+    if (c.direct()) {
+      f(p(a0));
+    } else {
+      c.run(() => f(p(a0)));
+    }
+  },
+  mono_debug_lookup_method: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_debug_lookup_source_location: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1), p(a2));
+    }
+    return c.run(() => f(p(a0), n(a1), p(a2)));
+  },
+  mono_domain_assembly_open: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_domain_create_appdomain: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_domain_get: (f, c) => () => {
+    if (c.direct()) {
+      return f();
+    }
+    return c.run(() => f());
+  },
+  mono_domain_set: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_field_from_token: (f, c) => (a0, a1, a2, a3) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1), p(a2), p(a3));
+    }
+    return c.run(() => f(p(a0), n(a1), p(a2), p(a3)));
+  },
+  mono_field_get_flags: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_field_get_name: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_field_get_offset: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_field_get_parent: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_field_get_type: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_field_get_value: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      f(p(a0), p(a1), p(a2));
+    } else {
+      c.run(() => f(p(a0), p(a1), p(a2)));
+    }
+  },
+  mono_field_get_value_object: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1), p(a2));
+    }
+    return c.run(() => f(p(a0), p(a1), p(a2)));
+  },
+  mono_field_set_value: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      f(p(a0), p(a1), p(a2));
+    } else {
+      c.run(() => f(p(a0), p(a1), p(a2)));
+    }
+  },
+  mono_field_static_get_value: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      f(p(a0), p(a1), p(a2));
+    } else {
+      c.run(() => f(p(a0), p(a1), p(a2)));
+    }
+  },
+  mono_field_static_set_value: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      f(p(a0), p(a1), p(a2));
+    } else {
+      c.run(() => f(p(a0), p(a1), p(a2)));
+    }
+  },
+  mono_gc_collect: (f, c) => a0 => {
+    if (c.direct()) {
+      f(n(a0));
+    } else {
+      c.run(() => f(n(a0)));
+    }
+  },
+  mono_gc_get_heap_size: (f, c) => () => {
+    if (c.direct()) {
+      return f();
+    }
+    return c.run(() => f());
+  },
+  mono_gc_get_used_size: (f, c) => () => {
+    if (c.direct()) {
+      return f();
+    }
+    return c.run(() => f());
+  },
+  mono_gc_max_generation: (f, c) => () => {
+    if (c.direct()) {
+      return f();
+    }
+    return c.run(() => f());
+  },
+  mono_gc_wbarrier_set_arrayref: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      f(p(a0), p(a1), p(a2));
+    } else {
+      c.run(() => f(p(a0), p(a1), p(a2)));
+    }
+  },
+  mono_gc_wbarrier_set_field: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      f(p(a0), p(a1), p(a2));
+    } else {
+      c.run(() => f(p(a0), p(a1), p(a2)));
+    }
+  },
+  mono_gchandle_free: (f, c) => a0 => {
+    if (c.direct()) {
+      f(n(a0));
+    } else {
+      c.run(() => f(n(a0)));
+    }
+  },
+  mono_gchandle_get_target: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(n(a0));
+    }
+    return c.run(() => f(n(a0)));
+  },
+  mono_gchandle_new: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_gchandle_new_weakref: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_get_array_class: (f, c) => () => {
+    if (c.direct()) {
+      return f();
+    }
+    return c.run(() => f());
+  },
+  mono_get_corlib: (f, c) => () => {
+    if (c.direct()) {
+      return f();
+    }
+    return c.run(() => f());
+  },
+  mono_get_delegate_invoke: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_get_method: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1), p(a2));
+    }
+    return c.run(() => f(p(a0), n(a1), p(a2)));
+  },
+  mono_get_root_domain: (f, c) => () => {
+    if (c.direct()) {
+      return f();
+    }
+    return c.run(() => f());
+  },
+  mono_image_get_guid: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_image_get_name: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_image_get_table_info: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_image_get_table_rows: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_image_loaded: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_install_assembly_load_hook: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      f(p(a0), p(a1));
+    } else {
+      c.run(() => f(p(a0), p(a1)));
+    }
+  },
+  mono_jit_info_get_code_size: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_jit_info_get_code_start: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_jit_info_get_method: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_jit_info_table_find: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_metadata_free_mh: (f, c) => a0 => {
+    if (c.direct()) {
+      f(p(a0));
+    } else {
+      c.run(() => f(p(a0)));
+    }
+  },
+  mono_metadata_type_equal: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_metadata_type_hash: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_method_desc_free: (f, c) => a0 => {
+    if (c.direct()) {
+      f(p(a0));
+    } else {
+      c.run(() => f(p(a0)));
+    }
+  },
+  mono_method_desc_new: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_method_desc_search_in_image: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_method_full_name: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_method_get_class: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_method_get_flags: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_method_get_header: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_method_get_name: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_method_get_object: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1), p(a2));
+    }
+    return c.run(() => f(p(a0), p(a1), p(a2)));
+  },
+  mono_method_get_token: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_method_header_get_code: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1), p(a2));
+    }
+    return c.run(() => f(p(a0), p(a1), p(a2)));
+  },
+  mono_method_signature: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_object_clone: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_object_get_class: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_object_get_size: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_object_isinst: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_object_new: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_object_new_specific: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_object_unbox: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_property_get_flags: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_property_get_get_method: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_property_get_name: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_property_get_parent: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_property_get_set_method: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_ptr_class_get: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_reflection_type_from_name: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_runtime_invoke: (f, c) => (a0, a1, a2, a3) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1), p(a2), p(a3));
+    }
+    return c.run(() => f(p(a0), p(a1), p(a2), p(a3)));
+  },
+  mono_runtime_object_init: (f, c) => a0 => {
+    if (c.direct()) {
+      f(p(a0));
+    } else {
+      c.run(() => f(p(a0)));
+    }
+  },
+  mono_signature_explicit_this: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_signature_get_call_conv: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_signature_get_desc: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_signature_get_param_count: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_signature_get_params: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_signature_get_return_type: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_signature_hash: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_signature_is_instance: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_stack_walk: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      f(p(a0), p(a1));
+    } else {
+      c.run(() => f(p(a0), p(a1)));
+    }
+  },
+  mono_stack_walk_no_il: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      f(p(a0), p(a1));
+    } else {
+      c.run(() => f(p(a0), p(a1)));
+    }
+  },
+  mono_string_intern: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_string_new: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_string_new_utf16: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1), n(a2));
+    }
+    return c.run(() => f(p(a0), p(a1), n(a2)));
+  },
+  mono_string_to_utf16: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_string_to_utf8: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_table_info_get_rows: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_thread_attach: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_thread_detach: (f, c) => a0 => {
+    if (c.direct()) {
+      f(p(a0));
+    } else {
+      c.run(() => f(p(a0)));
+    }
+  },
+  mono_type_get_class: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_type_get_name: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_type_get_name_full: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_type_get_object: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_type_get_type: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_type_get_underlying_type: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_type_is_byref: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_type_is_reference: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_type_size: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_type_stack_size: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_unity_array_new_2d: (f, c) => (a0, a1, a2, a3) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1), n(a2), n(a3));
+    }
+    return c.run(() => f(p(a0), p(a1), n(a2), n(a3)));
+  },
+  mono_unity_array_new_3d: (f, c) => (a0, a1, a2, a3, a4) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1), n(a2), n(a3), n(a4));
+    }
+    return c.run(() => f(p(a0), p(a1), n(a2), n(a3), n(a4)));
+  },
+  mono_unity_class_get_generic_type_definition: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_unity_g_free: (f, c) => a0 => {
+    if (c.direct()) {
+      f(p(a0));
+    } else {
+      c.run(() => f(p(a0)));
+    }
+  },
+  mono_value_box: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1), p(a2));
+    }
+    return c.run(() => f(p(a0), p(a1), p(a2)));
+  },
+  mono_vtable_get_static_field_data: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  unity_mono_method_is_generic: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  unity_mono_reflection_method_get_method: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+};
+
+/** Exports only some runtime flavors provide. */
+export const FLAVOR_NATIVE_STUBS: Readonly<Record<string, NativeStubFactory>> = {
+  mono_array_length: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_assembly_get_name: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_assembly_name_get_culture: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_assembly_name_get_name: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_assembly_name_get_pubkeytoken: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_assembly_name_get_version: (f, c) => (a0, a1, a2, a3) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1), p(a2), p(a3));
+    }
+    return c.run(() => f(p(a0), p(a1), p(a2), p(a3)));
+  },
+  mono_class_implements_interface: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_class_is_delegate: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_debug_enabled: (f, c) => () => {
+    if (c.direct()) {
+      return f();
+    }
+    return c.run(() => f());
+  },
+  mono_debug_il_offset_from_address: (f, c) => (a0, a1, a2) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1), n(a2));
+    }
+    return c.run(() => f(p(a0), p(a1), n(a2)));
+  },
+  mono_debug_method_lookup_location: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_field_full_name: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_free: (f, c) => a0 => {
+    if (c.direct()) {
+      f(p(a0));
+    } else {
+      c.run(() => f(p(a0)));
+    }
+  },
+  mono_gc_finalize_notify: (f, c) => () => {
+    if (c.direct()) {
+      f();
+    } else {
+      c.run(() => f());
+    }
+  },
+  mono_gchandle_free_v2: (f, c) => a0 => {
+    if (c.direct()) {
+      f(p(a0));
+    } else {
+      c.run(() => f(p(a0)));
+    }
+  },
+  mono_gchandle_get_target_v2: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_gchandle_new_v2: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_gchandle_new_weakref_v2: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_method_get_generic_container: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_method_get_unmanaged_thunk: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_object_to_string: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), p(a1));
+    }
+    return c.run(() => f(p(a0), p(a1)));
+  },
+  mono_signature_param_is_out: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_string_chars: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_string_length: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_thread_detach_if_exiting: (f, c) => () => {
+    if (c.direct()) {
+      return f();
+    }
+    return c.run(() => f());
+  },
+  mono_thread_get_coop_aware: (f, c) => () => {
+    if (c.direct()) {
+      return f();
+    }
+    return c.run(() => f());
+  },
+  mono_type_is_generic_parameter: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_type_is_pointer: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+  mono_unity_class_get_generic_argument_at: (f, c) => (a0, a1) => {
+    if (c.direct()) {
+      return f(p(a0), n(a1));
+    }
+    return c.run(() => f(p(a0), n(a1)));
+  },
+  mono_unity_class_get_generic_argument_count: (f, c) => a0 => {
+    if (c.direct()) {
+      return f(p(a0));
+    }
+    return c.run(() => f(p(a0)));
+  },
+};
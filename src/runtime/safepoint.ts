@@ -0,0 +1,291 @@
+/**
+ * Safepoint Batching - Let the GC suspend the bridge thread during long loops.
+ *
+ * Under cooperative (or hybrid) suspend the GC cannot stop a thread that sits
+ * in GC-unsafe mode; it waits until the thread polls a safepoint or enters a
+ * GC-safe region. Bridge loops such as metadata scans and bulk reads run as
+ * one long native call chain from the runtime's point of view, so a
+ * collection requested meanwhile stalls every managed thread of the target.
+ *
+ * {@link SafepointBatcher} splits such loops into chunks and briefly enters a
+ * GC-safe region between chunks, giving a pending collection the chance to run.
+ * The transition is done by a tiny CModule so the stack data handed to Mono
+ * lives on the real native stack. On preemptive-suspend runtimes nothing is
+ * transitioned and the batcher only records timings.
+ *
+ * Only poll between items that do not hold unrooted managed objects: a
+ * collection may run (and move or free objects) at every safepoint.
+ *
+ * @module runtime/safepoint
+ */
+
+import { Logger } from "../utils/log";
+import type { MonoApi } from "./api";
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+/**
+ * When to insert safepoints:
+ * - auto: only when the current thread reports coop-aware suspend
+ * - always: whenever the GC-safe region exports are available
+ * - never: record timings only
+ */
+export type SafepointMode = "auto" | "always" | "never";
+
+/**
+ * Tuning for {@link SafepointBatcher}.
+ */
+export interface SafepointConfig {
+  mode: SafepointMode;
+  /** Items processed between safepoints */
+  chunkSize: number;
+  /** Upper bound on time between safepoints, in milliseconds (0 disables the time check) */
+  maxChunkMs: number;
+}
+
+/**
+ * Default safepoint tuning.
+ */
+export const DEFAULT_SAFEPOINT_CONFIG: SafepointConfig = {
+  mode: "auto",
+  chunkSize: 512,
+  maxChunkMs: 4,
+};
+
+/**
+ * Timings collected across all batched operations.
+ */
+export interface SafepointStats {
+  /** Whether coop-aware suspend was detected */
+  coop: boolean;
+  /** Whether safepoints are actually inserted */
+  active: boolean;
+  /** Batched operations run so far */
+  operations: number;
+  /** Items polled across all operations */
+  items: number;
+  /** Safepoints taken */
+  safepoints: number;
+  /** Total time spent between safepoints, i.e. time the GC could have been blocked */
+  unsafeMs: number;
+  /** Longest stretch between safepoints */
+  maxUnsafeMs: number;
+  /** Time spent inside safepoints, i.e. waiting for a collection to finish */
+  waitMs: number;
+}
+
+/**
+ * One batched operation; see {@link SafepointBatcher.scope}.
+ */
+export interface SafepointScope {
+  /** Count one item and take a safepoint at chunk boundaries */
+  poll(): void;
+  /** Close the operation and record its last chunk */
+  end(): void;
+}
+
+const safepointLogger = Logger.withTag("Safepoint");
+
+// ============================================================================
+// SAFEPOINT BATCHER
+// ============================================================================
+
+/**
+ * Chunked execution with GC safepoints between chunks.
+ *
+ * @example
+ * ```typescript
+ * const safepoints = api.getThreadManager()!.safepoints;
+ * safepoints.forEach(tokens, token => scan(token));
+ * console.log(safepoints.getStats().maxUnsafeMs);
+ * ```
+ */
+export class SafepointBatcher {
+  private config: SafepointConfig;
+  private coop: boolean | null = null;
+  private kernel: CModule | null | undefined = undefined;
+  private take: NativeFunction<void, []> | null = null;
+  private readonly stats = { operations: 0, items: 0, safepoints: 0, unsafeMs: 0, maxUnsafeMs: 0, waitMs: 0 };
+
+  constructor(
+    private readonly api: MonoApi,
+    config?: Partial<SafepointConfig>,
+  ) {
+    this.config = { ...DEFAULT_SAFEPOINT_CONFIG, ...config };
+  }
+
+  /**
+   * Whether the current thread runs under cooperative suspend.
+   * Detected once via `mono_thread_get_coop_aware`.
+   */
+  get isCoop(): boolean {
+    if (this.coop === null) {
+      this.coop = false;
+      if (this.api.hasExport("mono_thread_get_coop_aware")) {
+        try {
+          this.coop = (this.api.native.mono_thread_get_coop_aware() as number) !== 0;
+        } catch (error) {
+          safepointLogger.debug(`Coop detection failed: ${error}`);
+        }
+      }
+    }
+    return this.coop;
+  }
+
+  /** Whether safepoints are inserted with the current mode. */
+  get isActive(): boolean {
+    const { mode } = this.config;
+    if (mode === "never" || (mode === "auto" && !this.isCoop)) {
+      return false;
+    }
+    return this.resolveKernel() !== null;
+  }
+
+  /** Current tuning. */
+  getConfig(): Readonly<SafepointConfig> {
+    return this.config;
+  }
+
+  /** Update tuning; applies to operations started afterwards. */
+  configure(config: Partial<SafepointConfig>): void {
+    this.config = { ...this.config, ...config };
+  }
+
+  /**
+   * Start a batched operation. Call `poll()` once per item and `end()` when done.
+   */
+  scope(): SafepointScope {
+    const active = this.isActive;
+    const { chunkSize, maxChunkMs } = this.config;
+    const stats = this.stats;
+    let pending = 0;
+    let chunkStart = Date.now();
+    let open = true;
+    stats.operations++;
+
+    const closeChunk = (now: number): void => {
+      const elapsed = now - chunkStart;
+      stats.unsafeMs += elapsed;
+      if (elapsed > stats.maxUnsafeMs) {
+        stats.maxUnsafeMs = elapsed;
+      }
+    };
+
+    return {
+      poll: () => {
+        stats.items++;
+        pending++;
+        if (!active) {
+          return;
+        }
+        if (pending < chunkSize) {
+          // Check the clock only every 16 items to keep polling cheap
+          if (maxChunkMs <= 0 || (pending & 15) !== 0 || Date.now() - chunkStart < maxChunkMs) {
+            return;
+          }
+        }
+        const now = Date.now();
+        closeChunk(now);
+        this.take!();
+        chunkStart = Date.now();
+        stats.waitMs += chunkStart - now;
+        stats.safepoints++;
+        pending = 0;
+      },
+      end: () => {
+        if (open) {
+          open = false;
+          closeChunk(Date.now());
+        }
+      },
+    };
+  }
+
+  /**
+   * Run `fn` for every item with safepoints between chunks.
+   */
+  forEach<T>(items: ArrayLike<T>, fn: (item: T, index: number) => void): void {
+    const scope = this.scope();
+    try {
+      for (let i = 0; i < items.length; i++) {
+        fn(items[i], i);
+        scope.poll();
+      }
+    } finally {
+      scope.end();
+    }
+  }
+
+  /**
+   * Take one safepoint now. No-op when safepoints are inactive.
+   */
+  safepoint(): void {
+    if (this.isActive) {
+      const start = Date.now();
+      this.take!();
+      this.stats.waitMs += Date.now() - start;
+      this.stats.safepoints++;
+    }
+  }
+
+  /** Get accumulated timings. */
+  getStats(): SafepointStats {
+    return { coop: this.isCoop, active: this.isActive, ...this.stats };
+  }
+
+  /** Reset accumulated timings. */
+  resetStats(): void {
+    Object.assign(this.stats, { operations: 0, items: 0, safepoints: 0, unsafeMs: 0, maxUnsafeMs: 0, waitMs: 0 });
+  }
+
+  /** Drop the compiled kernel and the coop detection result. */
+  dispose(): void {
+    this.take = null;
+    this.kernel = undefined;
+    this.coop = null;
+  }
+
+  // ===== INTERNAL =====
+
+  private resolveKernel(): CModule | null {
+    if (this.kernel !== undefined) {
+      return this.kernel;
+    }
+    this.kernel = null;
+
+    const enter = this.api.tryResolveAddress("mono_threads_enter_gc_safe_region");
+    const exit = this.api.tryResolveAddress("mono_threads_exit_gc_safe_region");
+    if (!enter || !exit) {
+      safepointLogger.debug("GC-safe region exports not found; safepoints disabled");
+      return null;
+    }
+
+    try {
+      const module = new CModule(SAFEPOINT_SOURCE, { enter_gc_safe: enter, exit_gc_safe: exit });
+      this.take = new NativeFunction(module.take_safepoint, "void", []);
+      this.kernel = module;
+    } catch (error) {
+      safepointLogger.debug(`CModule unavailable; safepoints disabled: ${error}`);
+    }
+    return this.kernel;
+  }
+}
+
+/**
+ * Enter and immediately leave a GC-safe region. Entering acknowledges a
+ * pending suspend request; leaving blocks until the collection has finished.
+ */
+const SAFEPOINT_SOURCE = `
+extern void * enter_gc_safe (void ** stackdata);
+extern void exit_gc_safe (void * cookie, void ** stackdata);
+
+void
+take_safepoint (void)
+{
+  void * stackdata;
+  void * cookie = enter_gc_safe (&stackdata);
+  exit_gc_safe (cookie, &stackdata);
+}
+`;
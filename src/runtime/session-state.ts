@@ -0,0 +1,443 @@
+/**
+ * Session State - Persist warm bridge state across agent script reloads.
+ *
+ * Reloading the agent normally redoes module discovery, export resolution and
+ * name-based class/method lookups. A {@link SessionSnapshot} captures the
+ * results in a JSON-serializable form:
+ * - module discovery verdicts and export offsets relative to the module base
+ * - class and method tokens keyed by image GUID
+ *
+ * Snapshots are stored in a process-scoped file in the temp directory (named
+ * after the process id, so it outlives the script) or in a file of the caller's
+ * choice. The next load takes ownership of the process-scoped snapshot and
+ * empties it. On the next load the snapshot is only applied when the module
+ * path, size and code fingerprint match, and every restored token is checked
+ * against the current image GUID and the requested name before use.
+ *
+ * @module runtime/session-state
+ */
+
+import { Logger } from "../utils/log";
+import { pointerIsNull } from "../utils/memory";
+import { readUtf8String } from "../utils/string";
+import type { MonoApi } from "./api";
+import {
+  exportModuleDiscoveryCache,
+  importModuleDiscoveryCache,
+  type ModuleDiscoveryCacheEntry,
+  type MonoModuleInfo,
+} from "./module";
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+/** Snapshot format version; snapshots with another version are ignored. */
+export const SESSION_SNAPSHOT_VERSION = 1;
+
+/**
+ * Where snapshots are kept:
+ * - "process": process-scoped file in the temp directory that survives script reloads
+ *   within the same process
+ * - `{ path }`: JSON file, survives process restarts as long as the binaries match
+ */
+export type SessionStorage = "process" | { path: string };
+
+/** Tokens resolved in one image. */
+export interface SessionImageState {
+  /** Image name, used to find the image again */
+  name: string;
+  /** Class full name -> TypeDef token */
+  classes: Record<string, number>;
+  /** `Class::method/argc` -> MethodDef token */
+  methods: Record<string, number>;
+}
+
+/**
+ * Serializable warm state of one runtime.
+ */
+export interface SessionSnapshot {
+  version: number;
+  module: { path: string; size: number; fingerprint: string };
+  /** Export offsets from the module base; -1 marks missing exports */
+  exports: Record<string, number>;
+  discovery: ModuleDiscoveryCacheEntry[];
+  /** Image GUID -> resolved tokens */
+  images: Record<string, SessionImageState>;
+}
+
+/**
+ * Outcome of {@link SessionState.restore}.
+ */
+export interface SessionRestoreResult {
+  restored: boolean;
+  /** Why the snapshot was rejected */
+  reason?: string;
+  exports: number;
+  classes: number;
+  methods: number;
+}
+
+/**
+ * Lookup counters for a {@link SessionState}.
+ */
+export interface SessionStateStats {
+  images: number;
+  classes: number;
+  methods: number;
+  hits: number;
+  misses: number;
+  /** Restored entries dropped because they no longer matched */
+  stale: number;
+}
+
+const sessionLogger = Logger.withTag("Session");
+
+// ============================================================================
+// SESSION STATE
+// ============================================================================
+
+/**
+ * Records resolved classes and methods and serves them back by token.
+ *
+ * @example
+ * ```typescript
+ * saveSessionSnapshot(api.enableSession().capture(moduleInfo), "process");
+ * // after reload, before class lookups
+ * const snapshot = loadSessionSnapshot("process");
+ * if (snapshot) {
+ *   api.enableSession().restore(snapshot, moduleInfo);
+ * }
+ * ```
+ */
+export class SessionState {
+  private readonly images = new Map<string, SessionImageState>();
+  private readonly classOwners = new Map<string, string>();
+  private readonly guidsByImage = new Map<string, string>();
+  private readonly imagesByGuid = new Map<string, NativePointer>();
+  private readonly unsubscribe: () => void;
+  private hits = 0;
+  private misses = 0;
+  private stale = 0;
+
+  constructor(private readonly api: MonoApi) {
+    this.unsubscribe = api.cacheScopes.onInvalidate(event => {
+      if (event.kind === "all") {
+        this.guidsByImage.clear();
+        this.imagesByGuid.clear();
+      } else if (event.kind === "image") {
+        const key = event.scope.toString();
+        const guid = this.guidsByImage.get(key);
+        this.guidsByImage.delete(key);
+        if (guid) {
+          this.imagesByGuid.delete(guid);
+        }
+      }
+    });
+  }
+
+  /**
+   * Fingerprint of the module code: 16 bytes at `mono_get_root_domain`.
+   * Catches a different binary at the same path and size.
+   */
+  static fingerprint(api: MonoApi): string {
+    const address = api.tryResolveAddress("mono_get_root_domain");
+    if (!address) {
+      return "";
+    }
+    return Array.from(new Uint8Array(address.readByteArray(16)!), byte => byte.toString(16).padStart(2, "0")).join("");
+  }
+
+  /**
+   * Capture the current warm state.
+   */
+  capture(module: MonoModuleInfo): SessionSnapshot {
+    const images: Record<string, SessionImageState> = {};
+    for (const [guid, state] of this.images) {
+      images[guid] = state;
+    }
+    return {
+      version: SESSION_SNAPSHOT_VERSION,
+      module: { path: module.path, size: module.size, fingerprint: SessionState.fingerprint(this.api) },
+      exports: this.api.getExportOffsets(),
+      discovery: exportModuleDiscoveryCache(),
+      images,
+    };
+  }
+
+  /**
+   * Apply a snapshot taken by an earlier session.
+   * Export offsets are seeded only when the module matches; tokens are kept
+   * and validated lazily on first use.
+   */
+  restore(snapshot: SessionSnapshot, module: MonoModuleInfo): SessionRestoreResult {
+    const result: SessionRestoreResult = { restored: false, exports: 0, classes: 0, methods: 0 };
+    if (snapshot.version !== SESSION_SNAPSHOT_VERSION) {
+      result.reason = `unsupported snapshot version ${snapshot.version}`;
+      return result;
+    }
+
+    importModuleDiscoveryCache(snapshot.discovery ?? []);
+
+    if (snapshot.module.path !== module.path || snapshot.module.size !== module.size) {
+      result.reason = `snapshot is for ${snapshot.module.path}`;
+      return result;
+    }
+    if (snapshot.module.fingerprint !== SessionState.fingerprint(this.api)) {
+      result.reason = "module code fingerprint changed";
+      return result;
+    }
+
+    result.exports = this.api.seedExportOffsets(snapshot.exports);
+    for (const guid of Object.keys(snapshot.images)) {
+      const image = snapshot.images[guid];
+      const state = this.ensureImage(guid, image.name);
+      for (const name of Object.keys(image.classes)) {
+        state.classes[name] = image.classes[name];
+        this.classOwners.set(name, guid);
+        result.classes++;
+      }
+      for (const key of Object.keys(image.methods)) {
+        state.methods[key] = image.methods[key];
+        result.methods++;
+      }
+    }
+    result.restored = true;
+    return result;
+  }
+
+  /**
+   * Resolve a class recorded under `fullName`.
+   * @returns Class pointer, or null when unknown or no longer valid
+   */
+  lookupClass(fullName: string): NativePointer | null {
+    const guid = this.classOwners.get(fullName);
+    if (!guid) {
+      return null;
+    }
+    const state = this.images.get(guid)!;
+    const image = this.resolveImage(guid, state.name);
+    const klass = image ? (this.api.native.mono_class_get(image, state.classes[fullName]) as NativePointer) : NULL;
+    if (pointerIsNull(klass) || !this.matchesFullName(klass, fullName)) {
+      delete state.classes[fullName];
+      this.classOwners.delete(fullName);
+      this.stale++;
+      this.misses++;
+      return null;
+    }
+    this.hits++;
+    return klass;
+  }
+
+  /**
+   * Record a class resolved by name.
+   */
+  recordClass(fullName: string, klass: NativePointer): void {
+    const located = this.locate(klass);
+    if (located) {
+      located.state.classes[fullName] = this.api.native.mono_class_get_type_token(klass) as number;
+      this.classOwners.set(fullName, located.guid);
+    }
+  }
+
+  /**
+   * Resolve a method recorded for `klass`.
+   * @returns Method pointer, or null when unknown or no longer valid
+   */
+  lookupMethod(klass: NativePointer, classFullName: string, name: string, paramCount: number): NativePointer | null {
+    const located = this.locate(klass);
+    const key = `${classFullName}::${name}/${paramCount}`;
+    const token = located?.state.methods[key];
+    if (token === undefined) {
+      return null;
+    }
+    const method = this.api.native.mono_get_method(located!.image, token, klass) as NativePointer;
+    if (pointerIsNull(method) || readUtf8String(this.api.native.mono_method_get_name(method)) !== name) {
+      delete located!.state.methods[key];
+      this.stale++;
+      this.misses++;
+      return null;
+    }
+    this.hits++;
+    return method;
+  }
+
+  /**
+   * Record a method resolved by name.
+   */
+  recordMethod(
+    klass: NativePointer,
+    classFullName: string,
+    name: string,
+    paramCount: number,
+    method: NativePointer,
+  ): void {
+    const located = this.locate(klass);
+    if (located) {
+      const token = this.api.native.mono_method_get_token(method) as number;
+      located.state.methods[`${classFullName}::${name}/${paramCount}`] = token;
+    }
+  }
+
+  /** Get counters. */
+  getStats(): SessionStateStats {
+    let methods = 0;
+    for (const state of this.images.values()) {
+      methods += Object.keys(state.methods).length;
+    }
+    return {
+      images: this.images.size,
+      classes: this.classOwners.size,
+      methods,
+      hits: this.hits,
+      misses: this.misses,
+      stale: this.stale,
+    };
+  }
+
+  /** Forget all recorded tokens. */
+  clear(): void {
+    this.images.clear();
+    this.classOwners.clear();
+    this.guidsByImage.clear();
+    this.imagesByGuid.clear();
+  }
+
+  /** Forget all recorded tokens and stop listening for cache invalidations. */
+  dispose(): void {
+    this.unsubscribe();
+    this.clear();
+  }
+
+  // ===== INTERNAL =====
+
+  private ensureImage(guid: string, name: string): SessionImageState {
+    let state = this.images.get(guid);
+    if (!state) {
+      state = { name, classes: {}, methods: {} };
+      this.images.set(guid, state);
+    }
+    return state;
+  }
+
+  private locate(klass: NativePointer): { guid: string; image: NativePointer; state: SessionImageState } | null {
+    const image = this.api.native.mono_class_get_image(klass) as NativePointer;
+    if (pointerIsNull(image)) {
+      return null;
+    }
+    const key = image.toString();
+    let guid = this.guidsByImage.get(key);
+    if (guid === undefined) {
+      guid = readUtf8String(this.api.native.mono_image_get_guid(image));
+      if (!guid) {
+        return null;
+      }
+      this.guidsByImage.set(key, guid);
+      this.imagesByGuid.set(guid, image);
+    }
+    const state = this.ensureImage(guid, readUtf8String(this.api.native.mono_image_get_name(image)));
+    return { guid, image, state };
+  }
+
+  /** Whether `klass` is exactly `Namespace.Name` (nested types: `Outer/Inner` or `Outer+Inner`). */
+  private matchesFullName(klass: NativePointer, fullName: string): boolean {
+    const native = this.api.native;
+    const name = readUtf8String(native.mono_class_get_name(klass));
+    const outer = native.mono_class_get_nesting_type(klass) as NativePointer;
+    if (!pointerIsNull(outer)) {
+      const separatorAt = fullName.length - name.length - 1;
+      const separator = fullName[separatorAt];
+      return (
+        separatorAt > 0 &&
+        (separator === "/" || separator === "+") &&
+        fullName.endsWith(name) &&
+        this.matchesFullName(outer, fullName.slice(0, separatorAt))
+      );
+    }
+    const namespace = readUtf8String(native.mono_class_get_namespace(klass));
+    return fullName === (namespace ? `${namespace}.${name}` : name);
+  }
+
+  private resolveImage(guid: string, name: string): NativePointer | null {
+    const known = this.imagesByGuid.get(guid);
+    if (known) {
+      return known;
+    }
+    const image = this.api.native.mono_image_loaded(this.api.allocUtf8StringCached(name)) as NativePointer;
+    if (pointerIsNull(image) || readUtf8String(this.api.native.mono_image_get_guid(image)) !== guid) {
+      return null;
+    }
+    this.guidsByImage.set(image.toString(), guid);
+    this.imagesByGuid.set(guid, image);
+    return image;
+  }
+}
+
+// ============================================================================
+// STORAGE
+// ============================================================================
+
+/**
+ * Store a snapshot.
+ * @returns Whether the snapshot was written
+ */
+export function saveSessionSnapshot(snapshot: SessionSnapshot, storage: SessionStorage): boolean {
+  const text = JSON.stringify(snapshot);
+  try {
+    File.writeAllText(storage === "process" ? processBlobPath() : storage.path, text);
+    return true;
+  } catch (error) {
+    sessionLogger.debug(`Failed to save session snapshot: ${error}`);
+    return false;
+  }
+}
+
+/**
+ * Load a snapshot stored by {@link saveSessionSnapshot}.
+ * @returns The snapshot, or null when none is stored or it cannot be parsed
+ */
+export function loadSessionSnapshot(storage: SessionStorage): SessionSnapshot | null {
+  try {
+    const text = storage === "process" ? readProcessBlob() : File.readAllText(storage.path);
+    if (!text) {
+      return null;
+    }
+    const snapshot = JSON.parse(text) as SessionSnapshot;
+    return snapshot && snapshot.version === SESSION_SNAPSHOT_VERSION ? snapshot : null;
+  } catch (error) {
+    sessionLogger.debug(`Failed to load session snapshot: ${error}`);
+    return null;
+  }
+}
+
+/**
+ * Read the process snapshot and take ownership of it: the file is emptied so a
+ * later load in the same process does not restore a stale snapshot.
+ */
+function readProcessBlob(): string | null {
+  const path = processBlobPath();
+  let text: string;
+  try {
+    text = File.readAllText(path);
+  } catch {
+    // Nothing was saved in this process
+    return null;
+  }
+  if (text.length > 0) {
+    File.writeAllText(path, "");
+  }
+  return text || null;
+}
+
+/**
+ * Process-scoped snapshot file in the temp directory. It is keyed by process id
+ * rather than published through the environment, which is neither thread-safe
+ * nor shared with a runtime bound to a different CRT.
+ */
+function processBlobPath(): string {
+  const separator = Process.platform === "windows" ? "\\" : "/";
+  return `${Process.getTmpDir()}${separator}${SESSION_FILE_PREFIX}${Process.id}.json`;
+}
+
+/** File name prefix of process-scoped snapshots; the process id follows. */
+const SESSION_FILE_PREFIX = "frida-mono-bridge-session-";
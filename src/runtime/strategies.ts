@@ -0,0 +1,346 @@
+/**
+ * Runtime Strategies - Capability-resolved implementations selected once per runtime.
+ *
+ * Mono builds differ in which exports they ship: the Unity `mono-2.0-bdwgc`
+ * ("bleeding edge") runtime exposes thunks, v2 GC handles and direct class
+ * predicates that the legacy `mono.dll` lacks. Instead of probing
+ * `api.hasExport()` on every call, {@link RuntimeStrategies} resolves each
+ * operation to its best available implementation once, when the API is
+ * initialised:
+ * - String reads: `mono_string_to_utf8` → `mono_string_to_utf16` → `mono_string_chars`
+ * - Freeing runtime buffers: `mono_free` → `mono_unity_g_free` → `g_free`
+ * - GC handles: v2 (pointer) or v1 (guint32) ABI
+ * - Delegate thunks: `mono_method_get_unmanaged_thunk` or a NOT_SUPPORTED stub
+ * - Thread attach detection and `mono_thread_detach_if_exiting`
+ * - Class enumeration: `mono_image_get_table_rows` or table info + row count
+ *
+ * Model-layer fallbacks (reflection-based generic instantiation, managed
+ * interface walks) stay on the model classes and are selected by the
+ * precomputed flags in {@link RuntimeStrategies.generics} and
+ * {@link RuntimeStrategies.classes}.
+ *
+ * @module runtime/strategies
+ */
+
+import { MonoErrorCodes, raise } from "../utils/errors";
+import { Logger } from "../utils/log";
+import { pointerIsNull } from "../utils/memory";
+import { readUtf16String, readUtf8String } from "../utils/string";
+import type { MonoApi } from "./api";
+import { GCHandleAbi, GCHandleAbiKind, selectGCHandleAbi } from "./gchandle";
+import { supportsDelegateThunks } from "./version";
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+/**
+ * Runtime tier: `bleeding-edge` for `mono-2.0-bdwgc` style builds exporting
+ * unmanaged thunks, `legacy` otherwise.
+ */
+export type RuntimeTier = "legacy" | "bleeding-edge";
+
+/** Conversion used to read MonoString contents. */
+export type StringReadKind = "utf8" | "utf16" | "chars";
+
+/** Raw native function as returned by `api.tryGetNativeFunction`. */
+type RawNativeFunction = NativeFunction<NativeFunctionReturnValue, NativeFunctionArgumentValue[]>;
+
+/**
+ * Thread attach primitives, resolved without the auto-attaching `api.native` wrappers.
+ */
+export interface ThreadAttachStrategy {
+  /** `mono_domain_get`, a TLS read returning NULL on unattached threads */
+  domainGet: RawNativeFunction | null;
+  /** `mono_thread_current` */
+  threadCurrent: RawNativeFunction | null;
+  /** `mono_thread_attach` */
+  threadAttach: RawNativeFunction | null;
+  /** `mono_thread_detach_if_exiting`, or a stub returning false */
+  detachIfExiting: () => boolean;
+}
+
+/**
+ * Generic instantiation capabilities.
+ */
+export interface GenericStrategy {
+  /** `mono_class_inflate_generic_method` is exported */
+  inflateMethod: boolean;
+  /** `mono_method_get_generic_container` is exported */
+  methodContainer: boolean;
+  /** `mono_reflection_type_from_name` and `mono_class_from_mono_type` are exported */
+  reflectionTypes: boolean;
+  /** `mono_unity_class_get_generic_argument_count` is exported */
+  unityArgumentCount: boolean;
+  /** `mono_unity_class_get_generic_argument_at` is exported */
+  unityArgumentAt: boolean;
+}
+
+/**
+ * Class-level capabilities.
+ */
+export interface ClassStrategy {
+  /** `mono_class_is_delegate` is exported */
+  isDelegate: boolean;
+  /** `mono_class_implements_interface` is exported */
+  implementsInterface: boolean;
+  /** Number of TypeDef rows in an image */
+  typeDefCount: (image: NativePointer) => number;
+  /** TypeDef rows can be decoded straight from metadata (`mono_metadata_decode_row` + string heap) */
+  metadataRows: boolean;
+}
+
+/**
+ * Names of the selected implementations, for diagnostics.
+ */
+export interface RuntimeStrategySummary {
+  tier: RuntimeTier;
+  stringRead: StringReadKind[];
+  free: string;
+  gcHandles: GCHandleAbiKind;
+  delegateThunks: boolean;
+  detachIfExiting: boolean;
+  typeDefCount: "table-rows" | "table-info";
+  typeDefRows: "metadata" | "classes";
+  inflateGenericMethod: boolean;
+  reflectionGenericTypes: boolean;
+}
+
+const strategyLogger = Logger.withTag("Strategies");
+
+// ============================================================================
+// RUNTIME STRATEGIES
+// ============================================================================
+
+/**
+ * Operations bound to the fastest implementation the loaded runtime supports.
+ *
+ * Built once per {@link MonoApi}; access it through `api.strategies`.
+ *
+ * @example
+ * ```typescript
+ * const text = api.strategies.readString(strPtr);
+ * console.log(api.strategies.summary.tier); // "bleeding-edge"
+ * ```
+ */
+export class RuntimeStrategies {
+  /** Runtime tier the table was resolved for */
+  readonly tier: RuntimeTier;
+  /** Read a MonoString through the first conversion that yields a buffer */
+  readonly readString: (str: NativePointer) => string;
+  /** Read a MonoString through `mono_string_to_utf8` only; empty when unavailable */
+  readonly readStringUtf8: (str: NativePointer) => string;
+  /** Length of a MonoString in UTF-16 code units */
+  readonly stringLength: (str: NativePointer) => number;
+  /** Free a buffer allocated by the runtime; warns once when no free function exists */
+  readonly free: (buffer: NativePointer) => void;
+  /** GC handle ABI */
+  readonly gcHandles: GCHandleAbi;
+  /** Create the unmanaged thunk for a delegate `Invoke` method */
+  readonly unmanagedThunk: (invoke: NativePointer) => NativePointer;
+  readonly threads: ThreadAttachStrategy;
+  readonly generics: GenericStrategy;
+  readonly classes: ClassStrategy;
+  /** Names of the selected implementations */
+  readonly summary: RuntimeStrategySummary;
+
+  private constructor(api: MonoApi) {
+    const has = (name: string) => api.hasExport(name);
+
+    const delegateThunks = supportsDelegateThunks(api);
+    this.tier = delegateThunks ? "bleeding-edge" : "legacy";
+
+    const freeName = ["mono_free", "mono_unity_g_free", "g_free"].find(has);
+    this.free = createFree(api, freeName);
+
+    const stringRead: StringReadKind[] = [];
+    if (has("mono_string_to_utf8")) {
+      stringRead.push("utf8");
+    }
+    if (has("mono_string_to_utf16")) {
+      stringRead.push("utf16");
+    }
+    const hasLength = has("mono_string_length");
+    if (has("mono_string_chars") && hasLength) {
+      stringRead.push("chars");
+    }
+    this.readString = createStringReader(api, stringRead, this.free);
+    this.readStringUtf8 = createStringReader(api, stringRead.slice(0, stringRead[0] === "utf8" ? 1 : 0), this.free);
+    const readString = this.readString;
+    this.stringLength = hasLength
+      ? str => api.native.mono_string_length(str) as number
+      : str => readString(str).length;
+
+    this.gcHandles = selectGCHandleAbi(api);
+
+    this.unmanagedThunk = delegateThunks
+      ? invoke => api.native.mono_method_get_unmanaged_thunk(invoke)
+      : () =>
+          raise(
+            MonoErrorCodes.NOT_SUPPORTED,
+            "mono_method_get_unmanaged_thunk is not available on this Mono runtime (only in mono-2.0-bdwgc.dll)",
+            "Consider using runtime_invoke for delegate invocation instead",
+          );
+
+    const hasDetach = has("mono_thread_detach_if_exiting");
+    this.threads = {
+      domainGet: api.tryGetNativeFunction("mono_domain_get"),
+      threadCurrent: api.tryGetNativeFunction("mono_thread_current"),
+      threadAttach: api.tryGetNativeFunction("mono_thread_attach"),
+      detachIfExiting: hasDetach ? () => !!api.native.mono_thread_detach_if_exiting() : () => false,
+    };
+
+    this.generics = {
+      inflateMethod: has("mono_class_inflate_generic_method"),
+      methodContainer: has("mono_method_get_generic_container"),
+      reflectionTypes: has("mono_reflection_type_from_name") && has("mono_class_from_mono_type"),
+      unityArgumentCount: has("mono_unity_class_get_generic_argument_count"),
+      unityArgumentAt: has("mono_unity_class_get_generic_argument_at"),
+    };
+
+    const tableRows = has("mono_image_get_table_rows");
+    const metadataRows =
+      has("mono_image_get_table_info") && has("mono_metadata_decode_row") && has("mono_metadata_string_heap");
+    this.classes = {
+      isDelegate: has("mono_class_is_delegate"),
+      implementsInterface: has("mono_class_implements_interface"),
+      typeDefCount: tableRows
+        ? image => api.native.mono_image_get_table_rows(image, MONO_METADATA_TABLE_TYPEDEF) as number
+        : image => {
+            const table = api.native.mono_image_get_table_info(image, MONO_METADATA_TABLE_TYPEDEF);
+            return pointerIsNull(table) ? 0 : (api.native.mono_table_info_get_rows(table) as number);
+          },
+      metadataRows,
+    };
+
+    this.summary = {
+      tier: this.tier,
+      stringRead,
+      free: freeName ?? "none",
+      gcHandles: this.gcHandles.kind,
+      delegateThunks,
+      detachIfExiting: hasDetach,
+      typeDefCount: tableRows ? "table-rows" : "table-info",
+      typeDefRows: metadataRows ? "metadata" : "classes",
+      inflateGenericMethod: this.generics.inflateMethod,
+      reflectionGenericTypes: this.generics.reflectionTypes,
+    };
+    strategyLogger.debug(`Resolved ${this.tier} strategies: ${JSON.stringify(this.summary)}`);
+  }
+
+  /**
+   * Probe the runtime exports and bind every operation.
+   * @param api MonoApi instance to probe
+   */
+  static select(api: MonoApi): RuntimeStrategies {
+    return new RuntimeStrategies(api);
+  }
+}
+
+// ============================================================================
+// IMPLEMENTATIONS
+// ============================================================================
+
+function createFree(api: MonoApi, name: string | undefined): (buffer: NativePointer) => void {
+  switch (name) {
+    case "mono_free":
+      return buffer => {
+        if (!pointerIsNull(buffer)) {
+          api.native.mono_free(buffer);
+        }
+      };
+    case "mono_unity_g_free":
+      return buffer => {
+        if (!pointerIsNull(buffer)) {
+          api.native.mono_unity_g_free(buffer);
+        }
+      };
+    case "g_free":
+      return buffer => {
+        if (!pointerIsNull(buffer)) {
+          api.native.g_free(buffer);
+        }
+      };
+  }
+
+  let warned = false;
+  return () => {
+    if (!warned) {
+      warned = true;
+      console.warn(
+        "[frida-mono-bridge] No free function available (mono_free, mono_unity_g_free, g_free). " +
+          "Memory allocated by Mono APIs will leak. This may be acceptable for short-lived scripts.",
+      );
+    }
+  };
+}
+
+/**
+ * Compose a reader trying each conversion in order; a NULL buffer falls through to the next one.
+ *
+ * mono_string_to_utf8/utf16 return heap buffers that are freed after the read;
+ * mono_string_chars points into the managed object and is never freed.
+ */
+function createStringReader(
+  api: MonoApi,
+  kinds: readonly StringReadKind[],
+  free: (buffer: NativePointer) => void,
+): (str: NativePointer) => string {
+  const readers = kinds.map(kind => STRING_READERS[kind](api, free));
+  if (readers.length === 1) {
+    const [read] = readers;
+    return str => (pointerIsNull(str) ? "" : (read(str) ?? ""));
+  }
+  return str => {
+    if (pointerIsNull(str)) {
+      return "";
+    }
+    for (const read of readers) {
+      const value = read(str);
+      if (value !== null) {
+        return value;
+      }
+    }
+    return "";
+  };
+}
+
+type StringReader = (str: NativePointer) => string | null;
+type StringReaderFactory = (api: MonoApi, free: (buffer: NativePointer) => void) => StringReader;
+
+const STRING_READERS: Record<StringReadKind, StringReaderFactory> = {
+  utf8: (api, free) => str => {
+    const buffer = api.native.mono_string_to_utf8(str);
+    if (pointerIsNull(buffer)) {
+      return null;
+    }
+    try {
+      return readUtf8String(buffer);
+    } finally {
+      free(buffer);
+    }
+  },
+  utf16: (api, free) => str => {
+    const buffer = api.native.mono_string_to_utf16(str);
+    if (pointerIsNull(buffer)) {
+      return null;
+    }
+    try {
+      return readUtf16String(buffer);
+    } finally {
+      free(buffer);
+    }
+  },
+  chars: api => str => {
+    const chars = api.native.mono_string_chars(str);
+    const length = api.native.mono_string_length(str) as number;
+    return length > 0 ? readUtf16String(chars, length) : "";
+  },
+};
+
+// ============================================================================
+// CONSTANTS
+// ============================================================================
+
+/** MONO_TABLE_TYPEDEF */
+const MONO_METADATA_TABLE_TYPEDEF = 2;
@@ -0,0 +1,226 @@
+/**
+ * Managed String Cache - Reuse MonoString instances for repeated JS strings.
+ *
+ * Hooks and bulk invocations tend to pass the same short strings (keys, tags,
+ * names) over and over; allocating a fresh MonoString for each call adds
+ * avoidable GC pressure to the target. Cached strings are interned with
+ * `mono_string_intern` when available, so they are shared with literals the
+ * runtime already holds, and pinned with a GC handle until evicted.
+ *
+ * @module runtime/string-cache
+ */
+
+import { LruCache } from "../utils/cache";
+import { Logger } from "../utils/log";
+import { pointerIsNull } from "../utils/memory";
+import type { MonoApi } from "./api";
+import { GCHandle, GCHandlePool } from "./gchandle";
+
+// ============================================================================
+// TYPE DEFINITIONS
+// ============================================================================
+
+/**
+ * Limits for a {@link ManagedStringCache}.
+ */
+export interface ManagedStringCacheConfig {
+  /** Maximum number of cached strings */
+  capacity: number;
+  /** Approximate budget for cached string payloads, in bytes (UTF-16) */
+  maxBytes: number;
+  /** Strings longer than this are never cached */
+  maxLength: number;
+  /** Intern cached strings with `mono_string_intern` */
+  intern: boolean;
+}
+
+/**
+ * Default cache limits.
+ */
+export const DEFAULT_STRING_CACHE_CONFIG: ManagedStringCacheConfig = {
+  capacity: 1024,
+  maxBytes: 1024 * 1024,
+  maxLength: 256,
+  intern: true,
+};
+
+/**
+ * Counters for a {@link ManagedStringCache}.
+ */
+export interface ManagedStringCacheStats {
+  hits: number;
+  misses: number;
+  evictions: number;
+  entries: number;
+  bytes: number;
+}
+
+interface CachedString {
+  pointer: NativePointer;
+  handle: GCHandle | null;
+  bytes: number;
+}
+
+const stringCacheLogger = Logger.withTag("StringCache");
+
+// ============================================================================
+// MANAGED STRING CACHE
+// ============================================================================
+
+/**
+ * LRU cache of pinned MonoString instances keyed by JS string.
+ *
+ * Returned pointers are shared: only pass them where the callee does not keep
+ * or mutate the string in place, as with ordinary managed string literals.
+ *
+ * @example
+ * ```typescript
+ * const cache = new ManagedStringCache(api);
+ * const tag = cache.get("Player"); // same MonoString on every call
+ * ```
+ */
+export class ManagedStringCache {
+  private readonly config: ManagedStringCacheConfig;
+  private readonly entries: LruCache<string, CachedString>;
+  private pool: GCHandlePool | null = null;
+  private bytes = 0;
+  private hits = 0;
+  private misses = 0;
+  private evictions = 0;
+
+  constructor(
+    private readonly api: MonoApi,
+    config?: Partial<ManagedStringCacheConfig>,
+  ) {
+    this.config = { ...DEFAULT_STRING_CACHE_CONFIG, ...config };
+    this.entries = new LruCache<string, CachedString>({
+      capacity: this.config.capacity,
+      onEvict: (_text, entry) => this.release(entry),
+    });
+  }
+
+  /**
+   * Whether `text` is short enough to be cached.
+   */
+  accepts(text: string): boolean {
+    return text.length <= this.config.maxLength;
+  }
+
+  /**
+   * Get the cached MonoString for `text`, creating it on first use.
+   * Strings longer than `maxLength` are allocated fresh and not cached.
+   *
+   * @param text JavaScript string
+   * @returns Pointer to a MonoString
+   */
+  get(text: string): NativePointer {
+    const cached = this.entries.get(text);
+    if (cached) {
+      this.hits++;
+      return cached.pointer;
+    }
+
+    this.misses++;
+    if (!this.accepts(text)) {
+      return this.api.stringNew(text);
+    }
+
+    let pointer = this.api.stringNew(text);
+    let interned = false;
+    if (this.config.intern && this.api.hasExport("mono_string_intern")) {
+      const result = this.api.native.mono_string_intern(pointer) as NativePointer;
+      if (!pointerIsNull(result)) {
+        pointer = result;
+        interned = true;
+      }
+    }
+
+    // The intern table roots interned strings; anything else must be pinned to be kept
+    const handle = this.pin(pointer);
+    if (!handle && !interned) {
+      return pointer;
+    }
+    const entry: CachedString = { pointer, handle, bytes: text.length * 2 };
+    this.entries.set(text, entry);
+    this.bytes += entry.bytes;
+    this.trimToBudget();
+    return pointer;
+  }
+
+  /**
+   * Whether `text` is currently cached.
+   */
+  has(text: string): boolean {
+    return this.entries.has(text);
+  }
+
+  /**
+   * Drop one cached string and release its GC handle.
+   */
+  delete(text: string): boolean {
+    return this.entries.delete(text);
+  }
+
+  /**
+   * Drop all cached strings and release their GC handles.
+   */
+  clear(): void {
+    // Every handle in the pool belongs to an entry, so free them in one batch
+    this.evictions += this.entries.size;
+    this.entries.discard();
+    this.pool?.releaseAll();
+    this.bytes = 0;
+  }
+
+  /**
+   * Get cache counters.
+   */
+  getStats(): ManagedStringCacheStats {
+    return {
+      hits: this.hits,
+      misses: this.misses,
+      evictions: this.evictions,
+      entries: this.entries.size,
+      bytes: this.bytes,
+    };
+  }
+
+  /**
+   * Release every handle and the handle pool.
+   */
+  dispose(): void {
+    this.clear();
+    this.pool?.dispose();
+    this.pool = null;
+  }
+
+  // ===== INTERNAL =====
+
+  private pin(pointer: NativePointer): GCHandle | null {
+    try {
+      if (!this.pool) {
+        this.pool = new GCHandlePool(this.api);
+      }
+      return this.pool.create(pointer, true);
+    } catch (error) {
+      // Without a handle the string may be collected, so it is returned but not kept
+      stringCacheLogger.debug(`Failed to pin cached string: ${error}`);
+      return null;
+    }
+  }
+
+  private release(entry: CachedString): void {
+    this.bytes -= entry.bytes;
+    this.evictions++;
+    if (entry.handle) {
+      this.pool?.release(entry.handle);
+    }
+  }
+
+  private trimToBudget(): void {
+    while (this.bytes > this.config.maxBytes && this.entries.size > 1) {
+      const oldest = this.entries.keys().next().value as string;
+      this.entries.delete(oldest);
+    }
+  }
+}
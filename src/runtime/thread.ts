@@ -15,6 +15,7 @@
 
 import { pointerIsNull } from "../utils/memory";
 import { MonoApi } from "./api";
+import { SafepointBatcher } from "./safepoint";
 
 // ============================================================================
 // TYPE DEFINITIONS
@@ -87,9 +88,21 @@ export class ThreadManager {
   /** Threads that were attached by the bridge (not externally) */
   private readonly bridgeOwnedThreads = new Set<number>();
   private totalAttachmentCount = 0;
+  private safepointBatcher: SafepointBatcher | null = null;
 
   constructor(private readonly api: MonoApi) {}
 
+  /**
+   * Safepoint batching for long bridge loops on cooperative-suspend runtimes.
+   * Created on first access.
+   */
+  get safepoints(): SafepointBatcher {
+    if (!this.safepointBatcher) {
+      this.safepointBatcher = new SafepointBatcher(this.api);
+    }
+    return this.safepointBatcher;
+  }
+
   // ===== EXECUTION METHODS =====
 
   /**
@@ -166,17 +179,15 @@ export class ThreadManager {
     // We must NOT call api.native.* here because that would auto-attach via this manager.
     // mono_domain_get() is a cheap TLS read and returns NULL for unattached threads.
     try {
-      const domainGet = this.api.tryGetNativeFunction("mono_domain_get");
+      const { domainGet, threadCurrent, threadAttach } = this.api.strategies.threads;
       if (domainGet) {
         const currentDomain = domainGet() as NativePointer;
         if (currentDomain && !pointerIsNull(currentDomain)) {
           // Thread appears attached (domain TLS is set). Try to get the thread object.
-          const threadCurrent = this.api.tryGetNativeFunction("mono_thread_current");
           const threadObj = threadCurrent ? (threadCurrent() as NativePointer) : NULL;
 
           // If mono_thread_current is unavailable or returns NULL, fall back to mono_thread_attach
           // with the current domain (idempotent when already attached).
-          const threadAttach = this.api.tryGetNativeFunction("mono_thread_attach");
           const resolvedThread = !pointerIsNull(threadObj)
             ? threadObj
             : threadAttach
@@ -319,12 +330,9 @@ export class ThreadManager {
    * @returns True if the thread was detached, false otherwise
    */
   detachIfExiting(): boolean {
-    if (!this.api.hasExport("mono_thread_detach_if_exiting")) {
-      return false;
-    }
-
     try {
-      const result = this.api.native.mono_thread_detach_if_exiting();
+      // Bound to a stub returning false when the export is missing
+      const result = this.api.strategies.threads.detachIfExiting();
       if (result) {
         // Thread was detached, update internal state
         const threadId = getCurrentThreadId();
@@ -333,7 +341,7 @@ export class ThreadManager {
         this.bridgeOwnedThreads.delete(threadId);
         this.externallyAttachedThreads.delete(threadId);
       }
-      return !!result;
+      return result;
     } catch {
       return false;
     }
@@ -348,6 +356,7 @@ export class ThreadManager {
    */
   detachAll(): void {
     const currentThreadId = getCurrentThreadId();
+    this.safepointBatcher?.dispose();
 
     for (const [threadId, threadHandle] of this.attachedThreads.entries()) {
       try {
@@ -23,6 +23,7 @@ import { MonoArray } from "../model/array";
 import { MonoDelegate } from "../model/delegate";
 import { MonoObject } from "../model/object";
 import { MonoString } from "../model/string";
+import { TypeKeyedMap } from "../model/type-map";
 import {
   MonoType,
   MonoTypeKind,
@@ -71,6 +72,24 @@ export interface UnboxValueOptions extends ValueReadOptions {
   structAsObject?: boolean;
 }
 
+/**
+ * Facts about a type that conversions consult on every call.
+ * Computed once per canonical type by {@link getTypeConversionInfo}.
+ */
+export interface TypeConversionInfo {
+  kind: MonoTypeKind;
+  /** Short type name, as used for numeric range validation */
+  name: string;
+  valueType: boolean;
+  byRef: boolean;
+  /** Kind the value is stored as: the underlying kind for enums, `kind` otherwise */
+  storageKind: MonoTypeKind;
+  /** Size of the stored value in bytes */
+  valueSize: number;
+  /** Reference type deriving from System.Delegate */
+  isDelegate: boolean;
+}
+
 /**
  * Numeric range definition for validation.
  */
@@ -132,6 +151,51 @@ export function validateNumericValue(value: number, typeName: string): number {
   return value;
 }
 
+// ============================================================================
+// PER-TYPE CONVERSION INFO
+// ============================================================================
+
+const conversionInfo = new WeakMap<MonoApi, TypeKeyedMap<TypeConversionInfo>>();
+
+/**
+ * Get the conversion facts for a type.
+ *
+ * Cached per runtime by canonical type identity, so fresh `MonoType` wrappers
+ * (e.g. from signatures read per call) do not repeat the name, kind, size and
+ * class queries. Entries are dropped when an image is invalidated.
+ */
+export function getTypeConversionInfo(type: MonoType): TypeConversionInfo {
+  const api = type.api;
+  let infos = conversionInfo.get(api);
+  if (!infos) {
+    const created = new TypeKeyedMap<TypeConversionInfo>();
+    api.cacheScopes.onInvalidate(event => {
+      if (event.kind !== "domain") {
+        created.clear();
+      }
+    });
+    conversionInfo.set(api, created);
+    infos = created;
+  }
+  return infos.getOrCreate(type, buildConversionInfo);
+}
+
+function buildConversionInfo(type: MonoType): TypeConversionInfo {
+  const kind = type.kind;
+  const valueType = type.valueType;
+  const effective = resolveUnderlyingPrimitive(type);
+  const reference = !valueType && kind !== MonoTypeKind.String && !isArrayKind(kind);
+  return {
+    kind,
+    name: type.name,
+    valueType,
+    byRef: type.byRef,
+    storageKind: effective.kind,
+    valueSize: valueType ? effective.valueSize.size : Process.pointerSize,
+    isDelegate: reference && (type.class?.isDelegate ?? false),
+  };
+}
+
 // ============================================================================
 // PRIMITIVE VALUE ALLOCATION
 // ============================================================================
@@ -143,10 +207,9 @@ export function validateNumericValue(value: number, typeName: string): number {
  * NOT a boxed MonoObject*. This function returns the raw storage pointer.
  */
 export function allocPrimitiveValue(type: MonoType, value: number | boolean | bigint): NativePointer {
-  const effectiveType = resolveUnderlyingPrimitive(type);
-  const kind = effectiveType.kind;
-  const { size } = effectiveType.valueSize;
-  const storageSize = Math.max(size, Process.pointerSize);
+  const info = getTypeConversionInfo(type);
+  const kind = info.storageKind;
+  const storageSize = Math.max(info.valueSize, Process.pointerSize);
   const storage = Memory.alloc(storageSize);
 
   // Handle boolean specially to ensure proper type conversion
@@ -219,7 +282,8 @@ export function unboxValue(
   }
 
   const unboxed = api.native.mono_object_unbox(boxedPtr);
-  const kind = type.kind;
+  const info = getTypeConversionInfo(type);
+  const kind = info.kind;
 
   // Try to read as primitive value first
   const primitiveResult = readPrimitiveValue(unboxed, kind, options);
@@ -229,13 +293,11 @@ export function unboxValue(
 
   // Handle special cases
   switch (kind) {
-    case MonoTypeKind.Enum: {
-      const underlying = type.underlyingType;
-      if (underlying) {
-        return readPrimitiveValue(unboxed, underlying.kind, options);
+    case MonoTypeKind.Enum:
+      if (info.storageKind !== MonoTypeKind.Enum) {
+        return readPrimitiveValue(unboxed, info.storageKind, options);
       }
       return unboxed.readS32();
-    }
 
     case MonoTypeKind.ValueType:
     case MonoTypeKind.GenericInstance:
@@ -268,7 +330,8 @@ export function readTypedValue(
   options: TypedReadOptions = {},
   wrappers: MonoValueWrappers = DEFAULT_WRAPPERS,
 ): unknown {
-  const kind = monoType.kind;
+  const info = getTypeConversionInfo(monoType);
+  const kind = info.kind;
 
   // String: storage holds a managed object reference.
   if (kind === MonoTypeKind.String) {
@@ -293,8 +356,7 @@ export function readTypedValue(
   if (kind === MonoTypeKind.Class || kind === MonoTypeKind.Object) {
     const objPtr = storagePtr.readPointer();
     if (pointerIsNull(objPtr)) return null;
-    const klass = monoType.class;
-    if (klass?.isDelegate) {
+    if (info.isDelegate) {
       const Ctor = wrappers.delegate ?? DEFAULT_WRAPPERS.delegate;
       return new Ctor(api, objPtr);
     }
@@ -304,7 +366,7 @@ export function readTypedValue(
 
   // Generic instance: could be value type or reference.
   if (kind === MonoTypeKind.GenericInstance) {
-    if (monoType.valueType) {
+    if (info.valueType) {
       // Value type is inlined.
       return storagePtr;
     }
@@ -321,9 +383,8 @@ export function readTypedValue(
 
   // Enum: read underlying primitive.
   if (kind === MonoTypeKind.Enum) {
-    const underlying = monoType.underlyingType;
-    if (underlying) {
-      return readPrimitiveValue(storagePtr, underlying.kind, { returnBigInt: options.returnBigInt });
+    if (info.storageKind !== MonoTypeKind.Enum) {
+      return readPrimitiveValue(storagePtr, info.storageKind, { returnBigInt: options.returnBigInt });
     }
     return storagePtr.readS32();
   }
@@ -344,7 +405,8 @@ export function readTypedValue(
  * and field/property helpers.
  */
 export function writeTypedValue(api: MonoApi, storagePtr: NativePointer, value: unknown, monoType: MonoType): void {
-  const kind = monoType.kind;
+  const info = getTypeConversionInfo(monoType);
+  const kind = info.kind;
 
   if (value === null || value === undefined) {
     if (isValueTypeKind(kind)) {
@@ -392,10 +454,9 @@ export function writeTypedValue(api: MonoApi, storagePtr: NativePointer, value:
   }
 
   if (kind === MonoTypeKind.GenericInstance) {
-    if (monoType.valueType) {
+    if (info.valueType) {
       if (value instanceof NativePointer) {
-        const size = monoType.valueSize.size;
-        Memory.copy(storagePtr, value, size);
+        Memory.copy(storagePtr, value, info.valueSize);
       }
       return;
     }
@@ -409,16 +470,14 @@ export function writeTypedValue(api: MonoApi, storagePtr: NativePointer, value:
 
   if (kind === MonoTypeKind.ValueType) {
     if (value instanceof NativePointer) {
-      const size = monoType.valueSize.size;
-      Memory.copy(storagePtr, value, size);
+      Memory.copy(storagePtr, value, info.valueSize);
     }
     return;
   }
 
   if (kind === MonoTypeKind.Enum) {
-    const underlying = monoType.underlyingType;
-    if (underlying) {
-      writePrimitiveValue(storagePtr, underlying.kind, value);
+    if (info.storageKind !== MonoTypeKind.Enum) {
+      writePrimitiveValue(storagePtr, info.storageKind, value);
       return;
     }
     storagePtr.writeS32(value as number);
@@ -476,7 +535,8 @@ export function convertJsToMono(api: MonoApi, value: unknown, targetType: MonoTy
     return value;
   }
 
-  const typeName = targetType.name;
+  const info = getTypeConversionInfo(targetType);
+  const typeName = info.name;
 
   // Handle by JavaScript type
   if (typeof value === "number") {
@@ -508,7 +568,7 @@ export function convertJsToMono(api: MonoApi, value: unknown, targetType: MonoTy
   }
 
   if (typeof value === "boolean") {
-    return convertBoolean(value, typeName, targetType);
+    return convertBoolean(value, info);
   }
 
   if (typeof value === "string") {
@@ -533,11 +593,11 @@ export function convertJsToMono(api: MonoApi, value: unknown, targetType: MonoTy
   return value;
 }
 
-function convertBoolean(value: boolean, typeName: string, targetType: MonoType): unknown {
-  if (typeName === "Boolean" || typeName === "System.Boolean") {
+function convertBoolean(value: boolean, info: TypeConversionInfo): unknown {
+  if (info.name === "Boolean" || info.name === "System.Boolean") {
     return value;
   }
-  if (targetType.valueType) {
+  if (info.valueType) {
     return value ? 1 : 0;
   }
   return value;
@@ -594,7 +654,8 @@ export function convertMonoToJs(
     return null;
   }
 
-  const kind = type.kind;
+  const info = getTypeConversionInfo(type);
+  const kind = info.kind;
 
   // Handle void
   if (kind === MonoTypeKind.Void) {
@@ -611,7 +672,7 @@ export function convertMonoToJs(
   }
 
   // Handle value types (need to unbox)
-  if (type.valueType) {
+  if (info.valueType) {
     return unboxValue(api, rawResult, type, options);
   }
 
@@ -622,8 +683,7 @@ export function convertMonoToJs(
   }
 
   // Handle reference types - return wrapped MonoObject
-  const klass = type.class;
-  if (klass?.isDelegate) {
+  if (info.isDelegate) {
     const Ctor = wrappers.delegate ?? DEFAULT_WRAPPERS.delegate;
     return new Ctor(api, rawResult);
   }
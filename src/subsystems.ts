@@ -2,6 +2,8 @@ import { MonoArray } from "./model/array";
 import type { MonoClass } from "./model/class";
 import { MonoDelegate } from "./model/delegate";
 import type { MonoField } from "./model/field";
+import type { FieldWatchCallbacks, FieldWatchOptions } from "./model/field-watch";
+import type { CollectionReadOptions, ManagedCollectionReader } from "./model/managed-collections";
 import type { GarbageCollector } from "./model/gc";
 import {
   DuplicatePolicy,
@@ -11,10 +13,13 @@ import {
   type InternalCallRegistrationOptions,
 } from "./model/internal-call";
 import type { MonoMethod } from "./model/method";
+import type { ReplaceImplementationOptions, ReplacementImplementation } from "./model/method-replacement";
 import { MonoObject } from "./model/object";
 import type { MonoProperty } from "./model/property";
+import type { ManagedStackFrame, StackThreadTarget, StackWalker, StackWalkOptions } from "./model/stack";
 import { MonoString } from "./model/string";
 import type {
+  CallStackOptions,
   FieldAccessCallbacks,
   MethodCallbacks,
   MethodCallbacksExtended,
@@ -24,10 +29,28 @@ import type {
   Tracer,
 } from "./model/trace";
 import { MonoType, MonoTypeKind, readPrimitiveValue, writePrimitiveValue } from "./model/type";
+import type { SceneSnapshot, SceneSnapshotOptions, SceneSpace, UnitySceneSnapshotter } from "./model/unity-scene";
+import {
+  readUnityStruct,
+  readUnityStructArray,
+  type UnityStruct,
+  type UnityTransformReader,
+} from "./model/unity-values";
 import type { MonoApi } from "./runtime/api";
 import type { GCHandle } from "./runtime/gchandle";
 import { boxPrimitiveValue, boxValueTypePtr, readTypedValue, writeTypedValue } from "./runtime/value-conversion";
-import type { GC, ICall, MemoryReadOptions, MemorySubsystem, MemoryType, Trace, TypedReadOptions } from "./types";
+import type {
+  Collections,
+  GC,
+  ICall,
+  MemoryReadOptions,
+  MemorySubsystem,
+  MemoryType,
+  Stack,
+  Trace,
+  TypedReadOptions,
+  Unity,
+} from "./types";
 import { MonoErrorCodes, raise } from "./utils/errors";
 import { pointerIsNull } from "./utils/memory";
 
@@ -161,6 +184,53 @@ export function buildMemorySubsystem(api: MonoApi): MemorySubsystem {
   };
 }
 
+export function buildCollectionsSubsystem(reader: ManagedCollectionReader): Collections {
+  return {
+    readList: <T>(list: MonoObject | NativePointer, options?: CollectionReadOptions) =>
+      reader.readList<T>(list, options),
+    readDictionary: <K, V>(dictionary: MonoObject | NativePointer, options?: CollectionReadOptions) =>
+      reader.readDictionary<K, V>(dictionary, options),
+    readHashSet: <T>(set: MonoObject | NativePointer, options?: CollectionReadOptions) =>
+      reader.readHashSet<T>(set, options),
+    read: (collection: MonoObject | NativePointer, options?: CollectionReadOptions) => reader.read(collection, options),
+    count: (collection: MonoObject | NativePointer) => reader.count(collection),
+    kindOf: (collection: MonoObject | NativePointer) => reader.kindOf(collection),
+    clearCache: () => reader.clearCache(),
+  };
+}
+
+export function buildUnitySubsystem(snapshotter: UnitySceneSnapshotter, transforms: UnityTransformReader): Unity {
+  return {
+    get isAvailable() {
+      return snapshotter.isAvailable;
+    },
+    snapshot: (options?: SceneSnapshotOptions) => snapshotter.snapshot(options),
+    refresh: (previous: SceneSnapshot, options?: SceneSnapshotOptions) => snapshotter.refresh(previous, options),
+    positions: (items: ReadonlyArray<MonoObject | NativePointer>, space?: SceneSpace) =>
+      transforms.positions(items, space),
+    rotations: (items: ReadonlyArray<MonoObject | NativePointer>, space?: SceneSpace) =>
+      transforms.rotations(items, space),
+    readStruct: (address: NativePointer, struct: UnityStruct) => readUnityStruct(address, struct),
+    readStructArray: (array: MonoArray, struct?: UnityStruct) => readUnityStructArray(array, struct),
+    clearCache: () => {
+      snapshotter.clearCache();
+      transforms.clearCache();
+    },
+  };
+}
+
+export function buildStackSubsystem(walker: StackWalker): Stack {
+  return {
+    current: (options?: StackWalkOptions) => walker.current(options),
+    ofThread: (thread: StackThreadTarget, options?: StackWalkOptions) => walker.ofThread(thread, options),
+    symbolize: (frames: readonly ManagedStackFrame[]) => walker.symbolize(frames),
+    get sourceLocations() {
+      return walker.sourceLocations;
+    },
+    clearCaches: () => walker.clearCaches(),
+  };
+}
+
 export function buildTraceSubsystem(tracer: Tracer): Trace {
   return {
     method: (m: MonoMethod, cb: MethodCallbacks) => tracer.method(m, cb),
@@ -172,13 +242,18 @@ export function buildTraceSubsystem(tracer: Tracer): Trace {
     classesByPattern: (pattern: string, callbacks: MethodCallbacks) => tracer.classesByPattern(pattern, callbacks),
     replaceReturnValue: (m: MonoMethod, r: ReturnValueReplacer) => tracer.replaceReturnValue(m, r),
     tryReplaceReturnValue: (m: MonoMethod, r: ReturnValueReplacer) => tracer.tryReplaceReturnValue(m, r),
-    field: (f: MonoField, cb: FieldAccessCallbacks) => tracer.field(f, cb),
+    replaceImplementation: (m: MonoMethod, impl: ReplacementImplementation, options?: ReplaceImplementationOptions) =>
+      tracer.replaceImplementation(m, impl, options),
+    field: (f: MonoField, cb: FieldAccessCallbacks, options?: FieldWatchOptions) => tracer.field(f, cb, options),
+    watchField: (f: MonoField, cb: FieldWatchCallbacks, options?: FieldWatchOptions) =>
+      tracer.watchField(f, cb, options),
     fieldsByPattern: (pattern: string, callbacks: FieldAccessCallbacks) => tracer.fieldsByPattern(pattern, callbacks),
     property: (p: MonoProperty, cb: PropertyAccessCallbacks) => tracer.property(p, cb),
     propertiesByPattern: (pattern: string, callbacks: PropertyAccessCallbacks) =>
       tracer.propertiesByPattern(pattern, callbacks),
     createPerformanceTracker: () => tracer.createPerformanceTracker(),
-    methodWithCallStack: (m: MonoMethod, cb: MethodCallbacksTimed) => tracer.methodWithCallStack(m, cb),
+    methodWithCallStack: (m: MonoMethod, cb: MethodCallbacksTimed, options?: CallStackOptions) =>
+      tracer.methodWithCallStack(m, cb, options),
   };
 }
 
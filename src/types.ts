@@ -1,4 +1,6 @@
 import type { ValueReadOptions } from "./model/type";
+import type { SafepointConfig } from "./runtime/safepoint";
+import type { SessionStorage } from "./runtime/session-state";
 
 export type PerformMode = "bind" | "free" | "leak";
 
@@ -34,6 +36,26 @@ export interface Config {
    * @default 512
    */
   pinnedStringCacheCapacity?: number;
+
+  /**
+   * Safepoint tuning for long bridge loops (metadata scans, bulk reads).
+   * Only relevant on cooperative-suspend runtimes; see `SafepointBatcher`.
+   */
+  safepoints?: Partial<SafepointConfig>;
+
+  /**
+   * Hook assembly load, assembly close and domain unload during initialization so
+   * domain- and image-scoped caches are invalidated automatically; see `CacheScopeRegistry`.
+   * The assembly load hook cannot be removed once installed.
+   * @default true
+   */
+  trackCacheScopes?: boolean;
+
+  /**
+   * Persist warm state (discovery, export offsets, class/method tokens) across script reloads.
+   * Restored during initialization and saved on `dispose()`; see `SessionState`.
+   */
+  session?: SessionStorage;
 }
 
 export type MemoryType =
@@ -281,6 +303,84 @@ export interface GC {
   suppressFinalize(objectPtr: NativePointer): boolean;
 }
 
+export interface Collections {
+  /** Read a `List<T>` into a JS array. */
+  readList<T = unknown>(
+    list: import("./model/object").MonoObject | NativePointer,
+    options?: import("./model/managed-collections").CollectionReadOptions,
+  ): T[];
+  /** Read a `Dictionary<TKey, TValue>` into a JS Map. */
+  readDictionary<K = unknown, V = unknown>(
+    dictionary: import("./model/object").MonoObject | NativePointer,
+    options?: import("./model/managed-collections").CollectionReadOptions,
+  ): Map<K, V>;
+  /** Read a `HashSet<T>` into a JS array. */
+  readHashSet<T = unknown>(
+    set: import("./model/object").MonoObject | NativePointer,
+    options?: import("./model/managed-collections").CollectionReadOptions,
+  ): T[];
+  /** Read any supported collection (arrays for lists/sets, Map for dictionaries). */
+  read(
+    collection: import("./model/object").MonoObject | NativePointer,
+    options?: import("./model/managed-collections").CollectionReadOptions,
+  ): unknown[] | Map<unknown, unknown>;
+  /** Element count without reading elements. */
+  count(collection: import("./model/object").MonoObject | NativePointer): number;
+  /** Identify a supported collection, or null. */
+  kindOf(
+    collection: import("./model/object").MonoObject | NativePointer,
+  ): import("./model/managed-collections").ManagedCollectionKind | null;
+  /** Forget resolved collection layouts. */
+  clearCache(): void;
+}
+
+export interface Unity {
+  /** Whether UnityEngine scene types are loaded. */
+  readonly isAvailable: boolean;
+  /** Capture the scene graph as flat columns (default roots: the active scene). */
+  snapshot(options?: import("./model/unity-scene").SceneSnapshotOptions): import("./model/unity-scene").SceneSnapshot;
+  /** Re-capture a scene, reusing rows whose transforms did not change. */
+  refresh(
+    previous: import("./model/unity-scene").SceneSnapshot,
+    options?: import("./model/unity-scene").SceneSnapshotOptions,
+  ): import("./model/unity-scene").SceneSnapshot;
+  /** Positions of many transforms, packed as x, y, z per transform. */
+  positions(
+    transforms: ReadonlyArray<import("./model/object").MonoObject | NativePointer>,
+    space?: import("./model/unity-scene").SceneSpace,
+  ): Float32Array;
+  /** Rotations of many transforms, packed as x, y, z, w per transform. */
+  rotations(
+    transforms: ReadonlyArray<import("./model/object").MonoObject | NativePointer>,
+    space?: import("./model/unity-scene").SceneSpace,
+  ): Float32Array;
+  /** Decode an unboxed Vector2/3/4, Quaternion, Color, Matrix4x4 or Rect into floats. */
+  readStruct(address: NativePointer, struct: import("./model/unity-values").UnityStruct): Float32Array;
+  /** Decode a managed array of Unity structs with one bulk copy. */
+  readStructArray(
+    array: import("./model/array").MonoArray,
+    struct?: import("./model/unity-values").UnityStruct,
+  ): Float32Array;
+  /** Forget resolved UnityEngine methods and interned component classes. */
+  clearCache(): void;
+}
+
+export interface Stack {
+  /** Capture the managed stack of the calling thread (innermost frame first). */
+  current(options?: import("./model/stack").StackWalkOptions): import("./model/stack").ManagedStackFrame[];
+  /** Capture the managed frames of another thread by id, ThreadDetails or CpuContext. */
+  ofThread(
+    thread: import("./model/stack").StackThreadTarget,
+    options?: import("./model/stack").StackWalkOptions,
+  ): import("./model/stack").ManagedStackFrame[];
+  /** Resolve file/line for frames in one batch (no-op for frames already symbolized). */
+  symbolize(frames: readonly import("./model/stack").ManagedStackFrame[]): void;
+  /** Cached source-location resolver backing frame symbolization. */
+  readonly sourceLocations: import("./model/source-location").SourceLocationResolver;
+  /** Drop interned frame methods, cached JIT lookups and source locations. */
+  clearCaches(): void;
+}
+
 export interface Trace {
   method(
     monoMethod: import("./model/method").MonoMethod,
@@ -309,10 +409,23 @@ export interface Trace {
     monoMethod: import("./model/method").MonoMethod,
     replacement: (originalRetval: NativePointer, thisPtr: NativePointer, args: NativePointer[]) => NativePointer | void,
   ): (() => void) | null;
+  /** Replace a method's body; the original stays callable and `detachAll` reverts it. */
+  replaceImplementation(
+    monoMethod: import("./model/method").MonoMethod,
+    impl: import("./model/method-replacement").ReplacementImplementation,
+    options?: import("./model/method-replacement").ReplaceImplementationOptions,
+  ): import("./model/method-replacement").MethodReplacement;
   field(
     monoField: import("./model/field").MonoField,
     callbacks: import("./model/trace").FieldAccessCallbacks,
+    options?: import("./model/trace").FieldTraceOptions,
   ): (() => void) | null;
+  /** Watch a field's storage with `MemoryAccessMonitor`; accesses are attributed to managed methods. */
+  watchField(
+    monoField: import("./model/field").MonoField,
+    callbacks: import("./model/field-watch").FieldWatchCallbacks,
+    options?: import("./model/field-watch").FieldWatchOptions,
+  ): () => void;
   fieldsByPattern(pattern: string, callbacks: import("./model/trace").FieldAccessCallbacks): () => void;
   property(
     monoProperty: import("./model/property").MonoProperty,
@@ -323,6 +436,7 @@ export interface Trace {
   methodWithCallStack(
     monoMethod: import("./model/method").MonoMethod,
     callbacks: import("./model/trace").MethodCallbacksTimed,
+    options?: import("./model/trace").CallStackOptions,
   ): () => void;
 }
 
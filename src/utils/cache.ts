@@ -172,6 +172,14 @@ export class LruCache<K, V> {
     this.map.clear();
   }
 
+  /**
+   * Drop all entries without eviction callbacks.
+   * For teardown, when whatever the callbacks release is released in bulk elsewhere.
+   */
+  discard(): void {
+    this.map.clear();
+  }
+
   keys(): IterableIterator<K> {
     return this.map.keys();
   }
@@ -470,3 +478,64 @@ export function lazy<This, Value>(
     return value;
   };
 }
+
+// ============================================================================
+// SCOPED LAZY DECORATOR
+// ============================================================================
+
+/**
+ * Object whose cached values belong to a runtime scope (AppDomain or image).
+ * `cacheGeneration` changes whenever that scope is invalidated.
+ */
+export interface CacheScoped {
+  readonly cacheGeneration: number;
+}
+
+const SCOPED_STORE = Symbol("__mono_scoped_store__");
+
+type ScopedEntry = { generation: number; value: unknown };
+
+/**
+ * Like {@link lazy}, but the cached value is dropped when the instance's
+ * `cacheGeneration` moves, e.g. after an assembly loads into its domain or
+ * its image is closed.
+ *
+ * @example
+ * class MyDomain implements CacheScoped {
+ *   get cacheGeneration() { return api.cacheScopes.generation(this.pointer); }
+ *
+ *   @scopedLazy
+ *   get assemblies(): MonoAssembly[] { ... }
+ * }
+ */
+export function scopedLazy<This extends CacheScoped, Value>(
+  getter: (this: This) => Value,
+  context: LazyGetterContext<This>,
+): ((this: This) => Value) | void {
+  if (context.kind !== "getter") {
+    raise(
+      MonoErrorCodes.INVALID_ARGUMENT,
+      "@scopedLazy can only be applied to getters",
+      "Apply @scopedLazy to a getter accessor",
+      { parameter: "context", value: context },
+    );
+  }
+
+  const name = context.name;
+  return function (this: This) {
+    const generation = this.cacheGeneration;
+    const record = this as unknown as Record<symbol, Map<string | symbol, ScopedEntry> | undefined>;
+    let store = record[SCOPED_STORE];
+    if (!store) {
+      store = new Map();
+      Object.defineProperty(this, SCOPED_STORE, { value: store, configurable: true, enumerable: false });
+    }
+    const entry = store.get(name);
+    if (entry && entry.generation === generation) {
+      return entry.value as Value;
+    }
+    const value = getter.call(this);
+    store.set(name, { generation, value });
+    return value;
+  };
+}
@@ -235,6 +235,13 @@ export function raiseFrom(
   details?: Record<string, unknown>,
 ): never {
   const monoError = handleMonoError(error);
+
+  // Managed exceptions decode their details lazily; re-raising would force decoding.
+  const isPlainRethrow = code === MonoErrorCodes.UNKNOWN && !message && !hint && !details;
+  if (isPlainRethrow && monoError instanceof MonoManagedExceptionError) {
+    throw monoError;
+  }
+
   const effectiveCode = code === MonoErrorCodes.UNKNOWN ? monoError.code : code;
   const effectiveMessage = message ?? stripMonoCodePrefix(monoError.message);
   const mergedDetails: Record<string, unknown> = {
@@ -523,20 +530,168 @@ export class MonoTypeError extends MonoError {
   }
 }
 
+/**
+ * Decoded description of a managed exception.
+ */
+export interface ManagedExceptionInfo {
+  exceptionType?: string;
+  exceptionMessage?: string;
+  stackTrace?: string;
+  /** The exception was unpinned (evicted or released) before its details were decoded */
+  evicted?: boolean;
+}
+
+/**
+ * Callback that decodes a managed exception on demand.
+ */
+export type ManagedExceptionResolver = () => ManagedExceptionInfo;
+
 /**
  * Managed exception error (thrown from managed code)
+ *
+ * Errors produced by the runtime invoke path are created with {@link MonoManagedExceptionError.deferred}:
+ * they only carry the exception pointer, and the type/message/stack trace are decoded on first access.
+ * Callers that swallow the exception never pay for the decoding.
  */
 export class MonoManagedExceptionError extends MonoError {
+  #exception?: NativePointer;
+  #info: ManagedExceptionInfo | null;
+  #resolver: ManagedExceptionResolver | null = null;
+  #release: (() => void) | null = null;
+
   constructor(
     message: string,
-    public readonly exception?: NativePointer,
-    public readonly exceptionType?: string,
-    public readonly exceptionMessage?: string,
-    public readonly stackTrace?: string,
+    exception?: NativePointer,
+    exceptionType?: string,
+    exceptionMessage?: string,
+    stackTrace?: string,
     cause?: Error,
   ) {
     super(message, MonoErrorCodes.MANAGED_EXCEPTION, { exception, exceptionType, exceptionMessage, stackTrace }, cause);
     this.name = "MonoManagedExceptionError";
+    this.#exception = exception;
+    this.#info = { exceptionType, exceptionMessage, stackTrace };
+  }
+
+  /**
+   * Create an error whose details are decoded lazily.
+   *
+   * @param exception Managed exception object pointer
+   * @param resolve Decodes type/message/stack trace; called at most once
+   * @param release Optional callback that drops whatever keeps the exception alive
+   * @param hint Suggestion appended to the message
+   */
+  static deferred(
+    exception: NativePointer,
+    resolve: ManagedExceptionResolver,
+    release?: () => void,
+    hint?: string,
+  ): MonoManagedExceptionError {
+    const error = new MonoManagedExceptionError("Managed exception thrown", exception);
+    error.#info = null;
+    error.#resolver = resolve;
+    error.#release = release ?? null;
+
+    Object.defineProperty(error, "message", {
+      configurable: true,
+      enumerable: false,
+      get(): string {
+        const text = error.detailsEvicted
+          ? "Managed exception thrown (details evicted before they were read)"
+          : error.exceptionMessage || `Managed exception thrown: ${error.exceptionType || "Unknown"}`;
+        return `[Mono:${MonoErrorCodes.MANAGED_EXCEPTION}] ${hint ? `${text}. ${hint}` : text}`;
+      },
+    });
+
+    // The stack was captured with the placeholder message; rebuild its header from the decoded one
+    const captured = error.stack ?? "";
+    const framesAt = captured.search(/^\s*at /m);
+    const frames = framesAt >= 0 ? captured.slice(framesAt) : "";
+    let assigned: string | undefined;
+    Object.defineProperty(error, "stack", {
+      configurable: true,
+      enumerable: false,
+      get(): string {
+        if (assigned !== undefined) {
+          return assigned;
+        }
+        const header = `${error.name}: ${error.message}`;
+        return frames ? `${header}\n${frames}` : header;
+      },
+      set(value: string) {
+        assigned = value;
+      },
+    });
+
+    const details: Record<string, unknown> = { exception };
+    for (const key of ["exceptionType", "exceptionMessage", "stackTrace", "detailsEvicted"] as const) {
+      Object.defineProperty(details, key, { enumerable: true, get: () => error[key] });
+    }
+    error.details = details;
+
+    return error;
+  }
+
+  /** Pointer to the managed exception object. */
+  get exception(): NativePointer | undefined {
+    return this.#exception;
+  }
+
+  /** Exception class name (decoded on first access). */
+  get exceptionType(): string | undefined {
+    return this.resolveInfo().exceptionType;
+  }
+
+  /** Exception message (decoded on first access). */
+  get exceptionMessage(): string | undefined {
+    return this.resolveInfo().exceptionMessage;
+  }
+
+  /** Managed stack trace (decoded on first access). */
+  get stackTrace(): string | undefined {
+    return this.resolveInfo().stackTrace;
+  }
+
+  /** Whether the exception details have been decoded. */
+  get isResolved(): boolean {
+    return this.#info !== null;
+  }
+
+  /**
+   * Whether the details were lost because the exception was unpinned first:
+   * evicted by newer exceptions, or {@link release}d before being read.
+   */
+  get detailsEvicted(): boolean {
+    return this.resolveInfo().evicted === true;
+  }
+
+  /**
+   * Release the reference keeping the managed exception alive.
+   *
+   * Details that were not decoded yet are lost ({@link detailsEvicted} reports it);
+   * {@link exception} may dangle afterwards.
+   */
+  release(): void {
+    const release = this.#release;
+    this.#release = null;
+    if (this.#info === null) {
+      this.#info = { evicted: true };
+      this.#resolver = null;
+    }
+    release?.();
+  }
+
+  private resolveInfo(): ManagedExceptionInfo {
+    if (this.#info === null) {
+      const resolver = this.#resolver;
+      this.#resolver = null;
+      try {
+        this.#info = resolver ? resolver() : {};
+      } catch {
+        this.#info = {};
+      }
+    }
+    return this.#info;
   }
 }
 
@@ -88,6 +88,18 @@ export function readUtf16String(pointer: NativePointer | null, length?: number):
 // FORMATTING AND CONVERSION UTILITIES
 // ============================================================================
 
+/**
+ * 32-bit FNV-1a hash of a string.
+ */
+export function hashString(text: string): number {
+  let hash = 0x811c9dc5;
+  for (let i = 0; i < text.length; i++) {
+    hash ^= text.charCodeAt(i);
+    hash = Math.imul(hash, 0x01000193);
+  }
+  return hash >>> 0;
+}
+
 /**
  * Convert value to safe JSON representation
  * Handles NativePointer and Function types gracefully
@@ -609,6 +609,37 @@ export async function createGCToolsTests(): Promise<TestResult[]> {
     }),
   );
 
+  results.push(
+    await withDomain("GCHandlePool - releaseAll frees many handles in one batch", () => {
+      if (!isGCHandleSupported()) {
+        console.log("[INFO] GC handle API not fully supported, skipping");
+        return;
+      }
+
+      const testObj = createTestObject();
+      if (!testObj) {
+        console.log("[INFO] Could not create test object, skipping");
+        return;
+      }
+
+      const pool = new GCHandlePool(Mono.api);
+      const handles: GCHandle[] = [];
+      for (let i = 0; i < 1000; i++) {
+        handles.push(pool.create(testObj, i % 2 === 0));
+      }
+      handles[0].free();
+
+      const startTime = Date.now();
+      const released = pool.releaseAll();
+      const elapsed = Date.now() - startTime;
+
+      assert(released === 999, `releaseAll should count only the 999 handles it freed, got ${released}`);
+      assert(pool.size === 0, "Pool should be empty after releaseAll");
+      assert(handles.every(handle => handle.isFreed && !handle.hasTarget()), "Every handle should be marked freed");
+      console.log(`  - Released ${released} handles in ${elapsed}ms`);
+    }),
+  );
+
   // ============================================
   // GC Handle Edge Cases
   // ============================================
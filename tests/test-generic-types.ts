@@ -11,6 +11,7 @@
  * - getGenericTypeDefinition()
  */
 
+import Mono from "../src";
 import { withAssemblies, withCoreClasses, withDomain, withGenerics } from "./test-fixtures";
 import { TestResult, assert, assertNotNull } from "./test-framework";
 
@@ -618,5 +619,77 @@ export async function createGenericTypeTests(): Promise<TestResult[]> {
     }),
   );
 
+  // ============================================
+  // Mono.collections Tests
+  // ============================================
+  results.push(
+    await withGenerics(
+      "Mono.collections - reads List<String> and Dictionary<String, Int32> from memory",
+      ({ listClass, dictionaryClass, stringClass, int32Class }) => {
+        const listOfString = listClass?.makeGenericType([stringClass]);
+        const dictOfStringInt = dictionaryClass?.makeGenericType([stringClass, int32Class]);
+        if (!listOfString || !dictOfStringInt) {
+          console.log("[SKIP] Could not construct List<String> / Dictionary<String, Int32>");
+          return;
+        }
+
+        const list = listOfString.createFactory().new();
+        const listAdd = listOfString.method("Add", 1);
+        for (const item of ["a", "b", "c"]) {
+          listAdd.invoke(list, [item]);
+        }
+        assert(Mono.collections.kindOf(list) === "List", "List<String> should be recognized");
+        const items = Mono.collections.readList<string>(list);
+        assert(items.join(",") === "a,b,c", `List contents should round-trip (got ${items.join(",")})`);
+        assert(Mono.collections.readList(list, { limit: 2 }).length === 2, "limit should cap the read");
+
+        const dict = dictOfStringInt.createFactory().new();
+        const dictAdd = dictOfStringInt.method("Add", 2);
+        dictAdd.invoke(dict, ["one", 1]);
+        dictAdd.invoke(dict, ["two", 2]);
+        dictAdd.invoke(dict, ["three", 3]);
+        dictOfStringInt.method("Remove", 1).invoke(dict, ["two"]);
+
+        const map = Mono.collections.readDictionary<string, number>(dict);
+        assert(map.size === 2, `Removed entries should be skipped (got ${map.size})`);
+        assert(map.get("one") === 1 && map.get("three") === 3, "Dictionary values should round-trip");
+        assert(Mono.collections.count(dict) === 2, "count() should match live entries");
+      },
+    ),
+  );
+
+  results.push(
+    await withGenerics(
+      "Mono.collections - HashSet<Int32> enumerates every live slot after Remove",
+      ({ domain, int32Class }) => {
+        const hashSetOfInt = domain.tryClass("System.Collections.Generic.HashSet`1")?.makeGenericType([int32Class]);
+        if (!hashSetOfInt) {
+          console.log("[SKIP] Could not construct HashSet<Int32>");
+          return;
+        }
+
+        const set = hashSetOfInt.createFactory().new();
+        const setAdd = hashSetOfInt.method("Add", 1);
+        const setRemove = hashSetOfInt.method("Remove", 1);
+        // Negative values hash to negative codes; removals leave live slots past the live count
+        const values = [-5, -4, -3, -2, -1, 0, 1, 2, 3, 4];
+        for (const value of values) {
+          setAdd.invoke(set, [value]);
+        }
+        for (const value of [-5, -4, -3]) {
+          setRemove.invoke(set, [value]);
+        }
+
+        const expected = values.slice(3);
+        const items = Mono.collections.readHashSet<number>(set).sort((a, b) => a - b);
+        assert(
+          items.join(",") === expected.join(","),
+          `HashSet enumeration should be complete (expected ${expected.join(",")}, got ${items.join(",")})`,
+        );
+        assert(Mono.collections.count(set) === expected.length, "count() should match live entries");
+      },
+    ),
+  );
+
   return results;
 }
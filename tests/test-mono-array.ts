@@ -11,6 +11,8 @@
  * - LINQ-like methods: where, select, first, last, any, all, count, etc.
  * - Iteration support
  * - Static factory methods
+ * - Multi-dimensional arrays and getRegion()
+ * - Native scans: findIndices, countMatches, summarize, findPattern
  * - Validation
  * - Edge cases
  */
@@ -1063,5 +1065,191 @@ export async function createMonoArrayTests(): Promise<TestResult[]> {
     }),
   );
 
+  // =====================================================
+  // SECTION 16: Multi-dimensional Arrays
+  // =====================================================
+  results.push(
+    await withCoreClasses("MonoArray - rank and bounds of int[,]", ({ int32Class }) => {
+      const grid = Mono.array.newMultiDimensional<number>(int32Class, [3, 4]);
+      assert(grid.rank === 2, `Rank should be 2, got ${grid.rank}`);
+      assert(grid.length === 12, `Total length should be 12, got ${grid.length}`);
+      assert(grid.dimensions.join(",") === "3,4", `Dimensions should be 3,4, got ${grid.dimensions}`);
+      assert(grid.flatIndex([2, 3]) === 11, "Last element should map to flat index 11");
+      assertThrows(() => grid.flatIndex([3, 0]), "Out-of-range index should throw");
+
+      const vector = Mono.array.new(int32Class, 5);
+      assert(vector.rank === 1, "SZ arrays should have rank 1");
+      assert(vector.bounds[0].length === 5 && vector.bounds[0].lowerBound === 0, "SZ bounds should be [5, 0]");
+    }),
+  );
+
+  results.push(
+    await withCoreClasses("MonoArray - getRegion() copies rectangular regions", ({ int32Class }) => {
+      const grid = Mono.array.newMultiDimensional<number>(int32Class, [3, 4]);
+      for (let i = 0; i < grid.length; i++) {
+        grid.setNumber(i, i);
+      }
+
+      const all = grid.getRegion();
+      assert(all instanceof Int32Array && all.length === 12, "Full region should be an Int32Array of 12");
+      assert(all[11] === 11, "Full region should be row-major");
+
+      const inner = grid.getRegion([1, 1], [3, 3]);
+      assert(Array.from(inner).join(",") === "5,6,9,10", `Inner region mismatch: ${Array.from(inner)}`);
+
+      const rows = grid.getRegion([1, 0], [3, 4]);
+      assert(rows.length === 8 && rows[0] === 4, "Whole-row region should start at row 1");
+      assertThrows(() => grid.getRegion([0, 0], [4, 4]), "Region past the bounds should throw");
+    }),
+  );
+
+  results.push(
+    await withCoreClasses("MonoArray - non-zero lower bounds", ({ int32Class }) => {
+      const arr = Mono.array.newMultiDimensional<number>(int32Class, [2, 2], [5, 10]);
+      assert(arr.bounds[0].lowerBound === 5 && arr.bounds[1].lowerBound === 10, "Lower bounds should be 5 and 10");
+      arr.setNumber(arr.flatIndex([6, 11]), 42);
+      const region = arr.getRegion([6, 11], [7, 12]);
+      assert(region[0] === 42, "Region indices should include the lower bounds");
+    }),
+  );
+
+  results.push(
+    await withCoreClasses("MonoArray - bounds layout is not confused by zero lower bounds", ({ int32Class }) => {
+      const arr = Mono.array.newMultiDimensional<number>(int32Class, [3, 1], [0, 4]);
+      const bounds = arr.bounds.map(bound => `${bound.length}@${bound.lowerBound}`).join(",");
+      assert(bounds === "3@0,1@4", `Bounds should be read with the runtime's layout: ${bounds}`);
+    }),
+  );
+
+  // =====================================================
+  // SECTION 17: Native Scans
+  // =====================================================
+  results.push(
+    await withCoreClasses("MonoArray - findIndices() / countMatches() predicates", ({ int32Class }) => {
+      const arr = Mono.array.new<number>(int32Class, 1000);
+      for (let i = 0; i < arr.length; i++) {
+        arr.setNumber(i, i % 10);
+      }
+
+      const sevens = arr.findIndices({ op: "eq", value: 7 });
+      assert(sevens.length === 100 && sevens[0] === 7 && sevens[99] === 997, "Should find every 7");
+      assert(arr.countMatches({ op: "gt", value: 7 }) === 200, "Two values per ten are greater than 7");
+      assert(arr.countMatches({ op: "between", min: 2, max: 4 }) === 300, "Inclusive range should match 2, 3, 4");
+      assert(arr.countMatches({ op: "in", values: [1, 9] }) === 200, "Equality set should match 1 and 9");
+
+      const limited = arr.findIndices({ op: "ge", value: 0 }, { start: 500, limit: 3 });
+      assert(Array.from(limited).join(",") === "500,501,502", `Limit/start mismatch: ${Array.from(limited)}`);
+    }),
+  );
+
+  results.push(
+    await withNumericTypes(
+      "MonoArray - native scans agree with exact comparisons for out-of-range operands",
+      ({ byteClass, int32Class, uint32Class }) => {
+        type Predicate = Parameters<MonoArray["findIndices"]>[0];
+        // Exact JS semantics, as evaluated by the fallback scan
+        const matches = (value: number, predicate: Predicate): boolean => {
+          switch (predicate.op) {
+            case "between":
+              return value >= Number(predicate.min) && value <= Number(predicate.max);
+            case "in":
+              return predicate.values.some(candidate => Number(candidate) === value);
+          }
+          const operand = Number(predicate.value);
+          switch (predicate.op) {
+            case "eq":
+              return value === operand;
+            case "ne":
+              return value !== operand;
+            case "lt":
+              return value < operand;
+            case "le":
+              return value <= operand;
+            case "gt":
+              return value > operand;
+            case "ge":
+              return value >= operand;
+          }
+        };
+        const check = (arr: MonoArray<number>, values: number[], predicates: Predicate[]) => {
+          values.forEach((value, i) => arr.setNumber(i, value));
+          for (const predicate of predicates) {
+            const expected = values.flatMap((value, i) => (matches(value, predicate) ? [i] : []));
+            const actual = Array.from(arr.findIndices(predicate));
+            assert(
+              actual.join(",") === expected.join(","),
+              `${JSON.stringify(predicate)}: expected [${expected}], got [${actual}]`,
+            );
+            assert(arr.countMatches(predicate) === expected.length, `${JSON.stringify(predicate)}: count mismatch`);
+          }
+        };
+
+        const bytes = [0, 1, 2, 44, 200, 255];
+        check(Mono.array.new<number>(byteClass, bytes.length), bytes, [
+          { op: "gt", value: 300 },
+          { op: "lt", value: 300 },
+          { op: "eq", value: 300 },
+          { op: "ne", value: 300 },
+          { op: "ge", value: -5 },
+          { op: "between", min: -10, max: 1.5 },
+          { op: "in", values: [300, 44, 2.5] },
+        ]);
+
+        const ints = [-3, 1, 2, 3, 2147483647];
+        check(Mono.array.new<number>(int32Class, ints.length), ints, [
+          { op: "lt", value: 2.5 },
+          { op: "le", value: 2.5 },
+          { op: "gt", value: 2.5 },
+          { op: "ge", value: 2.5 },
+          { op: "eq", value: 2.5 },
+          { op: "ne", value: 2.5 },
+          { op: "between", min: 1.5, max: 3.5 },
+          { op: "gt", value: 1e12 },
+          { op: "lt", value: -1e12 },
+        ]);
+
+        if (!uint32Class) {
+          console.log("[INFO] System.UInt32 not found, skipping unsigned cases");
+          return;
+        }
+        const uints = [0, 1, 4294967295];
+        check(Mono.array.new<number>(uint32Class, uints.length), uints, [
+          { op: "lt", value: -1 },
+          { op: "ge", value: -1 },
+          { op: "le", value: 4294967296 },
+        ]);
+      },
+    ),
+  );
+
+  results.push(
+    await withCoreClasses("MonoArray - summarize() aggregates", ({ int32Class }) => {
+      const arr = Mono.array.new<number>(int32Class, 5);
+      [4, -2, 9, 9, 0].forEach((value, i) => arr.setNumber(i, value));
+
+      const summary = arr.summarize();
+      assert(summary.count === 5, "Count should be 5");
+      assert(summary.sum === 20, `Sum should be 20, got ${summary.sum}`);
+      assert(summary.min === -2 && summary.minIndex === 1, "Minimum should be -2 at index 1");
+      assert(summary.max === 9 && summary.maxIndex === 2, "First maximum should be at index 2");
+
+      const tail = arr.summarize({ start: 3 });
+      assert(tail.count === 2 && tail.minIndex === 4, "Range summary should use flat indices");
+    }),
+  );
+
+  results.push(
+    await withCoreClasses("MonoArray - findPattern() byte search", ({ int32Class, stringClass }) => {
+      const arr = Mono.array.new<number>(int32Class, 16);
+      arr.setNumber(5, 0x11223344);
+      const offsets = arr.findPattern("44 33 22 11");
+      assert(offsets.length === 1 && offsets[0] === 20, `Pattern should be at byte 20, got ${offsets}`);
+      assertThrows(
+        () => Mono.array.new(stringClass, 1).findIndices({ op: "eq", value: 0 }),
+        "Reference-type arrays should not support native scans",
+      );
+    }),
+  );
+
   return results;
 }
@@ -8,7 +8,8 @@
  * - Domain lifecycle management
  */
 
-import Mono from "../src";
+import Mono, { parseTypeName, TypeNameResolver } from "../src";
+import { MonoTypeKind } from "../src/model/type";
 import { withDomain } from "./test-fixtures";
 import {
   assert,
@@ -48,6 +49,61 @@ export async function createMonoDomainTests(): Promise<TestResult> {
     }),
   );
 
+  await suite.addResultAsync(
+    withDomain("Domain caches should be invalidated per scope", ({ domain }) => {
+      const scopes = Mono.api.cacheScopes;
+      const assemblies = domain.assemblies;
+      assert(domain.assemblies === assemblies, "Assembly list should be cached");
+
+      const image = assemblies[0].image;
+      const classes = image.classes;
+      const generation = domain.cacheGeneration;
+
+      scopes.invalidateDomain(domain.pointer);
+      assert(domain.cacheGeneration !== generation, "Domain generation should move");
+      assert(domain.assemblies !== assemblies, "Assembly list should be rebuilt after invalidation");
+      assert(image.classes === classes, "Image caches should stay warm when only the domain is invalidated");
+
+      scopes.invalidateImage(image.pointer);
+      assert(image.classes !== classes, "Image caches should be rebuilt after image invalidation");
+
+      const events: string[] = [];
+      const unsubscribe = scopes.onInvalidate(event => events.push(event.kind));
+      scopes.invalidateAll();
+      unsubscribe();
+      assert(events.length === 1 && events[0] === "all", "invalidateAll should notify listeners");
+      assert(scopes.install() === scopes.isTracking, "Installing hooks again should be a no-op");
+      console.log(`    Cache scopes: ${JSON.stringify(scopes.getStats())}`);
+    }),
+  );
+
+  await suite.addResultAsync(
+    withDomain("Domain should resolve and cache CLR type names", ({ domain }) => {
+      const name = "System.Collections.Generic.Dictionary`2[[System.String, mscorlib],[System.Int32]][]&";
+      const parsed = parseTypeName(name);
+      assert(parsed.name === "System.Collections.Generic.Dictionary`2", "Parser should split the generic definition");
+      assert(parsed.genericArguments.length === 2, "Parser should read both generic arguments");
+      assert(parsed.genericArguments[0].assembly === "mscorlib", "Parser should keep argument assemblies");
+      assert(parsed.modifiers.length === 2 && parsed.modifiers[1].kind === "byref", "Parser should keep suffix order");
+
+      const list = domain.resolveType("System.Collections.Generic.List`1[[System.String, mscorlib]]");
+      assertNotNull(list, "Generic instantiation should resolve");
+      assert(list.kind === MonoTypeKind.GenericInstance, "List<string> should be a generic instance");
+      const again = domain.resolveType("System.Collections.Generic.List`1[[System.String, mscorlib]]");
+      assert(again === list, "Repeated lookups should be served from the cache");
+
+      const grid = domain.resolveType("System.Int32[,]");
+      assertNotNull(grid, "Multi-dimensional array should resolve");
+      assert(grid.kind === MonoTypeKind.Array, "Int32[,] should be an array type");
+
+      const batch = domain.resolveTypes(["System.String", "System.Object&", "Missing.Type", "System.String"]);
+      assert(batch.size === 3, "Batch should dedupe names");
+      assert(batch.get("System.Object&")?.byRef === true, "By-ref suffix should resolve");
+      assert(batch.get("Missing.Type") === null, "Unknown names should resolve to null");
+      console.log(`    Type names: ${JSON.stringify(TypeNameResolver.for(Mono.api).getStats())}`);
+    }),
+  );
+
   await suite.addResultAsync(
     withDomain("Domain should provide consistent access", () => {
       const domain1 = Mono.domain;
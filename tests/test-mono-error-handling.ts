@@ -199,6 +199,54 @@ export async function createMonoErrorHandlingTests(): Promise<TestResult> {
     }),
   );
 
+  await suite.addResultAsync(
+    createStandaloneTest("MonoManagedExceptionError - deferred details resolve once", () => {
+      let resolveCount = 0;
+      let released = false;
+      const error = MonoManagedExceptionError.deferred(
+        ptr(0x12345678),
+        () => {
+          resolveCount++;
+          return { exceptionType: "FormatException", exceptionMessage: "Bad input", stackTrace: "  at Foo.Bar ()" };
+        },
+        () => {
+          released = true;
+        },
+      );
+
+      assert(!error.isResolved, "Details should not be decoded at construction");
+      assert(resolveCount === 0, "Resolver should not run eagerly");
+      assert(error.exceptionType === "FormatException", "Should resolve exception type");
+      assert(error.message.includes("Bad input"), "Message should use decoded exception message");
+      assert(error.details?.stackTrace === "  at Foo.Bar ()", "Details should expose decoded stack trace");
+      assert(resolveCount === 1, "Resolver should run exactly once");
+
+      error.release();
+      assert(released, "release() should invoke the release callback");
+    }),
+  );
+
+  await suite.addResultAsync(
+    createStandaloneTest("MonoManagedExceptionError - stack header and evicted details", () => {
+      const error = MonoManagedExceptionError.deferred(ptr(0x12345678), () => ({
+        exceptionType: "FormatException",
+        exceptionMessage: "Bad input",
+      }));
+      const header = (error.stack ?? "").split("\n")[0];
+      assert(header.includes("Bad input"), `Stack header should show the decoded message (got ${header})`);
+      assert(!error.detailsEvicted, "Decoded details should not be reported as evicted");
+
+      const evicted = MonoManagedExceptionError.deferred(ptr(0x12345678), () => ({ evicted: true }));
+      assert(evicted.detailsEvicted, "Evicted exceptions should say so");
+      assert(evicted.message.includes("evicted"), "Message should mention the evicted details");
+      assert(evicted.details?.detailsEvicted === true, "Details should expose the evicted state");
+
+      const released = MonoManagedExceptionError.deferred(ptr(0x12345678), () => ({ exceptionMessage: "Unread" }));
+      released.release();
+      assert(released.detailsEvicted, "Releasing before decoding should report evicted details");
+    }),
+  );
+
   await suite.addResultAsync(
     withCoreClasses("MonoManagedExceptionError - real exception from Int32.Parse", ({ int32Class }) => {
       const parseMethod = int32Class.tryMethod("Parse", 1);
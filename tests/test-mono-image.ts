@@ -5,6 +5,7 @@
  */
 
 import Mono from "../src";
+import { ILXrefIndex } from "../src/model/xref";
 import { withDomain } from "./test-fixtures";
 import {
   TestResult,
@@ -904,5 +905,53 @@ export async function createMonoImageTests(): Promise<TestResult[]> {
     }),
   );
 
+  results.push(
+    await withDomain("MonoImage.xrefs should find callers and round-trip through a buffer", ({ domain }) => {
+      const mscorlib = domain.tryAssembly("mscorlib");
+      assertNotNull(mscorlib, "mscorlib should exist");
+      const image = mscorlib!.image;
+
+      const xrefs = image.xrefs;
+      assert(xrefs.edgeCount > 0, "mscorlib IL should contain call/field xrefs");
+
+      const concat = domain.tryClass("System.String")?.tryMethod("Concat", 2);
+      if (concat) {
+        const callers = xrefs.callersOf(concat);
+        assert(callers.length > 0, "String.Concat(a, b) should have callers in mscorlib");
+        const edges = xrefs.edgesFrom(callers[0].token);
+        assert(edges.length > 0, "A caller should have outgoing edges");
+      }
+
+      const restored = ILXrefIndex.fromBuffer(image, xrefs.toBuffer());
+      assert(restored.edgeCount === xrefs.edgeCount, "Restored index should keep all edges");
+      assert(restored.methodCount === xrefs.methodCount, "Restored index should cover the same methods");
+    }),
+  );
+
+  results.push(
+    await withDomain("MonoImage.typeTable should match the classes it was decoded from", ({ domain }) => {
+      const mscorlib = domain.tryAssembly("mscorlib");
+      assertNotNull(mscorlib, "mscorlib should exist");
+      const image = mscorlib!.image;
+
+      const table = image.typeTable;
+      assert(table === image.typeTable, "Type table should be built once per image");
+      assert(table.count === image.classCount, "Type table should have one row per TypeDef");
+      assert(image.namespaces.includes("System"), "Namespaces should include System");
+
+      const stringClass = domain.tryClass("System.String");
+      assertNotNull(stringClass, "System.String should exist");
+      const row = table.tokens.indexOf(stringClass!.typeToken);
+      assert(row >= 0, "String's token should be in the table");
+      assert(table.name(row) === "String" && table.namespace(row) === "System", "Row names should match");
+      assert(table.rowsInNamespace("System").includes(row), "String's row should be in the System namespace");
+      assert(
+        image.getClassesByNamespace("System").some(klass => klass.name === "String"),
+        "getClassesByNamespace should materialize System.String",
+      );
+      console.log(`  - ${table.count} types, ${table.stats.nested} nested, read from ${table.stats.source}`);
+    }),
+  );
+
   return results;
 }
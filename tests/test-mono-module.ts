@@ -9,6 +9,13 @@
  */
 
 import Mono from "../src";
+import {
+  clearModuleDiscoveryCache,
+  exportModuleDiscoveryCache,
+  findAllMonoModules,
+  importModuleDiscoveryCache,
+  isMonoModule,
+} from "../src/runtime/module";
 import { withDomain } from "./test-fixtures";
 import {
   assert,
@@ -125,6 +132,41 @@ export async function createMonoModuleTests(): Promise<TestResult> {
     }),
   );
 
+  await suite.addResultAsync(
+    withDomain("Module discovery cache should round-trip heuristic verdicts", () => {
+      const module = Mono.module;
+      assertNotNull(module, "Module should be available");
+      assert(isMonoModule(module.name), "Sentinel probe should recognize the Mono module");
+
+      const entries = exportModuleDiscoveryCache();
+      clearModuleDiscoveryCache();
+      assert(exportModuleDiscoveryCache().length === 0, "Cache should be empty after clear");
+
+      importModuleDiscoveryCache([...entries, { path: module.path, size: module.size, hits: 42 }]);
+      const restored = exportModuleDiscoveryCache().find(entry => entry.path === module.path);
+      assertNotNull(restored, "Imported entry should be present");
+      assert(restored.size === module.size && restored.hits === 42, "Imported entry should keep size and hits");
+
+      clearModuleDiscoveryCache();
+      importModuleDiscoveryCache(entries);
+    }),
+  );
+
+  await suite.addResultAsync(
+    withDomain("Mono.runtimes should list this runtime first", () => {
+      const module = Mono.module;
+      const discovered = findAllMonoModules(module.name);
+      assert(discovered.length >= 1, "At least one runtime should be discovered");
+      assert(discovered[0].module.base.equals(module.base), "Primary runtime should be discovered first");
+
+      const runtimes = Mono.runtimes;
+      assert(runtimes[0] === Mono, "Mono.runtimes should start with Mono itself");
+      assert(runtimes.length === discovered.length, `Expected ${discovered.length} runtimes, got ${runtimes.length}`);
+      assert(Mono.runtimes === runtimes, "Runtime list should be discovered once");
+      console.log(`    Runtimes: ${discovered.map(result => result.module.name).join(", ")}`);
+    }),
+  );
+
   await suite.addResultAsync(
     withDomain("Module should enumerate exports correctly", () => {
       const module = Mono.module;
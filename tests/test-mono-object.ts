@@ -31,6 +31,27 @@ export async function createMonoObjectTests(): Promise<TestResult[]> {
     }),
   );
 
+  results.push(
+    await withCoreClasses("ObjectFactory should create objects in bulk", ({ domain, objectClass }) => {
+      const factory = objectClass.createFactory();
+      const objects = factory.newMany(8);
+      assert(objects.length === 8, "newMany should create the requested count");
+      assert(factory.createdCount === 8, "Factory should count created objects");
+      const distinct = new Set(objects.map(o => o.pointer.toString()));
+      assert(distinct.size === 8, "Each object should be a distinct allocation");
+      assert(objects[0].class.name === "Object", "Objects should have the factory's class");
+
+      const versionClass = domain.tryClass("System.Version");
+      if (versionClass) {
+        const versions = versionClass.createFactory(["System.Int32", "System.Int32"]);
+        const created = versions.newMany(3, i => [i + 1, i * 10]);
+        const major = versionClass.tryMethod("get_Major");
+        assertNotNull(major, "Version.get_Major should exist");
+        assert(major.call<number>(created[2], []) === 3, "Constructor arguments should be applied per index");
+      }
+    }),
+  );
+
   // ===== OBJECT CLONING TESTS =====
 
   results.push(
@@ -169,6 +190,47 @@ export async function createMonoObjectTests(): Promise<TestResult[]> {
     }),
   );
 
+  // ===== CHANGE DETECTION TESTS =====
+
+  results.push(
+    await withDomain("Mono.watch should report only changed fields", ({ domain }) => {
+      const exceptionClass = domain.tryClass("System.Exception");
+      if (!exceptionClass) {
+        console.log("[SKIP] System.Exception class not found");
+        return;
+      }
+
+      const stringField = exceptionClass.fields.find(field => {
+        const typeName = field.type.fullName;
+        return !field.isStatic && !field.isLiteral && (typeName === "System.String" || typeName === "String");
+      });
+      if (!stringField) {
+        console.log("[SKIP] No string field found on System.Exception");
+        return;
+      }
+
+      const objects = [exceptionClass.alloc(), exceptionClass.alloc(), exceptionClass.alloc()];
+      const watch = Mono.watch(objects, [stringField]);
+      try {
+        assert(watch.size === 3, `Expected 3 watched objects, got ${watch.size}`);
+        assert(watch.poll().length === 0, "Unchanged objects should report no deltas");
+
+        stringField.setValue(objects[1], Mono.api.stringNew("frida-mono-bridge-watch"));
+        const deltas = watch.poll();
+        assert(deltas.length === 1, `Expected 1 delta, got ${deltas.length}`);
+        assert(deltas[0].index === 1, `Expected delta for object 1, got ${deltas[0].index}`);
+        assert(deltas[0].field.name === stringField.name, "Delta should name the changed field");
+        assert(watch.poll().length === 0, "Second poll should report no deltas");
+
+        assert(watch.remove(objects[0]), "remove should find a watched object");
+        assert(watch.size === 2, `Expected 2 watched objects after remove, got ${watch.size}`);
+      } finally {
+        watch.dispose();
+      }
+      assert(watch.isDisposed, "Watch should be disposed");
+    }),
+  );
+
   // ===== OBJECT TYPE TESTS =====
 
   results.push(
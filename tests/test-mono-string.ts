@@ -751,5 +751,33 @@ export async function createMonoStringTests(): Promise<TestResult[]> {
     }),
   );
 
+  results.push(
+    await withDomain("MonoApi.stringCache - reuses one interned string per value", () => {
+      const cache = Mono.api.stringCache;
+      const first = cache.get("cached-value");
+      const second = cache.get("cached-value");
+      assert(first.equals(second), "Repeated lookups should return the same MonoString");
+      assert(cache.has("cached-value"), "Value should be cached");
+      assert(Mono.api.readMonoString(first) === "cached-value", "Cached string should round-trip");
+      assert(cache.getStats().hits >= 1, "Second lookup should count as a hit");
+
+      cache.delete("cached-value");
+      assert(!cache.has("cached-value"), "Deleted value should no longer be cached");
+    }),
+  );
+
+  results.push(
+    await withDomain("MonoApi.stringNewMany - bulk allocation with in-batch dedupe", () => {
+      const texts = ["alpha", "beta", "alpha", "", "世界"];
+      const pointers = Mono.api.stringNewMany(texts);
+      assert(pointers.length === texts.length, "Should return one pointer per input");
+      assert(pointers[0].equals(pointers[2]), "Duplicates should share a MonoString");
+      for (let i = 0; i < texts.length; i++) {
+        const text = Mono.api.readMonoString(pointers[i]);
+        assert(text === texts[i], `Round trip failed for "${texts[i]}", got "${text}"`);
+      }
+    }),
+  );
+
   return results;
 }
@@ -905,6 +905,37 @@ export async function createMonoThreadingTests(): Promise<TestResult> {
     }),
   );
 
+  await suite.addResultAsync(
+    await withDomain("Safepoint batcher chunks loops and reports timings", () => {
+      const safepoints = Mono.api.getThreadManager()!.safepoints;
+      const previous = { ...safepoints.getConfig() };
+      safepoints.resetStats();
+      safepoints.configure({ mode: "always", chunkSize: 8 });
+      try {
+        const items = Array.from({ length: 100 }, (_, i) => i);
+        let sum = 0;
+        safepoints.forEach(items, item => {
+          sum += item;
+        });
+        assert(sum === 4950, "Every item should be visited once");
+
+        const stats = safepoints.getStats();
+        assert(stats.operations === 1, "One batched operation should be recorded");
+        assert(stats.items === 100, "All items should be counted");
+        if (stats.active) {
+          assert(stats.safepoints >= 12, `Expected a safepoint per chunk, got ${stats.safepoints}`);
+        }
+        console.log(`    coop=${stats.coop} active=${stats.active} safepoints=${stats.safepoints}`);
+
+        safepoints.configure({ mode: "never" });
+        assert(!safepoints.isActive, "Mode 'never' should disable safepoints");
+      } finally {
+        safepoints.configure(previous);
+        safepoints.resetStats();
+      }
+    }),
+  );
+
   const summary = suite.getSummary();
 
   return {
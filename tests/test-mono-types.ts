@@ -4,8 +4,10 @@
  */
 
 import Mono from "../src";
-import { MonoTypeKind, MonoTypeNameFormat } from "../src/model/type";
+import { MonoType, MonoTypeKind, MonoTypeNameFormat } from "../src/model/type";
+import { TypeKeyedMap } from "../src/model/type-map";
 import { tryGetClassPtrFromMonoType } from "../src/runtime/type-resolution";
+import { getTypeConversionInfo } from "../src/runtime/value-conversion";
 import { withDomain } from "./test-fixtures";
 import {
   assert,
@@ -1402,6 +1404,32 @@ export async function createMonoTypesTests(): Promise<TestResult> {
     }),
   );
 
+  await suite.addResultAsync(
+    withDomain("TypeKeyedMap should key by canonical type identity", ({ domain }) => {
+      const int32 = domain.class("System.Int32").type;
+      const listDefinition = domain.class("System.Collections.Generic.List`1");
+      const constructed = listDefinition.makeGenericType([domain.class("System.String")]);
+      assertNotNull(constructed, "List<string> should be constructible");
+      const resolved = domain.resolveType("System.Collections.Generic.List`1[[System.String, mscorlib]]");
+      assertNotNull(resolved, "List<string> should resolve by name");
+
+      assert(resolved.equals(constructed.type), "Both List<string> types should be equal");
+      assert(resolved.identityHash === constructed.type.identityHash, "Equal types should hash alike");
+      assert(!resolved.equals(int32), "Different types should not be equal");
+      assert(new MonoType(Mono.api, int32.pointer).identityHash === int32.identityHash, "Hash is wrapper independent");
+
+      const map = new TypeKeyedMap<string>();
+      map.set(resolved, "list").set(int32, "int");
+      assert(map.get(constructed.type) === "list", "Lookup should match another List<string> type");
+      assert(map.size === 2, "Equal types should share one entry");
+      assert(map.delete(constructed.type) && !map.has(resolved), "Delete should match by identity");
+
+      const info = getTypeConversionInfo(int32);
+      assert(info.storageKind === MonoTypeKind.I4 && info.valueSize === 4, "Int32 conversion info");
+      assert(getTypeConversionInfo(new MonoType(Mono.api, int32.pointer)) === info, "Conversion info should be shared");
+    }),
+  );
+
   const summary = suite.getSummary();
 
   return {
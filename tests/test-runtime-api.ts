@@ -5,6 +5,8 @@
  */
 
 import Mono from "../src";
+import { SHARED_NATIVE_STUBS } from "../src/runtime/native-stubs";
+import { SessionState } from "../src/runtime/session-state";
 import { withCoreClasses, withDomain } from "./test-fixtures";
 import { TestResult, assert, assertNotNull, assertThrows, createErrorHandlingTest } from "./test-framework";
 // MonoManagedExceptionError is not exported from the module - using duck typing instead
@@ -483,6 +485,55 @@ export async function createRuntimeApiTests(): Promise<TestResult[]> {
     }),
   );
 
+  // ===== SESSION STATE TESTS =====
+
+  results.push(
+    await withDomain("SessionState should round-trip export offsets and class tokens", ({ domain }) => {
+      const api = Mono.api;
+      const session = api.enableSession();
+      const klass = domain.tryClass("Mono.Runtime") ?? domain.tryClass("System.Object");
+      assertNotNull(klass, "A class should be resolvable");
+      session.recordClass(klass.fullName, klass.pointer);
+      const method = klass.methods[0];
+      if (method) {
+        session.recordMethod(klass.pointer, klass.fullName, method.name, method.parameterCount, method.pointer);
+      }
+
+      const snapshot = session.capture(Mono.module);
+      const offsets = snapshot.exports;
+      assert(offsets.mono_get_root_domain >= 0, "Resolved exports should be captured as offsets");
+      const roundTripped = JSON.parse(JSON.stringify(snapshot));
+
+      const restored = new SessionState(api);
+      try {
+        const result = restored.restore(roundTripped, Mono.module);
+        assert(result.restored, `Snapshot should be accepted: ${result.reason}`);
+        assert(result.classes >= 1, "Class tokens should be restored");
+
+        const resolved = restored.lookupClass(klass.fullName);
+        assertNotNull(resolved, "Restored class token should resolve");
+        assert(resolved.equals(klass.pointer), "Restored class should be the same class");
+        if (method) {
+          const resolvedMethod = restored.lookupMethod(
+            klass.pointer,
+            klass.fullName,
+            method.name,
+            method.parameterCount,
+          );
+          assert(resolvedMethod !== null && resolvedMethod.equals(method.pointer), "Restored method should match");
+        }
+
+        const mismatch = restored.restore(
+          { ...roundTripped, module: { ...roundTripped.module, size: 1 } },
+          Mono.module,
+        );
+        assert(!mismatch.restored, "Snapshot for another module should be rejected");
+      } finally {
+        restored.dispose();
+      }
+    }),
+  );
+
   // ===== THREAD ATTACHMENT TESTS =====
 
   results.push(
@@ -649,6 +700,61 @@ export async function createRuntimeApiTests(): Promise<TestResult[]> {
     }),
   );
 
+  results.push(
+    await withDomain("Generated native stubs should normalize arguments per declared type", () => {
+      const calls: unknown[][] = [];
+      const fake = ((...args: unknown[]) => {
+        calls.push(args);
+        return 7;
+      }) as unknown as NativeFunction<NativeFunctionReturnValue, NativeFunctionArgumentValue[]>;
+      let ran = 0;
+      const stub = SHARED_NATIVE_STUBS.mono_gchandle_new(fake, {
+        direct: () => ran > 0,
+        run: fn => {
+          ran++;
+          return fn();
+        },
+      });
+
+      assert(stub(null, true) === 7, "Stub should return the native result");
+      assert(ran === 1, "Stub should go through run() when not attached");
+      const [object, pinned] = calls[0] as [NativePointer, number];
+      assert(object.isNull() && pinned === 1, "Pointer null should become NULL and boolean 1");
+      stub(ptr(8), undefined);
+      assert(ran === 1 && calls[1][1] === 0, "Direct calls should skip run() and map undefined integers to 0");
+
+      const handle = Mono.api.native.mono_gchandle_new(Mono.api.stringNew("stub"), false) as number;
+      assert(handle !== 0, "Bound stub should reach the runtime");
+      Mono.api.native.mono_gchandle_free(handle);
+    }),
+  );
+
+  results.push(
+    await withDomain("MonoApi.strategies should be resolved once and match hasExport", () => {
+      const strategies = Mono.api.strategies;
+      assert(strategies === Mono.api.strategies, "Strategy table should be built once per API");
+
+      const summary = strategies.summary;
+      const expectedTier = Mono.api.hasExport("mono_method_get_unmanaged_thunk") ? "bleeding-edge" : "legacy";
+      assert(summary.tier === expectedTier, `Tier should be ${expectedTier}, got ${summary.tier}`);
+      assert(
+        summary.stringRead.includes("utf8") === Mono.api.hasExport("mono_string_to_utf8"),
+        "String read chain should follow the exports",
+      );
+      assert(
+        strategies.generics.inflateMethod === Mono.api.hasExport("mono_class_inflate_generic_method"),
+        "Generic inflation flag should follow the export",
+      );
+
+      const text = "stratégie";
+      const str = Mono.api.stringNew(text);
+      assert(strategies.readString(str) === text, "Bound string reader should round-trip");
+      assert(strategies.stringLength(str) === text.length, "Bound string length should match");
+      assert(strategies.readString(NULL) === "", "NULL strings should read as empty");
+      console.log(`  - ${summary.tier}: strings via ${summary.stringRead.join(" -> ")}`);
+    }),
+  );
+
   // ===== ERROR TYPE TESTS =====
 
   results.push(
@@ -6,9 +6,9 @@
  */
 
 import type { FieldAccessCallbacks, MethodCallbacksTimed, MethodStats, PropertyAccessCallbacks } from "../src";
-import Mono from "../src";
+import Mono, { FieldWatchManager, JitRangeIndex } from "../src";
 import { withCoreClasses, withDomain } from "./test-fixtures";
-import { TestResult, assert, assertNotNull } from "./test-framework";
+import { TestResult, assert, assertNotNull, assertThrows } from "./test-framework";
 
 /**
  * Create Trace Tools test suite
@@ -203,6 +203,33 @@ export async function createTraceToolsTests(): Promise<TestResult[]> {
     }),
   );
 
+  results.push(
+    await withDomain("Trace.replaceImplementation - swaps body and keeps original callable", ({ domain }) => {
+      const mathClass = domain.tryClass("System.Math");
+      const maxMethod = mathClass?.methods.find(
+        m => m.name === "Max" && m.parameterCount === 2 && m.parameterTypes[0].name === "System.Int32",
+      );
+      if (!maxMethod) {
+        console.log("[SKIP] System.Math.Max(Int32, Int32) not found");
+        return;
+      }
+
+      const stub = new NativeCallback((a: number, _b: number) => a, "int32", ["int32", "int32"]);
+      const replacement = Mono.trace.replaceImplementation(maxMethod, stub);
+      try {
+        assert(replacement.isActive, "Replacement should be active");
+        const replaced = maxMethod.call<number>(null, [3, 7]);
+        assert(replaced === 3, `Managed calls should run the replacement (got ${replaced})`);
+        assert(replacement.original(3, 7) === 7, "Original should still compute Max");
+      } finally {
+        replacement.revert();
+      }
+      assert(!replacement.isActive, "revert() should deactivate the replacement");
+      const restored = maxMethod.call<number>(null, [3, 7]);
+      assert(restored === 7, `revert() should restore the original body (got ${restored})`);
+    }),
+  );
+
   // ============================================
   // Trace.classAll Tests
   // ============================================
@@ -439,6 +466,7 @@ export async function createTraceToolsTests(): Promise<TestResult[]> {
 
         // Most internal fields won't be traceable without property accessors
         console.log(`[INFO] Field trace result: ${result === null ? "null (expected)" : "detach function"}`);
+        result?.();
       }
     }),
   );
@@ -821,6 +849,122 @@ export async function createTraceToolsTests(): Promise<TestResult[]> {
     }),
   );
 
+  results.push(
+    await withCoreClasses("Stack - current() walks managed frames and interns methods", ({ stringClass }) => {
+      const concatMethod = stringClass.tryMethod("Concat", 2);
+      assertNotNull(concatMethod, "Concat method should exist");
+
+      const walks: ReturnType<typeof Mono.stack.current>[] = [];
+      const detach = Mono.trace.method(concatMethod, {
+        onEnter: () => {
+          walks.push(Mono.stack.current({ maxFrames: 16 }));
+        },
+      });
+
+      try {
+        concatMethod.invoke(null, [Mono.api.stringNew("a"), Mono.api.stringNew("b")]);
+        concatMethod.invoke(null, [Mono.api.stringNew("c"), Mono.api.stringNew("d")]);
+      } finally {
+        detach();
+      }
+
+      assert(walks.length === 2, "Each invocation should capture one walk");
+      assert(walks[0].length > 0 && walks[1].length > 0, "Each walk should contain at least one managed frame");
+      assert(walks[0].length <= 16, "maxFrames should bound the walk");
+      for (const frame of walks[0]) {
+        assert(frame.managed, "Native frames should be dropped by default");
+        assert(typeof frame.method.name === "string", "Frame should resolve to a method");
+        assert(typeof frame.ilOffset === "number", "Frame should expose an IL offset");
+      }
+      const last0 = walks[0][walks[0].length - 1];
+      const last1 = walks[1][walks[1].length - 1];
+      assert(last0.method.pointer.equals(last1.method.pointer), "Both walks should end in the same caller");
+      assert(last0.method === last1.method, "Frames for the same method should share one wrapper");
+
+      const single = Mono.stack.current({ maxFrames: 1, includeNative: true });
+      assert(single.length <= 1, "maxFrames should also bound walks that keep native frames");
+    }),
+  );
+
+  results.push(
+    await withCoreClasses("Stack - source locations are cached per (method, IL offset)", ({ stringClass }) => {
+      const concatMethod = stringClass.tryMethod("Concat", 2);
+      assertNotNull(concatMethod, "Concat method should exist");
+
+      const resolver = Mono.stack.sourceLocations;
+      const [first, second] = resolver.resolveMany([
+        { method: concatMethod, ilOffset: 0 },
+        { method: concatMethod, ilOffset: 0 },
+      ]);
+      assert(first === second, "Duplicate queries in a batch should share one result");
+
+      const before = resolver.getStats();
+      const again = resolver.resolve(concatMethod, 0);
+      assert(again === first, "Repeated lookups should come from the cache");
+      if (resolver.isAvailable) {
+        assert(resolver.getStats().hits === before.hits + 1, "Cached lookup should count as a hit");
+      } else {
+        assert(first === null, "Without debug support locations should be null");
+      }
+    }),
+  );
+
+  results.push(
+    await withCoreClasses("Trace.watchField - attributes JIT code and manages watchpoints", ({ stringClass }) => {
+      const concatMethod = stringClass.tryMethod("Concat", 2);
+      assertNotNull(concatMethod, "Concat method should exist");
+
+      const index = new JitRangeIndex(Mono.api);
+      const impl = concatMethod.compile();
+      const info = index.lookup(impl);
+      assertNotNull(info, "Compiled code should map back to its method");
+      assert(info.nativeOffset >= 0, "Offset should be relative to the method start");
+      const queries = index.runtimeQueries;
+      const again = index.lookup(impl.add(1));
+      assert(again?.method === info.method, "Addresses inside a known range should hit the index");
+      assert(index.runtimeQueries === queries, "Indexed lookups should not query the runtime");
+
+      const instanceField = stringClass.fields.find(f => !f.isStatic);
+      assertNotNull(instanceField, "String should have an instance field");
+      assertThrows(
+        () => Mono.trace.watchField(instanceField, {}),
+        "Watching an instance field without instances should throw",
+      );
+
+      const staticField = stringClass.tryField("Empty");
+      assertNotNull(staticField, "String.Empty should exist");
+      assert(
+        Mono.trace.field(staticField, { onWrite: () => {} }) === null,
+        "Field tracing should not arm a watchpoint unless watchStorage is set",
+      );
+
+      if (!FieldWatchManager.isSupported) {
+        assertThrows(
+          () => Mono.trace.watchField(staticField, { onAccess: () => {} }),
+          "Watching without MemoryAccessMonitor should throw",
+        );
+        return;
+      }
+
+      const watcher = new FieldWatchManager(Mono.api, index);
+      try {
+        const detachers = watcher.batch(() => [
+          watcher.watch(staticField, { onAccess: () => {} }),
+          watcher.watch(staticField, { onAccess: () => {} }, { operations: ["read"] }),
+        ]);
+        assert(watcher.getStats().ranges === 2, "A batch should arm every watch it added");
+        watcher.batch(() => detachers.forEach(d => d()));
+        assert(watcher.getStats().ranges === 0, "Removing every watch should release the monitor");
+      } finally {
+        watcher.dispose();
+      }
+
+      const detach = Mono.trace.field(staticField, { onWrite: () => {} }, { watchStorage: true });
+      assertNotNull(detach, "Static field watch should return a detach function");
+      detach();
+    }),
+  );
+
   results.push(
     await withDomain("Trace - Stress test with multiple hooks", ({ domain }) => {
       // Create many hooks and ensure they can be cleaned up
@@ -10,6 +10,7 @@
  *   best-effort checks with graceful skips.
  */
 
+import type { SceneSnapshot } from "../src";
 import Mono from "../src";
 import { withUnity } from "./test-fixtures";
 import {
@@ -461,6 +462,72 @@ export async function createUnityGameObjectTests(): Promise<TestResult> {
     }),
   );
 
+  await suite.addResultAsync(
+    withUnity("Scene snapshot should produce consistent columns", ({ gameObjectClass }) => {
+      if (!gameObjectClass || !Mono.unity.isAvailable) {
+        console.log("    Unity scene types not available, skipping");
+        return;
+      }
+
+      let snapshot: SceneSnapshot;
+      try {
+        snapshot = Mono.unity.snapshot({ maxObjects: 2000, trackChanges: true });
+      } catch (error) {
+        if (isAccessViolation(error)) {
+          console.log("    Scene snapshot not safe off the main thread here, skipping");
+          return;
+        }
+        throw error;
+      }
+
+      const count = snapshot.count;
+      console.log(`    Snapshot rows: ${count}, component classes: ${snapshot.componentClasses.length}`);
+      assert(snapshot.parents.length === count, "parents column should have one entry per row");
+      assert(snapshot.names.length === count, "names column should have one entry per row");
+      assert(snapshot.positions.length === count * 3, "positions should hold x,y,z per row");
+      assert(snapshot.rotations.length === count * 4, "rotations should hold x,y,z,w per row");
+      assert(snapshot.componentStart.length === count + 1, "componentStart should have count + 1 entries");
+      for (let i = 0; i < count; i++) {
+        assert(snapshot.parents[i] < i, "Parents should precede their children");
+      }
+
+      const refreshed = Mono.unity.refresh(snapshot);
+      console.log(`    Refresh revisited ${refreshed.revisited}/${refreshed.count} rows`);
+      assert(refreshed.revisited <= refreshed.count, "Refresh cannot revisit more rows than it returns");
+    }),
+  );
+
+  await suite.addResultAsync(
+    withUnity("Bulk transform and struct readers should return packed floats", ({ gameObjectClass }) => {
+      const raw = Memory.alloc(16);
+      [1, 2, 3, 4].forEach((value, i) => raw.add(i * 4).writeFloat(value));
+      const quaternion = Mono.unity.readStruct(raw, "Quaternion");
+      assert(quaternion.length === 4 && quaternion[3] === 4, "Quaternion should decode as x, y, z, w");
+      assert(Mono.unity.readStruct(raw, "Vector2").length === 2, "Vector2 should decode two floats");
+
+      if (!gameObjectClass || !Mono.unity.isAvailable) {
+        console.log("    Unity scene types not available, skipping transform batch");
+        return;
+      }
+
+      let snapshot: SceneSnapshot;
+      try {
+        snapshot = Mono.unity.snapshot({ maxObjects: 500, components: false });
+      } catch (error) {
+        if (isAccessViolation(error)) {
+          console.log("    Scene snapshot not safe off the main thread here, skipping");
+          return;
+        }
+        throw error;
+      }
+
+      const positions = Mono.unity.positions(snapshot.transforms);
+      const rotations = Mono.unity.rotations(snapshot.transforms);
+      assert(positions.length === snapshot.count * 3, "positions should hold x,y,z per transform");
+      assert(rotations.length === snapshot.count * 4, "rotations should hold x,y,z,w per transform");
+    }),
+  );
+
   const summary = suite.getSummary();
 
   return {